@@ -92,7 +92,7 @@ dp::AABB::AABB(const v6f& source, Format input) : projD(Of), pointD(Of)
 
 dp::AABB::AABB(const AABB& source)
   : extX(source.extX), extY(source.extY), extZ(source.extZ),
-  projD(source.projD), pointD(source.projD), min(source.min), max(source.max)
+  projD(source.projD), pointD(source.pointD), min(source.min), max(source.max)
 {
   u4 i = 0;
   for (; i < PLANES; ++i)
@@ -106,7 +106,7 @@ dp::AABB::AABB(const AABB& source)
 dp::AABB::AABB(AABB&& result) noexcept
   : extX(std::move(result.extX)), extY(std::move(result.extY)),
   extZ(std::move(result.extZ)), projD(std::move(result.projD)),
-  pointD(std::move(result.projD)), min(std::move(result.min)),
+  pointD(std::move(result.pointD)), min(std::move(result.min)),
   max(std::move(result.max))
 {
   u4 i = 0;
@@ -170,6 +170,8 @@ dp::AABB& dp::AABB::Set(const v3f& center, const v3f& dimens, bool spans)
   mid = center;
   min += mid - hExt;
   max += mid + hExt;
+  SetDirtyProj();
+  SetDirtyVerts();
   return *this;
 
 } // end AABB& AABB::Set(const v3f&, const v3f&) const                        */
@@ -183,6 +185,8 @@ dp::AABB& dp::AABB::SetExt(const v3f& dimens)
   v3f hExt = HalfExt();
   min += mid - hExt;
   max += mid + hExt;
+  SetDirtyProj();
+  SetDirtyVerts();
   return *this;
 
 } // end AABB& AABB::SetPos(const v3f&) const                                 */
@@ -194,6 +198,7 @@ dp::AABB& dp::AABB::SetPos(const v3f& center)
   mid = center;
   min += Mid() - hExt;
   max += Mid() + hExt;
+  SetDirtyProj(); // Corner spans from mid-point unchanged by translation
   return *this;
 
 } // end AABB& AABB::SetPos(const v3f&) const                                 */
@@ -215,6 +220,7 @@ dp::AABB& dp::AABB::operator+=(const v3f& displacement)
   min += displacement; // extrema shift but scale remains intact
   max += displacement;
   mid += displacement; // midpoint too
+  SetDirtyProj(); // Corner spans from mid-point unchanged by translation
   return *this;
 } // end AABB AABB::operator+=(const v3f&)                                    */
 
@@ -298,6 +304,8 @@ dp::AABB& dp::AABB::operator*=(const v3f& scale)
   extY = hExt.y;
   extZ = hExt.z;
   // (Mid-point remains unchanged by scaling about that local origin)
+  SetDirtyProj();
+  SetDirtyVerts();
   return *this;
 } // end AABB& operator*=(const v3f&)                                         */
 
@@ -335,6 +343,8 @@ void dp::AABB::UpdateMatrix(void)
   extX = hExt.x;
   extY = hExt.y;
   extZ = hExt.z;
+  SetDirtyProj(); // Derived caches follow extrema; recalculated on-demand
+  SetDirtyVerts();
   // maybe a specialized, trace-major m3f is worth considering...?
   // could try it & profile to see just how slow m3f*m3f calls become...
 
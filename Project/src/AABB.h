@@ -213,6 +213,26 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     inline AABB Copy(void) const
     { return AABB(*this); } // end AABB AABB::Copy(void) const                */
 
+
+    /** Bring lazily derived corner spans & projections up to date for sharing
+    \brief
+      - bring lazily derived corner spans & projections up to date for sharing
+    \details
+      - corner spans & axis ranges are mutable caches, derived on-demand from
+      const methods (Vertices), so a box shared across threads needs this after
+      its last change: every const query then only reads, safe concurrently
+    \return
+      - reference to the finalized AABB for easier subsequent inline action
+    */
+    inline AABB& Finalize(void)
+    {
+      UpdateVerts();
+      UpdateProj();
+      return *this;
+
+    } // end AABB& AABB::Finalize(void)                                       */
+
+
     /** Get bounding box's scalar half extent spans in <x, y, z>
     \brief
       - get bounding box's scalar half extent spans in <x, y, z>
@@ -247,6 +267,16 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     { return IsNegF(pointD); } // end bool AABB::IsDirtyVerts(void) const     */
 
 
+    /** Get whether no derived data is pending a latent (const method) update
+    \brief
+      - get whether no derived data is pending a latent (const method) update
+    \return
+      - true only if const queries can't write caches: safe to share threads
+    */
+    inline bool IsFinal(void) const
+    { return !(IsDirtyProj() || IsDirtyVerts()); } // end bool AABB::IsFinal  */
+
+
     /** Get whether another bounding box is inside this box's extents
     \brief
       - get whether another bounding box is inside this box's extents
@@ -406,7 +436,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
       UpdateVerts();
       return &point[0];
 
-    } // end const const v3f* AABB::Vertices(void) const                */
+    } // end const const v3f* AABB::Vertices(void) const                      */
 
 
     /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -542,9 +572,12 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     {
       if (IsDirtyProj())
       {
+        pr[0].Set(min.x, max.x); // World axes are the local axes: extrema
+        pr[1].Set(min.y, max.y);
+        pr[2].Set(min.z, max.z);
         projD = 0.0f;
       }
-    }
+    } // end void AABB::UpdateProj(void) const                                */
 
     /** Correct derived point list data of box corner extents on latent update
     \brief
@@ -554,9 +587,17 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     {
       if (IsDirtyVerts())
       {
+        point[1].Set( extX, extY, extZ); // Octant 1: + + +
+        point[2].Set( extX, extY,-extZ); // Octant 2: + + -
+        point[3].Set( extX,-extY,-extZ); // Octant 3: + - -
+        point[4].Set( extX,-extY, extZ); // Octant 4: + - +
+        point[5].Set(-extX,-extY, extZ); // Octant 5: - - +
+        point[6].Set(-extX,-extY,-extZ); // Octant 6: - - -
+        point[7].Set(-extX, extY,-extZ); // Octant 7: - + -
+        point[0].Set(-extX, extY, extZ); // Octant 8: - + +
         pointD = 0.0f;
       }
-    }
+    } // end void AABB::UpdateVerts(void) const                               */
 
     /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
     /*                          Private Members                               */
@@ -591,7 +632,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
 
     //! Cartesian, linear scalar offsets of vertex world coords from mid-point
     mutable v3f point[POINTS];
-    // Derived data of vertex data's dirty flag MSB of wfb[2][3]: 0.0 -> -0.0
+    // Derived data of vertex data's dirty flag MSB of pointD: 0.0 -> -0.0
 
     //! Cartesian extremal world coordinate ranges, per local=:world AABB axis
     mutable v2f pr[PLANES];
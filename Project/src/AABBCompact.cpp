@@ -0,0 +1,280 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  AABBCompact.cpp
+Purpose:  24 byte <min, max> box, and a SoA array of them for batch tests
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <std>
+#include <xmmintrin.h>  // SSE 4-wide float lanes
+#if defined(__AVX__)
+#include <immintrin.h>  // AVX 8-wide float lanes
+#endif
+
+// "./src/..."
+#include "AABB.h"         // Full box conversions
+#include "AABBCompact.h"  // Class declaration header
+#include "RayPacket.h"    // Ray slab test terms
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+//! Push the index of each set bit of a lane mask, from a block's 1st index
+static inline void Push(u4 mask, u4 first, std::vector<u4>& found)
+{
+  for (u4 k = 0u; mask; ++k, mask >>= 1u)
+  {
+    if (mask & 1u) { found.push_back(first + k); }
+  }
+
+} // end void Push(u4, u4, vector<u4>&)                                       */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::AABBCompact::AABBCompact(void)
+  : min(INf, INf, INf), max(-INf, -INf, -INf)
+{ } // end AABBCompact::AABBCompact(void)                                     */
+
+
+dp::AABBCompact::AABBCompact(const AABB& source)
+  : min(source.Min()), max(source.Max())
+{ } // end AABBCompact::AABBCompact(const AABB&)                              */
+
+
+dp::AABBSoA::AABBSoA(void) : count(0u)
+{ } // end AABBSoA::AABBSoA(void)                                             */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::AABB dp::AABBCompact::Expand(void) const
+{
+  return AABB(min, max);
+
+} // end AABB AABBCompact::Expand(void) const                                 */
+
+
+bool dp::AABBCompact::IsIn(const RaySlab& slab, f4* tNear) const
+{
+  return !IsEmpty() && slab.Hit(min, max, tNear);
+
+} // end bool AABBCompact::IsIn(const RaySlab&, f4*) const                    */
+
+
+u4 dp::AABBSoA::Add(const AABBCompact& box)
+{
+  if (!(count % BLOCK)) // Full (or none): open another padded block
+  {
+    for (u4 a = 0u; a < 3u; ++a)
+    {
+      min[a].resize(min[a].size() + BLOCK, INf);
+      max[a].resize(max[a].size() + BLOCK, -INf);
+    }
+  }
+  Set(count, box);
+  return count++;
+
+} // end u4 AABBSoA::Add(const AABBCompact&)                                  */
+
+
+dp::AABBSoA& dp::AABBSoA::Clear(void)
+{
+  for (u4 a = 0u; a < 3u; ++a)
+  {
+    min[a].clear();
+    max[a].clear();
+  }
+  count = 0u;
+  return *this;
+
+} // end AABBSoA& AABBSoA::Clear(void)                                        */
+
+
+dp::AABBCompact dp::AABBSoA::Get(u4 index) const
+{
+  return AABBCompact(v3f(min[0][index], min[1][index], min[2][index]),
+    v3f(max[0][index], max[1][index], max[2][index]));
+
+} // end AABBCompact AABBSoA::Get(u4) const                                   */
+
+
+u4 dp::AABBSoA::Hits(const RaySlab& slab, std::vector<u4>& found) const
+{
+  found.clear();
+  const f4* inv = slab.Inverses();
+  const f4* origin = slab.Origin();
+  u4 padded = static_cast<u4>(min[0].size());
+
+  // Empty / padding boxes (min past max) are rejected outright: their
+  // inverted slabs would otherwise clip nothing, and pass; NaN slab ends (an
+  // origin on a slab plane) skip that slab, as in RaySlab::Hit()
+#if defined(__AVX__)
+  __m256 in[3], at[3], far = _mm256_set1_ps(slab.Far());
+  for (u4 a = 0u; a < 3u; ++a)
+  {
+    in[a] = _mm256_set1_ps(inv[a]);
+    at[a] = _mm256_set1_ps(origin[a]);
+  }
+  for (u4 first = 0u; first < padded; first += 8u)
+  {
+    __m256 tNear = _mm256_setzero_ps(), tFar = far;
+    __m256 valid = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    for (u4 a = 0u; a < 3u; ++a)
+    {
+      __m256 low = _mm256_loadu_ps(&min[a][first]);
+      __m256 high = _mm256_loadu_ps(&max[a][first]);
+      __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(low, at[a]), in[a]);
+      __m256 t1 = _mm256_mul_ps(_mm256_sub_ps(high, at[a]), in[a]);
+      __m256 skip = _mm256_cmp_ps(t0, t1, _CMP_UNORD_Q); // On a slab plane
+      tNear = _mm256_max_ps(_mm256_or_ps(_mm256_min_ps(t0, t1), skip), tNear);
+      tFar = _mm256_min_ps(_mm256_or_ps(_mm256_max_ps(t0, t1), skip), tFar);
+      valid = _mm256_and_ps(valid, _mm256_cmp_ps(low, high, _CMP_LE_OQ));
+    }
+    __m256 hit = _mm256_and_ps(valid, _mm256_cmp_ps(tNear, tFar, _CMP_LE_OQ));
+    Push(static_cast<u4>(_mm256_movemask_ps(hit)), first, found);
+  }
+#else
+  __m128 in[3], at[3], far = _mm_set1_ps(slab.Far());
+  for (u4 a = 0u; a < 3u; ++a)
+  {
+    in[a] = _mm_set1_ps(inv[a]);
+    at[a] = _mm_set1_ps(origin[a]);
+  }
+  for (u4 first = 0u; first < padded; first += 4u)
+  {
+    __m128 tNear = _mm_setzero_ps(), tFar = far;
+    __m128 valid = _mm_cmpeq_ps(tNear, tNear); // All set
+    for (u4 a = 0u; a < 3u; ++a)
+    {
+      __m128 low = _mm_loadu_ps(&min[a][first]);
+      __m128 high = _mm_loadu_ps(&max[a][first]);
+      __m128 t0 = _mm_mul_ps(_mm_sub_ps(low, at[a]), in[a]);
+      __m128 t1 = _mm_mul_ps(_mm_sub_ps(high, at[a]), in[a]);
+      __m128 skip = _mm_cmpunord_ps(t0, t1); // On a slab plane: NaN end
+      tNear = _mm_max_ps(_mm_or_ps(_mm_min_ps(t0, t1), skip), tNear);
+      tFar = _mm_min_ps(_mm_or_ps(_mm_max_ps(t0, t1), skip), tFar);
+      valid = _mm_and_ps(valid, _mm_cmple_ps(low, high));
+    }
+    __m128 hit = _mm_and_ps(valid, _mm_cmple_ps(tNear, tFar));
+    Push(static_cast<u4>(_mm_movemask_ps(hit)), first, found);
+  }
+#endif
+  return static_cast<u4>(found.size());
+
+} // end u4 AABBSoA::Hits(const RaySlab&, vector<u4>&) const                  */
+
+
+u4 dp::AABBSoA::Overlaps(const AABBCompact& box, std::vector<u4>& found) const
+{
+  found.clear();
+  u4 padded = static_cast<u4>(min[0].size());
+
+  // Padding boxes (min INf, max -INf) fail every compare
+#if defined(__AVX__)
+  __m256 low[3], high[3];
+  for (u4 a = 0u; a < 3u; ++a)
+  {
+    low[a] = _mm256_set1_ps(box.Min()[static_cast<s1>(a)]);
+    high[a] = _mm256_set1_ps(box.Max()[static_cast<s1>(a)]);
+  }
+  for (u4 first = 0u; first < padded; first += 8u)
+  {
+    __m256 hit = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    for (u4 a = 0u; a < 3u; ++a)
+    {
+      __m256 bMin = _mm256_loadu_ps(&min[a][first]);
+      __m256 bMax = _mm256_loadu_ps(&max[a][first]);
+      hit = _mm256_and_ps(hit, _mm256_and_ps(
+        _mm256_cmp_ps(bMin, high[a], _CMP_LE_OQ),
+        _mm256_cmp_ps(low[a], bMax, _CMP_LE_OQ)));
+    }
+    Push(static_cast<u4>(_mm256_movemask_ps(hit)), first, found);
+  }
+#else
+  __m128 low[3], high[3];
+  for (u4 a = 0u; a < 3u; ++a)
+  {
+    low[a] = _mm_set1_ps(box.Min()[static_cast<s1>(a)]);
+    high[a] = _mm_set1_ps(box.Max()[static_cast<s1>(a)]);
+  }
+  for (u4 first = 0u; first < padded; first += 4u)
+  {
+    __m128 hit = _mm_cmpeq_ps(low[0], low[0]); // All set (unless NaN)
+    for (u4 a = 0u; a < 3u; ++a)
+    {
+      __m128 bMin = _mm_loadu_ps(&min[a][first]);
+      __m128 bMax = _mm_loadu_ps(&max[a][first]);
+      hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmple_ps(bMin, high[a]),
+        _mm_cmple_ps(low[a], bMax)));
+    }
+    Push(static_cast<u4>(_mm_movemask_ps(hit)), first, found);
+  }
+#endif
+  return static_cast<u4>(found.size());
+
+} // end u4 AABBSoA::Overlaps(const AABBCompact&, vector<u4>&) const          */
+
+
+dp::AABBSoA& dp::AABBSoA::Reserve(u4 capacity)
+{
+  u4 padded = (capacity + BLOCK - 1u) / BLOCK * BLOCK;
+  for (u4 a = 0u; a < 3u; ++a)
+  {
+    min[a].reserve(padded);
+    max[a].reserve(padded);
+  }
+  return *this;
+
+} // end AABBSoA& AABBSoA::Reserve(u4)                                        */
+
+
+dp::AABBSoA& dp::AABBSoA::Remove(u4 index)
+{
+  u4 last = --count;
+  for (u4 a = 0u; a < 3u; ++a)
+  {
+    min[a][index] = min[a][last];
+    max[a][index] = max[a][last];
+    min[a][last] = INf; // Padding again
+    max[a][last] = -INf;
+  }
+  if (!(count % BLOCK)) // Emptied a block: drop it, as Add() opens a new one
+  {
+    for (u4 a = 0u; a < 3u; ++a)
+    {
+      min[a].resize(count);
+      max[a].resize(count);
+    }
+  }
+  return *this;
+
+} // end AABBSoA& AABBSoA::Remove(u4)                                         */
+
+
+dp::AABBSoA& dp::AABBSoA::Set(u4 index, const AABBCompact& box)
+{
+  for (s1 a = 0; a < 3; ++a)
+  {
+    min[a][index] = box.Min()[a];
+    max[a][index] = box.Max()[a];
+  }
+  return *this;
+
+} // end AABBSoA& AABBSoA::Set(u4, const AABBCompact&)                        */
@@ -0,0 +1,449 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  AABBCompact.h
+Purpose:  24 byte <min, max> box, and a SoA array of them for batch tests
+Details:  AABB keeps an affine m4f footprint (with dirty flags in its spare
+  bits), 8 cached corners and projection ranges: 208 bytes, suited to boxes
+  drawn or tested a few at a time.  Hierarchy nodes and broadphase arrays
+  keep millions of boxes, tested far more often than drawn, so they want
+  only the extrema: AABBCompact is those 6 floats, converting to and from a
+  full AABB at the edges.
+
+  AABBSoA keeps boxes by component (all min x, then all min y, ...), padded
+  to 8 boxes with empty ones, so one query box or ray is tested against 4
+  (SSE) or 8 (AVX, where built) boxes per step.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <vector>       // Box components by axis, query result lists
+
+// "./src/..."
+#include "v3f.h"  // Box extrema members
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class AABB;     // Full box, with footprint matrix / cached corners
+  class RaySlab;  // Ray slab test terms
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! AABBCompact: box extrema only, for hierarchies and broadphase arrays
+  class AABBCompact
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create an empty box (min INf, max -INf), which Grow()s to any other
+    \brief
+      - create an empty box (min INf, max -INf), which Grow()s to any other
+    */
+    AABBCompact(void);
+
+
+    /** Create a box from its extrema
+    \brief
+      - create a box from its extrema
+    \param low
+      - lowest corner of the box
+    \param high
+      - highest corner of the box
+    */
+    inline AABBCompact(const v3f& low, const v3f& high) : min(low), max(high)
+    { } // end AABBCompact::AABBCompact(const v3f&, const v3f&)               */
+
+
+    /** Create a box from the extrema of a full AABB
+    \brief
+      - create a box from the extrema of a full AABB
+    \param source
+      - box whose extrema are to be copied
+    */
+    explicit AABBCompact(const AABB& source);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the surface area of the box (for SAH costs)
+    \brief
+      - get the surface area of the box (for SAH costs)
+    \return
+      - sum of the areas of the 6 sides, or 0 if empty
+    */
+    inline f4 Area(void) const
+    {
+      if (IsEmpty()) { return 0.0f; }
+      v3f d = max - min;
+      return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+    } // end f4 AABBCompact::Area(void) const                                 */
+
+
+    /** Get the center of the box
+    \brief
+      - get the center of the box
+    \return
+      - midpoint of the extrema
+    */
+    inline v3f Center(void) const
+    {
+      return (min + max) * AHALF;
+    } // end v3f AABBCompact::Center(void) const                              */
+
+
+    /** Get a full AABB of these extrema
+    \brief
+      - get a full AABB of these extrema
+    \return
+      - AABB spanning [Min(), Max()]
+    */
+    AABB Expand(void) const;
+
+
+    /** Get the size of the box along each axis
+    \brief
+      - get the size of the box along each axis
+    \return
+      - max - min
+    */
+    inline v3f Extent(void) const
+    { return max - min; } // end v3f AABBCompact::Extent(void) const          */
+
+
+    /** Grow the box to contain a point
+    \brief
+      - grow the box to contain a point
+    \param point
+      - world space coordinate to be contained
+    \return
+      - reference to the box for easier subsequent inline action
+    */
+    inline AABBCompact& Grow(const v3f& point)
+    {
+      min.Set(MinF(min.x, point.x), MinF(min.y, point.y), MinF(min.z, point.z));
+      max.Set(MaxF(max.x, point.x), MaxF(max.y, point.y), MaxF(max.z, point.z));
+      return *this;
+    } // end AABBCompact& AABBCompact::Grow(const v3f&)                       */
+
+
+    /** Grow the box to contain another box
+    \brief
+      - grow the box to contain another box
+    \param other
+      - box to be contained
+    \return
+      - reference to the box for easier subsequent inline action
+    */
+    inline AABBCompact& Grow(const AABBCompact& other)
+    {
+      min.Set(MinF(min.x, other.min.x), MinF(min.y, other.min.y),
+        MinF(min.z, other.min.z));
+      max.Set(MaxF(max.x, other.max.x), MaxF(max.y, other.max.y),
+        MaxF(max.z, other.max.z));
+      return *this;
+    } // end AABBCompact& AABBCompact::Grow(const AABBCompact&)               */
+
+
+    /** Check if the box contains nothing (any min past its max)
+    \brief
+      - check if the box contains nothing (any min past its max)
+    \return
+      - true if empty, as made by the default constructor
+    */
+    inline bool IsEmpty(void) const
+    {
+      return !(min.x <= max.x && min.y <= max.y && min.z <= max.z);
+    } // end bool AABBCompact::IsEmpty(void) const                            */
+
+
+    /** Check if another box overlaps this one (touching counts)
+    \brief
+      - check if another box overlaps this one (touching counts)
+    \param other
+      - box to be tested
+    \return
+      - true if the boxes share any point (never for an empty box)
+    */
+    inline bool IsIn(const AABBCompact& other) const
+    {
+      return min.x <= other.max.x && other.min.x <= max.x
+        && min.y <= other.max.y && other.min.y <= max.y
+        && min.z <= other.max.z && other.min.z <= max.z;
+    } // end bool AABBCompact::IsIn(const AABBCompact&) const                 */
+
+
+    /** Check if a ray passes through the box
+    \brief
+      - check if a ray passes through the box
+    \param slab
+      - slab test terms of the ray, over [0, its Far()]
+    \param tNear
+      - distance the box is entered at (0 if started in), to be set if given
+    \return
+      - true if the ray passes through the box (never for an empty box)
+    */
+    bool IsIn(const RaySlab& slab, f4* tNear = nullptr) const;
+
+
+    /** Check if a point is in the box (sides count)
+    \brief
+      - check if a point is in the box (sides count)
+    \param point
+      - world space coordinate to be tested
+    \return
+      - true if the point is within the extrema
+    */
+    inline bool IsIn(const v3f& point) const
+    { return point.IsIn(max, min); } // end bool IsIn(const v3f&) const       */
+
+
+    /** Access the highest corner of the box
+    \brief
+      - access the highest corner of the box
+    \return
+      - reference to the box maximum
+    */
+    inline const v3f& Max(void) const
+    { return max; } // end const v3f& AABBCompact::Max(void) const            */
+
+
+    /** Get the smallest box containing this and another box
+    \brief
+      - get the smallest box containing this and another box
+    \param other
+      - box to be merged with this one
+    \return
+      - union bounds of both boxes
+    */
+    inline AABBCompact Merge(const AABBCompact& other) const
+    {
+      return AABBCompact(*this).Grow(other);
+    } // end AABBCompact AABBCompact::Merge(const AABBCompact&) const         */
+
+
+    /** Access the lowest corner of the box
+    \brief
+      - access the lowest corner of the box
+    \return
+      - reference to the box minimum
+    */
+    inline const v3f& Min(void) const
+    { return min; } // end const v3f& AABBCompact::Min(void) const            */
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Lowest corner of the box
+    v3f min;
+
+    //! Highest corner of the box
+    v3f max;
+
+  }; // end AABBCompact class declaration
+
+  // Assurance that memory footprint is only the extrema, as intended
+  static_assert(sizeof(AABBCompact) == 24, "AABBCompact not packed");
+
+
+  //! AABBSoA: boxes by component, tested 4 / 8 at a time
+  class AABBSoA
+  {
+  public:
+
+    //! Boxes per padded block: the widest (AVX) lane count
+    static const u4 BLOCK = 8u;
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create an empty array of boxes
+    \brief
+      - create an empty array of boxes
+    */
+    AABBSoA(void);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Add a box at the end of the array
+    \brief
+      - add a box at the end of the array
+    \param box
+      - box to be added
+    \return
+      - index of the added box
+    */
+    u4 Add(const AABBCompact& box);
+
+
+    /** Remove every box
+    \brief
+      - remove every box
+    \return
+      - reference to the array for easier subsequent inline action
+    */
+    AABBSoA& Clear(void);
+
+
+    /** Get the number of boxes in the array
+    \brief
+      - get the number of boxes in the array
+    \return
+      - count of boxes added
+    */
+    inline u4 Count(void) const
+    { return count; } // end u4 AABBSoA::Count(void) const                    */
+
+
+    /** Get a box in the array
+    \brief
+      - get a box in the array
+    \param index
+      - index of the box, as given by Add()
+    \return
+      - copy of the box's extrema
+    */
+    AABBCompact Get(u4 index) const;
+
+
+    /** Find every box a ray passes through
+    \brief
+      - find every box a ray passes through
+    \param slab
+      - slab test terms of the ray, over [0, its Far()]
+    \param found
+      - indices of the boxes hit, in index order (cleared first)
+    \return
+      - number of boxes found
+    */
+    u4 Hits(const RaySlab& slab, std::vector<u4>& found) const;
+
+
+    /** Get the highest corners of every box along an axis (for batch tests)
+    \brief
+      - get the highest corners of every box along an axis (for batch tests)
+    \param axis
+      - axis of the corners [0, 3): x, y, z
+    \return
+      - Padded() values, by box index (padding: -INf)
+    */
+    inline const f4* Maxs(u1 axis) const
+    { return max[axis].data(); } // end const f4* AABBSoA::Maxs(u1) const     */
+
+
+    /** Get the lowest corners of every box along an axis (for batch tests)
+    \brief
+      - get the lowest corners of every box along an axis (for batch tests)
+    \param axis
+      - axis of the corners [0, 3): x, y, z
+    \return
+      - Padded() values, by box index (padding: INf)
+    */
+    inline const f4* Mins(u1 axis) const
+    { return min[axis].data(); } // end const f4* AABBSoA::Mins(u1) const     */
+
+
+    /** Find every box overlapping a query box (touching counts)
+    \brief
+      - find every box overlapping a query box (touching counts)
+    \param box
+      - query box
+    \param found
+      - indices of the boxes overlapped, in index order (cleared first)
+    \return
+      - number of boxes found
+    */
+    u4 Overlaps(const AABBCompact& box, std::vector<u4>& found) const;
+
+
+    /** Get the number of boxes padded to whole blocks (lanes of Mins / Maxs)
+    \brief
+      - get the number of boxes padded to whole blocks (lanes of Mins / Maxs)
+    \return
+      - count rounded up to a multiple of BLOCK
+    */
+    inline u4 Padded(void) const
+    { return static_cast<u4>(min[0].size()); } // end u4 AABBSoA::Padded      */
+
+
+    /** Reserve room for a number of boxes, to add them with no reallocation
+    \brief
+      - reserve room for a number of boxes, to add them with no reallocation
+    \param capacity
+      - number of boxes to hold room for
+    \return
+      - reference to the array for easier subsequent inline action
+    */
+    AABBSoA& Reserve(u4 capacity);
+
+
+    /** Remove a box, moving the last box into its place
+    \brief
+      - remove a box, moving the last box into its place
+    \details
+      - indices are not stable: the box that was last takes the given index
+      (as with a swap & pop of a list kept in step with the array)
+    \param index
+      - index of the box to remove, less than Count()
+    \return
+      - reference to the array for easier subsequent inline action
+    */
+    AABBSoA& Remove(u4 index);
+
+
+    /** Replace a box in the array (as its object moves)
+    \brief
+      - replace a box in the array (as its object moves)
+    \param index
+      - index of the box, as given by Add()
+    \param box
+      - new extrema of the box
+    \return
+      - reference to the array for easier subsequent inline action
+    */
+    AABBSoA& Set(u4 index, const AABBCompact& box);
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Lowest corner of each box, by axis (padded with INf to BLOCK boxes)
+    std::vector<f4> min[3];
+
+    //! Highest corner of each box, by axis (padded with -INf to BLOCK boxes)
+    std::vector<f4> max[3];
+
+    //! Number of boxes added
+    u4 count;
+
+  }; // end AABBSoA class declaration
+
+} // end dp namespace
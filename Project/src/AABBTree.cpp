@@ -0,0 +1,491 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  AABBTree.cpp
+Purpose:  Dynamic AABB tree: incremental scene hierarchy for moving objects
+Details:  nodes live in one pool by index, so growing it never leaves stale
+  links; freed nodes are chained through their parent link for reuse.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// "./src/..."
+#include "AABB.h"     // Object / query bounds, by Min() / Max() extrema
+#include "AABBTree.h" // Class declaration header
+#include "BSphere.h"  // Sphere center / radius of sphere queries
+#include "Frustum.h"  // Plane masks of frustum queries
+#include "Plane.h"    // Frustum plane normal / sum of frustum queries
+#include "Ray.h"      // Ray origin / direction of ray queries
+#include "RayPacket.h"// Ray slab test terms of ray queries
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+//! Flag on a frustum query stack entry: subtree already wholly inside
+static const u4 INSIDE = 0x80000000u;
+
+
+namespace
+{
+  //! Frustum walk stack entry: a node, and the planes still cutting it
+  struct Visit
+  {
+    u4 node;    //! Node to be tested
+    u1 planes;  //! Frustum planes still cutting the node's parent
+  };
+
+} // end anonymous namespace
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::AABBTree::AABBTree(f4 fat, f4 ahead) : root(u4_INVALID),
+  spare(u4_INVALID), used(0u), leaves(0u), rotations(0u), reinserts(0u),
+  refits(0u), margin(fat), predict(ahead)
+{ } // end AABBTree::AABBTree(f4, f4)                                         */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::AABBTree& dp::AABBTree::ClearStats(void)
+{
+  rotations = reinserts = refits = 0u;
+  return *this;
+
+} // end AABBTree& AABBTree::ClearStats(void)                                 */
+
+
+dp::AABB dp::AABBTree::FatBox(u4 proxy) const
+{
+  return AABB(node[proxy].min, node[proxy].max, AABB::Format::Extrema);
+
+} // end AABB AABBTree::FatBox(u4) const                                      */
+
+
+u4 dp::AABBTree::Insert(const AABB& box, u4 object)
+{
+  v3f fat(margin, margin, margin);
+  u4 leaf = Allocate();
+  node[leaf].min = box.Min() - fat;
+  node[leaf].max = box.Max() + fat;
+  node[leaf].object = object;
+  InsertLeaf(leaf);
+  ++leaves;
+  return leaf;
+
+} // end u4 AABBTree::Insert(const AABB&, u4)                                 */
+
+
+bool dp::AABBTree::Move(u4 proxy, const AABB& box, const v3f& displacement)
+{
+  if (!IsLeaf(proxy)) { return false; } // Stale or foreign handle
+  Node& leaf = node[proxy];
+  if (box.Min().IsIn(leaf.max, leaf.min) && box.Max().IsIn(leaf.max, leaf.min))
+  {
+    return false; // Still within its fat box: nothing to change
+  }
+
+  // Grow by the margin, then stretch toward where the object is headed
+  RemoveLeaf(proxy);
+  v3f fat(margin, margin, margin), ahead(displacement * predict);
+  leaf.min = box.Min() - fat;
+  leaf.max = box.Max() + fat;
+  for (s1 i = 0; i < 3; ++i)
+  {
+    if (ahead[i] < 0.0f) { leaf.min[i] += ahead[i]; }
+    else { leaf.max[i] += ahead[i]; }
+  }
+  InsertLeaf(proxy);
+  ++reinserts;
+  return true;
+
+} // end bool AABBTree::Move(u4, const AABB&, const v3f&)                     */
+
+
+u4 dp::AABBTree::Query(const AABB& box, std::vector<u4>& found) const
+{
+  found.clear();
+  if (root == u4_INVALID) { return 0u; }
+
+  const AABBCompact bounds(box);
+  std::vector<u4> stack(1u, root);
+  while (!stack.empty())
+  {
+    const Node& n = node[stack.back()];
+    stack.pop_back();
+    if (!n.Box().IsIn(bounds)) { continue; }
+    if (n.child[0] == u4_INVALID) { found.push_back(n.object); continue; }
+    stack.push_back(n.child[0]);
+    stack.push_back(n.child[1]);
+  }
+  return static_cast<u4>(found.size());
+
+} // end u4 AABBTree::Query(const AABB&, vector<u4>&) const                   */
+
+
+u4 dp::AABBTree::Query(const BSphere& ball, std::vector<u4>& found) const
+{
+  found.clear();
+  if (root == u4_INVALID) { return 0u; }
+
+  const v3f& c = ball.Center();
+  f4 rSq = ball.Radius() * ball.Radius();
+  std::vector<u4> stack(1u, root);
+  while (!stack.empty())
+  {
+    const Node& n = node[stack.back()];
+    stack.pop_back();
+
+    // Squared distance from the center to the nearest box point
+    f4 dSq = 0.0f;
+    for (s1 i = 0; i < 3; ++i)
+    {
+      f4 out = MaxF(MaxF(n.min[i] - c[i], c[i] - n.max[i]), 0.0f);
+      dSq += out * out;
+    }
+    if (rSq < dSq) { continue; }
+    if (n.child[0] == u4_INVALID) { found.push_back(n.object); continue; }
+    stack.push_back(n.child[0]);
+    stack.push_back(n.child[1]);
+  }
+  return static_cast<u4>(found.size());
+
+} // end u4 AABBTree::Query(const BSphere&, vector<u4>&) const                */
+
+
+u4 dp::AABBTree::Query(const Plane* planes, u4 count,
+  std::vector<u4>& found) const
+{
+  found.clear();
+  if (root == u4_INVALID) { return 0u; }
+
+  std::vector<u4> stack(1u, root);
+  while (!stack.empty())
+  {
+    u4 entry = stack.back();
+    const Node& n = node[entry & ~INSIDE];
+    stack.pop_back();
+
+    // Classify the box by its center's signed distance vs. its projected
+    // radius, per plane: ahead of one => culled, behind all => inside
+    if (!(entry & INSIDE))
+    {
+      v3f mid = (n.min + n.max) * AHALF, ext = (n.max - n.min) * AHALF;
+      bool culled = false, inside = true;
+      for (u4 p = 0; p < count && !culled; ++p)
+      {
+        const v3f& normal = planes[p].Normal();
+        f4 d = normal.Dot(mid) - planes[p].Sum();
+        f4 r = ext.Dot(normal.Abs());
+        culled = r < d;
+        inside = inside && d <= -r;
+      }
+      if (culled) { continue; }
+      if (inside) { entry |= INSIDE; }
+    }
+    if (n.child[0] == u4_INVALID) { found.push_back(n.object); continue; }
+    stack.push_back(n.child[0] | (entry & INSIDE));
+    stack.push_back(n.child[1] | (entry & INSIDE));
+  }
+  return static_cast<u4>(found.size());
+
+} // end u4 AABBTree::Query(const Plane*, u4, vector<u4>&) const              */
+
+
+u4 dp::AABBTree::Query(const Frustum& frustum, std::vector<u4>& found) const
+{
+  found.clear();
+  if (root == u4_INVALID) { return 0u; }
+
+  // Once no planes are left to test, the whole subtree is inside
+  std::vector<Visit> stack(1u, Visit{ root, Frustum::ALL });
+  while (!stack.empty())
+  {
+    Visit at = stack.back();
+    stack.pop_back();
+
+    const Node& n = node[at.node];
+    if (at.planes
+      && frustum.Classify(n.Box(), &at.planes) == Frustum::Side::Outside)
+    {
+      continue;
+    }
+    if (n.child[0] == u4_INVALID) { found.push_back(n.object); continue; }
+    stack.push_back(Visit{ n.child[0], at.planes });
+    stack.push_back(Visit{ n.child[1], at.planes });
+  }
+  return static_cast<u4>(found.size());
+
+} // end u4 AABBTree::Query(const Frustum&, vector<u4>&) const                */
+
+
+u4 dp::AABBTree::Query(const Ray& ray, std::vector<u4>& found, f4 tMax) const
+{
+  found.clear();
+  if (root == u4_INVALID) { return 0u; }
+
+  const RaySlab slab(ray, tMax);
+  std::vector<u4> stack(1u, root);
+  while (!stack.empty())
+  {
+    const Node& n = node[stack.back()];
+    stack.pop_back();
+    if (!n.Box().IsIn(slab)) { continue; }
+    if (n.child[0] == u4_INVALID) { found.push_back(n.object); continue; }
+    stack.push_back(n.child[0]);
+    stack.push_back(n.child[1]);
+  }
+  return static_cast<u4>(found.size());
+
+} // end u4 AABBTree::Query(const Ray&, vector<u4>&, f4) const                */
+
+
+dp::AABBTree& dp::AABBTree::Refit(u4 proxy, const AABB& box)
+{
+  if (!IsLeaf(proxy)) { return *this; } // Stale or foreign handle
+  v3f fat(margin, margin, margin);
+  node[proxy].min = box.Min() - fat;
+  node[proxy].max = box.Max() + fat;
+  Walk(node[proxy].parent);
+  ++refits;
+  return *this;
+
+} // end AABBTree& AABBTree::Refit(u4, const AABB&)                           */
+
+
+dp::AABBTree& dp::AABBTree::Remove(u4 proxy)
+{
+  if (!IsLeaf(proxy)) { return *this; } // Stale or already removed handle
+  RemoveLeaf(proxy);
+  Free(proxy);
+  --leaves;
+  return *this;
+
+} // end AABBTree& AABBTree::Remove(u4)                                       */
+
+
+dp::AABBTree::Stats dp::AABBTree::Statistics(void) const
+{
+  Stats stats{ used, leaves, 0u, rotations, reinserts, refits, 0.0f };
+  if (root == u4_INVALID) { return stats; }
+
+  stats.height = node[root].height;
+  f4 total = 0.0f;
+  for (const Node& n : node)
+  {
+    if (n.height != u4_INVALID && n.child[0] != u4_INVALID)
+    {
+      total += n.Box().Area();
+    }
+  }
+  f4 rootArea = node[root].Box().Area();
+  stats.cost = (0.0f < rootArea) ? total / rootArea : 0.0f;
+  return stats;
+
+} // end Stats AABBTree::Statistics(void) const                               */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+u4 dp::AABBTree::Allocate(void)
+{
+  u4 index = spare;
+  if (index == u4_INVALID)
+  {
+    index = static_cast<u4>(node.size());
+    node.push_back(Node());
+  }
+  else { spare = node[index].parent; }
+
+  Node& n = node[index];
+  n.parent = n.child[0] = n.child[1] = u4_INVALID;
+  n.height = 0u;
+  n.object = u4_INVALID;
+  ++used;
+  return index;
+
+} // end u4 AABBTree::Allocate(void)                                          */
+
+
+void dp::AABBTree::Fit(u4 index)
+{
+  Node& n = node[index];
+  const Node& a = node[n.child[0]];
+  const Node& b = node[n.child[1]];
+  n.min.Set(MinF(a.min.x, b.min.x), MinF(a.min.y, b.min.y),
+    MinF(a.min.z, b.min.z));
+  n.max.Set(MaxF(a.max.x, b.max.x), MaxF(a.max.y, b.max.y),
+    MaxF(a.max.z, b.max.z));
+  n.height = 1u + (a.height < b.height ? b.height : a.height);
+
+} // end void AABBTree::Fit(u4)                                               */
+
+
+void dp::AABBTree::Free(u4 index)
+{
+  node[index].parent = spare;
+  node[index].height = u4_INVALID; // Marks the node as not in use
+  spare = index;
+  --used;
+
+} // end void AABBTree::Free(u4)                                              */
+
+
+void dp::AABBTree::InsertLeaf(u4 leaf)
+{
+  if (root == u4_INVALID)
+  {
+    root = leaf;
+    node[leaf].parent = u4_INVALID;
+    return;
+  }
+
+  // Descend while pushing the leaf further down is cheaper than pairing it
+  // here: the new parent costs the combined area, and every node passed on
+  // the way down grows by (inherits) the leaf's added area
+  const AABBCompact added = node[leaf].Box();
+  u4 index = root;
+  while (node[index].child[0] != u4_INVALID)
+  {
+    const Node& n = node[index];
+    f4 combined = n.Box().Merge(added).Area();
+    f4 cost = 2.0f * combined;
+    f4 inherit = 2.0f * (combined - n.Box().Area());
+
+    f4 down[2];
+    for (u1 k = 0; k < 2; ++k)
+    {
+      const Node& c = node[n.child[k]];
+      down[k] = c.Box().Merge(added).Area() + inherit;
+      if (c.child[0] != u4_INVALID) { down[k] -= c.Box().Area(); }
+    }
+    if (cost < down[0] && cost < down[1]) { break; }
+    index = n.child[(down[1] < down[0]) ? 1 : 0];
+  }
+
+  // Pair the leaf with the chosen sibling under a new parent
+  u4 sibling = index;
+  u4 parent = Allocate(); // (May grow the pool: no Node& held across it)
+  u4 grand = node[sibling].parent;
+  node[parent].parent = grand;
+  node[parent].child[0] = sibling;
+  node[parent].child[1] = leaf;
+  node[sibling].parent = parent;
+  node[leaf].parent = parent;
+  if (grand == u4_INVALID) { root = parent; }
+  else
+  {
+    Node& g = node[grand];
+    g.child[(g.child[0] == sibling) ? 0 : 1] = parent;
+  }
+  Walk(parent);
+
+} // end void AABBTree::InsertLeaf(u4)                                        */
+
+
+bool dp::AABBTree::IsLeaf(u4 index) const
+{
+  // Freed nodes are marked by an invalid height, internal ones by children
+  return index < node.size() && node[index].height != u4_INVALID
+    && node[index].child[0] == u4_INVALID;
+
+} // end bool AABBTree::IsLeaf(u4) const                                      */
+
+
+void dp::AABBTree::RemoveLeaf(u4 leaf)
+{
+  if (leaf == root)
+  {
+    root = u4_INVALID;
+    return;
+  }
+
+  // Splice the sibling into the parent's place, then drop the parent
+  u4 parent = node[leaf].parent;
+  u4 grand = node[parent].parent;
+  const Node& p = node[parent];
+  u4 sibling = p.child[(p.child[0] == leaf) ? 1 : 0];
+  node[sibling].parent = grand;
+  Free(parent);
+  if (grand == u4_INVALID) { root = sibling; }
+  else
+  {
+    Node& g = node[grand];
+    g.child[(g.child[0] == parent) ? 0 : 1] = sibling;
+    Walk(grand);
+  }
+
+} // end void AABBTree::RemoveLeaf(u4)                                        */
+
+
+void dp::AABBTree::Rotate(u4 index)
+{
+  // Of A's children B and C, try swapping B with either child of C, or C
+  // with either child of B: A's box is unchanged either way, so the only
+  // change to the tree's cost is the new area of the grandparent (C or B)
+  Node& a = node[index];
+  if (a.child[0] == u4_INVALID) { return; }
+
+  f4 best = 0.0f;
+  u4 side = 0u, pick = 0u; // Child of A to swap; child of its sibling to take
+  for (u1 s = 0; s < 2; ++s)
+  {
+    const Node& x = node[a.child[s]];     // Child moved down
+    const Node& y = node[a.child[1 - s]]; // Sibling that takes it in
+    if (y.child[0] == u4_INVALID) { continue; }
+    f4 yArea = y.Box().Area();
+    for (u1 k = 0; k < 2; ++k)
+    {
+      const Node& kept = node[y.child[1 - k]]; // y's child left beside x
+      f4 delta = x.Box().Merge(kept.Box()).Area() - yArea;
+      if (delta < best)
+      {
+        best = delta;
+        side = s + 1u;
+        pick = k;
+      }
+    }
+  }
+  if (!side) { return; }
+
+  // Swap: x drops into y's child slot, y's child rises into x's slot
+  --side;
+  u4 x = a.child[side], y = a.child[1 - side];
+  u4 z = node[y].child[pick];
+  a.child[side] = z;
+  node[z].parent = index;
+  node[y].child[pick] = x;
+  node[x].parent = y;
+  Fit(y);
+  Fit(index);
+  ++rotations;
+
+} // end void AABBTree::Rotate(u4)                                            */
+
+
+void dp::AABBTree::Walk(u4 index)
+{
+  while (index != u4_INVALID)
+  {
+    Fit(index);
+    Rotate(index);
+    index = node[index].parent;
+  }
+
+} // end void AABBTree::Walk(u4)                                              */
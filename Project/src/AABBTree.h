@@ -0,0 +1,346 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  AABBTree.h
+Purpose:  Dynamic AABB tree: incremental scene hierarchy for moving objects
+Details:  leaves hold each object's world box fattened by a margin (and
+  stretched along its predicted displacement), so small motions stay inside
+  the fat box and need no tree change at all.  An object leaving its fat box
+  is either reinserted, or refit in place (its leaf box reset and ancestors
+  re-bound upward), whichever the caller picks.
+
+  Inserts descend toward the sibling adding the least surface area (SAH).
+  Every node on the way back up from an insert / remove / refit then tries
+  the 4 rotations swapping a grandchild with its uncle, taking whichever most
+  lowers the changed node's surface area: the tree's SAH cost only ever
+  drops, so it stays healthy under continuous motion without full rebuilds.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <vector>       // Node pool / query result lists
+
+// "./src/..."
+#include "AABBCompact.h"  // Node box area / overlap / ray tests
+#include "v3f.h"          // Node box extrema members
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class AABB;    // World space bounds of each object / queried region
+  class BSphere; // Queried spherical region
+  class Frustum; // Queried view volume
+  class Plane;   // Bounding planes of a queried convex region
+  class Ray;     // Queried line of sight
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! Dynamic AABB tree over fat object boxes, kept low cost by rotations
+  class AABBTree
+  {
+  public:
+
+    //! Tree health figures, for per frame monitoring
+    struct Stats
+    {
+      u4 nodes;     //! Nodes in use (leaves & internal)
+      u4 leaves;    //! Objects in the tree
+      u4 height;    //! Longest root to leaf edge count
+      u4 rotations; //! Rotations made since the last ClearStats()
+      u4 reinserts; //! Leaves reinserted by Move() since the last ClearStats()
+      u4 refits;    //! Leaves refit by Refit() since the last ClearStats()
+      f4 cost;      //! SAH cost: internal node areas summed, over root's area
+    };
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create an empty tree, fattening leaves by the given margins
+    \brief
+      - create an empty tree, fattening leaves by the given margins
+    \param margin
+      - world distance each leaf box is grown by on every side
+    \param predict
+      - multiple of a moving object's displacement to stretch its leaf by
+    */
+    AABBTree(f4 margin = 0.1f, f4 predict = 2.0f);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Reset the per frame rotation / reinsert / refit counts
+    \brief
+      - reset the per frame rotation / reinsert / refit counts
+    \return
+      - reference to the tree for easier subsequent inline action
+    */
+    AABBTree& ClearStats(void);
+
+
+    /** Get the fat box of a leaf, as the tree bounds its object
+    \brief
+      - get the fat box of a leaf, as the tree bounds its object
+    \param proxy
+      - leaf handle, as returned by Insert()
+    \return
+      - fattened world space bounds of the leaf's object
+    */
+    AABB FatBox(u4 proxy) const;
+
+
+    /** Add an object to the tree by its world space bounds
+    \brief
+      - add an object to the tree by its world space bounds
+    \param box
+      - world space bounds of the object (fattened by the tree's margin)
+    \param object
+      - caller's identifier of the object, as listed by queries
+    \return
+      - leaf handle (proxy) for later Move() / Refit() / Remove() calls
+    */
+    u4 Insert(const AABB& box, u4 object);
+
+
+    /** Update an object's bounds, reinserting its leaf if they left its box
+    \brief
+      - update an object's bounds, reinserting its leaf if they left its box
+    \param proxy
+      - leaf handle, as returned by Insert()
+    \param box
+      - new world space bounds of the object
+    \param displacement
+      - object's motion since the last update, to stretch its new leaf along
+    \return
+      - true if the leaf was reinserted (its fat box changed); false too for
+      a handle that is out of range or already removed
+    */
+    bool Move(u4 proxy, const AABB& box, const v3f& displacement = v3f());
+
+
+    /** Get the caller's object identifier held by a leaf
+    \brief
+      - get the caller's object identifier held by a leaf
+    \param proxy
+      - leaf handle, as returned by Insert()
+    \return
+      - object identifier given to Insert()
+    */
+    inline u4 Object(u4 proxy) const
+    { return node[proxy].object; } // end u4 AABBTree::Object(u4) const       */
+
+
+    /** Get objects whose fat boxes overlap a box
+    \brief
+      - get objects whose fat boxes overlap a box
+    \param box
+      - world space region to be queried
+    \param found
+      - list to be filled (after being cleared) with object identifiers
+    \return
+      - count of objects found
+    */
+    u4 Query(const AABB& box, std::vector<u4>& found) const;
+
+
+    /** Get objects whose fat boxes overlap a sphere
+    \brief
+      - get objects whose fat boxes overlap a sphere
+    \param ball
+      - world space region to be queried
+    \param found
+      - list to be filled (after being cleared) with object identifiers
+    \return
+      - count of objects found
+    */
+    u4 Query(const BSphere& ball, std::vector<u4>& found) const;
+
+
+    /** Get objects whose fat boxes are at least partly within a frustum
+    \brief
+      - get objects whose fat boxes are at least partly within a frustum
+    \details
+      - planes face outward, as a Frustum's: a box wholly in front of any one
+      (n.p > sum at every corner) is culled with its subtree; subtrees wholly
+      behind all planes are listed with no further tests
+    \param planes
+      - outward bounding planes of the frustum (or any convex region)
+    \param count
+      - number of planes given (6 for a view frustum)
+    \param found
+      - list to be filled (after being cleared) with object identifiers
+    \return
+      - count of objects found
+    */
+    u4 Query(const Plane* planes, u4 count, std::vector<u4>& found) const;
+
+
+    /** Get objects whose fat boxes are at least partly within a view volume
+    \brief
+      - get objects whose fat boxes are at least partly within a view volume
+    \details
+      - each node passes its children the mask of planes still cutting it,
+      so planes it is wholly behind are not tested again below it
+    \param frustum
+      - world space view volume to be queried
+    \param found
+      - list to be filled (after being cleared) with object identifiers
+    \return
+      - count of objects found
+    */
+    u4 Query(const Frustum& frustum, std::vector<u4>& found) const;
+
+
+    /** Get objects whose fat boxes a ray passes through
+    \brief
+      - get objects whose fat boxes a ray passes through
+    \param ray
+      - world space ray to be cast
+    \param found
+      - list to be filled (after being cleared) with object identifiers
+    \param tMax
+      - farthest distance along the ray to be queried
+    \return
+      - count of objects found
+    */
+    u4 Query(const Ray& ray, std::vector<u4>& found, f4 tMax = INf) const;
+
+
+    /** Update an object's bounds by refitting its leaf & ancestors in place
+    \brief
+      - update an object's bounds by refitting its leaf & ancestors in place
+    \details
+      - cheaper than reinsertion for small, coherent motion; ancestor
+      rotations slow the cost creep as objects drift from their insertion
+      spots, but objects travelling far are better off Move()d
+    \param proxy
+      - leaf handle, as returned by Insert()
+    \param box
+      - new world space bounds of the object
+    \return
+      - reference to the tree for easier subsequent inline action
+    */
+    AABBTree& Refit(u4 proxy, const AABB& box);
+
+
+    /** Remove an object's leaf from the tree
+    \brief
+      - remove an object's leaf from the tree
+    \param proxy
+      - leaf handle, as returned by Insert(); ignored if already removed
+    \return
+      - reference to the tree for easier subsequent inline action
+    */
+    AABBTree& Remove(u4 proxy);
+
+
+    /** Get tree health figures: size, height, cost and per frame changes
+    \brief
+      - get tree health figures: size, height, cost and per frame changes
+    \return
+      - current statistics (cost takes a walk over all internal nodes)
+    */
+    Stats Statistics(void) const;
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                           Private Classes                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Tree node: a leaf (no children) or internal node (2 children)
+    struct Node
+    {
+      v3f min;      //! Lowest corner of the (fat, if a leaf) box
+      v3f max;      //! Highest corner of the (fat, if a leaf) box
+      u4 parent;    //! Parent node, or next free node when not in use
+      u4 child[2];  //! Child nodes, both u4_INVALID for leaves
+      u4 height;    //! Edges down to the deepest leaf below (leaves: 0)
+      u4 object;    //! Caller's identifier of a leaf's object
+
+      //! Get the node's box, for its area / overlap / ray tests
+      inline AABBCompact Box(void) const { return AABBCompact(min, max); }
+    };
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                           Private Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Take a node from the free list (growing the pool if none are free)
+    u4 Allocate(void);
+
+    //! Re-bound a node & its height from its children
+    void Fit(u4 index);
+
+    //! Return a node to the free list
+    void Free(u4 index);
+
+    //! Link a leaf in beside the sibling adding the least area
+    void InsertLeaf(u4 leaf);
+
+    //! Check a handle names a leaf in use (in range, not freed, childless)
+    bool IsLeaf(u4 index) const;
+
+    //! Unlink a leaf, splicing its sibling into its parent's place
+    void RemoveLeaf(u4 leaf);
+
+    //! Swap a grandchild with its uncle if that lowers the tree's area
+    void Rotate(u4 index);
+
+    //! Re-bound & rotate each node from the given one up to the root
+    void Walk(u4 index);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Node pool, by index (in use and free nodes alike)
+    std::vector<Node> node;
+
+    //! Root node, or u4_INVALID if the tree is empty
+    u4 root;
+
+    //! Head of the free node list, or u4_INVALID if none are free
+    u4 spare;
+
+    //! Nodes in use
+    u4 used;
+
+    //! Leaves in use
+    u4 leaves;
+
+    //! Rotations made since the last ClearStats()
+    u4 rotations;
+
+    //! Leaves reinserted since the last ClearStats()
+    u4 reinserts;
+
+    //! Leaves refit since the last ClearStats()
+    u4 refits;
+
+    //! World distance each leaf box is grown by on every side
+    f4 margin;
+
+    //! Multiple of a moving object's displacement to stretch its leaf by
+    f4 predict;
+
+  }; // end AABBTree class declaration
+
+} // end dp namespace
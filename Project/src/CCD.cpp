@@ -0,0 +1,264 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  CCD.cpp
+Purpose:  Continuous collision detection: time of impact for moving volumes
+Details:  every volume type is reduced to one moving shape record (sphere, or
+  box of center / unit axes / half-extents), so a single advancement loop
+  and distance routine serve every pair of volume types.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// "./src/..."
+#include "AABB.h"     // Axis aligned box: <mid, half-extent> in model space
+#include "BSphere.h"  // Bounding sphere: <center, radius> in model space
+#include "CCD.h"      // Function declaration header
+#include "m3f.h"      // Oriented box basis of local axes
+#include "m4f.h"      // Start / end placements and their blend
+#include "OBB.h"      // Oriented box: <center, basis, extent> in model space
+#include "v3f.h"      // World space centers / axes / distance vectors
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace
+{
+  //! A volume placed in world space at one instant of its motion
+  struct Placed
+  {
+    dp::v3f c;    //! World space center
+    dp::v3f u[3]; //! World space unit axes (boxes only)
+    dp::v3f e;    //! Half-extents along each unit axis (boxes only)
+    f4 r;         //! Radius (spheres), or negative for boxes
+  };
+
+  //! A model space volume moving by a linearly blended start / end placement
+  struct Mover
+  {
+    //! Kinds of volume, deciding how the placed shape is re-bound
+    enum class Kind { Ball, Aligned, Oriented };
+
+    Kind kind;        //! How the volume is placed at each instant
+    dp::m4f start;    //! Placement at t = 0
+    dp::m4f delta;    //! Change in placement by t = 1: M(t) = start + t*delta
+    dp::v3f c;        //! Model space center
+    dp::m3f basis;    //! Model space unit axes (identity unless Oriented)
+    dp::v3f e;        //! Model space half-extents (boxes)
+    f4 r;             //! Model space radius (Ball), or bounding radius (boxes)
+    f4 speed;         //! Bound on the velocity of any point of the volume
+
+    //! Set placement blend & velocity bound for a model space center / radius
+    Mover(Kind k, const dp::m4f& s, const dp::m4f& f, const dp::v3f& center,
+      f4 radius) : kind(k), start(s), delta(f - s), c(center), r(radius)
+    {
+      // Point p moves at (delta * p): center velocity plus linear part's
+      // norm (Frobenius >= spectral) times the farthest point from center
+      f4 linSq = delta.col[0].XYZ().LengthSquared()
+        + delta.col[1].XYZ().LengthSquared()
+        + delta.col[2].XYZ().LengthSquared();
+      speed = delta.PProd(c).Length() + SqrtF(linSq) * r;
+    }
+
+    //! Get the volume placed in world space at time t
+    Placed At(f4 t) const
+    {
+      dp::m4f M = start + delta * t;
+      Placed p;
+      p.c = M.PProd(c);
+      if (kind == Kind::Ball) // Largest axis scale keeps the ball bounding
+      {
+        p.r = r * MaxF(MaxF(M.col[0].XYZ().Length(),
+          M.col[1].XYZ().Length()), M.col[2].XYZ().Length());
+        return p;
+      }
+      p.r = -1.0f;
+      if (kind == Kind::Aligned) // World AABB of the rotated box
+      {
+        p.u[0] = dp::X_HAT; p.u[1] = dp::Y_HAT; p.u[2] = dp::Z_HAT;
+        p.e = M.col[0].XYZ().Abs() * e.x + M.col[1].XYZ().Abs() * e.y
+          + M.col[2].XYZ().Abs() * e.z;
+        return p;
+      }
+      for (s1 i = 0; i < 3; ++i) // Rotated (and scaled) basis of the OBB
+      {
+        dp::v3f w = M.VProd(basis[i]);
+        f4 len = w.Length();
+        p.u[i] = (len > _INf) ? w / len : w;
+        p.e[i] = e[i] * len;
+      }
+      return p;
+    }
+  };
+
+} // end anonymous namespace
+
+
+//! Get distance between a point and a placed box (0 inside)
+static f4 PointBoxDist(const dp::v3f& point, const Placed& box)
+{
+  dp::v3f d = DistV3F(box.c, point);
+  return SqrtF(dp::BoxDistSq(dp::v3f(d.Dot(box.u[0]), d.Dot(box.u[1]),
+    d.Dot(box.u[2])), box.e));
+
+} // end f4 PointBoxDist(const v3f&, const Placed&)                           */
+
+
+//! Get gap between placed boxes' projections on a unit axis (< 0 overlaps)
+static f4 AxisGap(const dp::v3f& axis, const dp::v3f& d, const Placed& a,
+  const Placed& b)
+{
+  return AbsF(axis.Dot(d)) - dp::BoxReach(a.u, a.e, axis)
+    - dp::BoxReach(b.u, b.e, axis);
+
+} // end f4 AxisGap(const v3f&, const v3f&, const Placed&, const Placed&)     */
+
+
+//! Get lower bound of distance between 2 placed volumes (<= 0 touching)
+static f4 Distance(const Placed& a, const Placed& b)
+{
+  if (0.0f <= a.r && 0.0f <= b.r) { return Dist(a.c, b.c) - a.r - b.r; }
+  if (0.0f <= a.r) { return PointBoxDist(a.c, b) - a.r; }
+  if (0.0f <= b.r) { return PointBoxDist(b.c, a) - b.r; }
+
+  // Box / box: widest gap over the 15 separating axes is a distance bound
+  dp::v3f d = DistV3F(a.c, b.c);
+  f4 gap = -INf;
+  for (s1 i = 0; i < 3; ++i)
+  {
+    gap = MaxF(gap, AxisGap(a.u[i], d, a, b));
+    gap = MaxF(gap, AxisGap(b.u[i], d, a, b));
+    for (s1 j = 0; j < 3; ++j)
+    {
+      dp::v3f n = a.u[i].Cross(b.u[j]);
+      f4 len = n.Length();
+      if (len > _INf) { gap = MaxF(gap, AxisGap(n / len, d, a, b)); }
+    }
+  }
+  return gap;
+
+} // end f4 Distance(const Placed&, const Placed&)                            */
+
+
+//! Run conservative advancement on a moving pair: shared by all volume pairs
+static bool Advance(const Mover& a, const Mover& b, f4* tImpact,
+  f4 tolerance, u4 iterations)
+{
+  f4 speed = a.speed + b.speed; // Fastest the volumes can close on each other
+  f4 t = 0.0f;
+  bool touching = false;
+  for (u4 i = 0; i < iterations; ++i)
+  {
+    f4 d = Distance(a.At(t), b.At(t));
+    if (d <= tolerance) { touching = true; break; } // Close enough: at t
+    if (speed <= _INf) { t = INf; break; } // No relative motion: never closer
+    t += d / speed; // Safe: can't close that distance any sooner
+    if (1.0f < t) { t = INf; break; } // Ran out of frame first
+  } // (Out of iterations: t is only the last safe time, not a contact)
+  if (tImpact) { *tImpact = t; }
+  return touching;
+
+} // end bool Advance(const Mover&, const Mover&, f4*, f4, u4)                */
+
+
+//! Moving record of a model space bounding sphere
+static Mover Moving(const dp::BSphere& v, const dp::m4f& s, const dp::m4f& f)
+{
+  return Mover(Mover::Kind::Ball, s, f, v.Center(), v.Radius());
+
+} // end Mover Moving(const BSphere&, const m4f&, const m4f&)                 */
+
+
+//! Moving record of a model space axis aligned box
+static Mover Moving(const dp::AABB& v, const dp::m4f& s, const dp::m4f& f)
+{
+  Mover m(Mover::Kind::Aligned, s, f, v.Mid(), v.HalfExt().Length());
+  m.e = v.HalfExt();
+  return m;
+
+} // end Mover Moving(const AABB&, const m4f&, const m4f&)                    */
+
+
+//! Moving record of a model space oriented box
+static Mover Moving(const dp::OBB& v, const dp::m4f& s, const dp::m4f& f)
+{
+  Mover m(Mover::Kind::Oriented, s, f, v.Center(), v.HalfExt().Length());
+  m.basis = v.Basis();
+  m.e = v.HalfExt();
+  return m;
+
+} // end Mover Moving(const OBB&, const m4f&, const m4f&)                     */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Helper Functions                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+bool dp::TimeOfImpact(const BSphere& a, const m4f& aStart, const m4f& aEnd,
+  const BSphere& b, const m4f& bStart, const m4f& bEnd, f4* tImpact,
+  f4 tolerance, u4 iterations)
+{
+  return Advance(Moving(a, aStart, aEnd), Moving(b, bStart, bEnd), tImpact,
+    tolerance, iterations);
+
+} // end bool TimeOfImpact(const BSphere&, ..., const BSphere&, ...)          */
+
+
+bool dp::TimeOfImpact(const BSphere& a, const m4f& aStart, const m4f& aEnd,
+  const AABB& b, const m4f& bStart, const m4f& bEnd, f4* tImpact,
+  f4 tolerance, u4 iterations)
+{
+  return Advance(Moving(a, aStart, aEnd), Moving(b, bStart, bEnd), tImpact,
+    tolerance, iterations);
+
+} // end bool TimeOfImpact(const BSphere&, ..., const AABB&, ...)             */
+
+
+bool dp::TimeOfImpact(const BSphere& a, const m4f& aStart, const m4f& aEnd,
+  const OBB& b, const m4f& bStart, const m4f& bEnd, f4* tImpact,
+  f4 tolerance, u4 iterations)
+{
+  return Advance(Moving(a, aStart, aEnd), Moving(b, bStart, bEnd), tImpact,
+    tolerance, iterations);
+
+} // end bool TimeOfImpact(const BSphere&, ..., const OBB&, ...)              */
+
+
+bool dp::TimeOfImpact(const AABB& a, const m4f& aStart, const m4f& aEnd,
+  const AABB& b, const m4f& bStart, const m4f& bEnd, f4* tImpact,
+  f4 tolerance, u4 iterations)
+{
+  return Advance(Moving(a, aStart, aEnd), Moving(b, bStart, bEnd), tImpact,
+    tolerance, iterations);
+
+} // end bool TimeOfImpact(const AABB&, ..., const AABB&, ...)                */
+
+
+bool dp::TimeOfImpact(const AABB& a, const m4f& aStart, const m4f& aEnd,
+  const OBB& b, const m4f& bStart, const m4f& bEnd, f4* tImpact,
+  f4 tolerance, u4 iterations)
+{
+  return Advance(Moving(a, aStart, aEnd), Moving(b, bStart, bEnd), tImpact,
+    tolerance, iterations);
+
+} // end bool TimeOfImpact(const AABB&, ..., const OBB&, ...)                 */
+
+
+bool dp::TimeOfImpact(const OBB& a, const m4f& aStart, const m4f& aEnd,
+  const OBB& b, const m4f& bStart, const m4f& bEnd, f4* tImpact,
+  f4 tolerance, u4 iterations)
+{
+  return Advance(Moving(a, aStart, aEnd), Moving(b, bStart, bEnd), tImpact,
+    tolerance, iterations);
+
+} // end bool TimeOfImpact(const OBB&, ..., const OBB&, ...)                  */
@@ -0,0 +1,161 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  CCD.h
+Purpose:  Continuous collision detection: time of impact for moving volumes
+Details:  Bounding volumes are given in model space, each placed by a start and
+  end m4f over a frame (t = 0 to t = 1).  In between, placements are blended
+  linearly (M(t) = M0 + t * (M1 - M0)), so every model point travels on a
+  straight line at a constant velocity of (M1 - M0) * point.  That gives a
+  fixed bound on how fast any 2 volume points can approach each other: the
+  velocity at the volume center plus the blended linear part's (Frobenius)
+  norm times the volume's bounding radius, for each of the 2 volumes.
+
+  Conservative advancement then steps t forward by (distance / that bound)
+  until the distance falls under the tolerance (contact) or t passes 1 (no
+  contact): the step can never skip over a contact, so fast objects no longer
+  tunnel through each other, without sub-stepping the whole simulation.
+
+  Distances come from the volumes placed at t: exact for sphere / sphere and
+  sphere / box, and the widest separating axis gap for box / box (any SAT
+  axis gap is a lower bound of the true distance, which is all CA needs).
+  A placed AABB is re-bound as the world AABB of its rotated box, matching
+  what AABB(Mesh, m4f, ...) would produce; an OBB keeps its rotated basis.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// "./src/..."
+#include "TypeErrata.h" // Project type aliases for scalar arguments / results
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class AABB;    // Bounding box with <min, max>, placed per start / end m4f
+  class BSphere; // Bounding sphere <center, radius>, placed per start / end m4f
+  class OBB;     // Bounding box with local basis, placed per start / end m4f
+  class m4f;     // Start / end placement of a volume from model to world space
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                           Public Class Constants                         */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! Default world distance treated as contact by conservative advancement
+  constexpr f4 CCD_TOLERANCE = 0.001f;
+
+  //! Default cap on conservative advancement steps before giving up
+  constexpr u4 CCD_ITERATIONS = 64u;
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                      Helper Function Declarations                        */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  /** Get the earliest time 2 moving bounding spheres come into contact
+  \brief
+    - get the earliest time 2 moving bounding spheres come into contact
+  \details
+    - volumes are in model space, placed by start & end transforms; should
+    advancement run out of iterations first, no contact is reported, but the
+    last safe time reached is still set (a finite tImpact with false
+    returned: not converged, ie to sub-step from)
+  \param a
+    - first volume, in its model space
+  \param aStart
+    - placement of the first volume at t = 0
+  \param aEnd
+    - placement of the first volume at t = 1
+  \param b
+    - second volume, in its model space
+  \param bStart
+    - placement of the second volume at t = 0
+  \param bEnd
+    - placement of the second volume at t = 1
+  \param tImpact
+    - [0, 1] time of first contact (or last safe time, if not converged),
+    to be set if given (INf if the volumes never touch)
+  \param tolerance
+    - world distance at which volumes are treated as touching
+  \param iterations
+    - maximum conservative advancement steps to take
+  \return
+    - true if the volumes were found to touch at some t in [0, 1]
+  */
+  bool TimeOfImpact(const BSphere& a, const m4f& aStart, const m4f& aEnd,
+    const BSphere& b, const m4f& bStart, const m4f& bEnd,
+    f4* tImpact = nullptr, f4 tolerance = CCD_TOLERANCE,
+    u4 iterations = CCD_ITERATIONS);
+
+
+  /** Get the earliest time a moving sphere and a moving AABB come into contact
+  \brief
+    - get the earliest time a moving sphere and a moving AABB come into contact
+  \details
+    - see TimeOfImpact(const BSphere&, ...) for details on parameters / result
+  */
+  bool TimeOfImpact(const BSphere& a, const m4f& aStart, const m4f& aEnd,
+    const AABB& b, const m4f& bStart, const m4f& bEnd,
+    f4* tImpact = nullptr, f4 tolerance = CCD_TOLERANCE,
+    u4 iterations = CCD_ITERATIONS);
+
+
+  /** Get the earliest time a moving sphere and a moving OBB come into contact
+  \brief
+    - get the earliest time a moving sphere and a moving OBB come into contact
+  \details
+    - see TimeOfImpact(const BSphere&, ...) for details on parameters / result
+  */
+  bool TimeOfImpact(const BSphere& a, const m4f& aStart, const m4f& aEnd,
+    const OBB& b, const m4f& bStart, const m4f& bEnd,
+    f4* tImpact = nullptr, f4 tolerance = CCD_TOLERANCE,
+    u4 iterations = CCD_ITERATIONS);
+
+
+  /** Get the earliest time 2 moving axis aligned boxes come into contact
+  \brief
+    - get the earliest time 2 moving axis aligned boxes come into contact
+  \details
+    - see TimeOfImpact(const BSphere&, ...) for details on parameters / result
+  */
+  bool TimeOfImpact(const AABB& a, const m4f& aStart, const m4f& aEnd,
+    const AABB& b, const m4f& bStart, const m4f& bEnd,
+    f4* tImpact = nullptr, f4 tolerance = CCD_TOLERANCE,
+    u4 iterations = CCD_ITERATIONS);
+
+
+  /** Get the earliest time a moving AABB and a moving OBB come into contact
+  \brief
+    - get the earliest time a moving AABB and a moving OBB come into contact
+  \details
+    - see TimeOfImpact(const BSphere&, ...) for details on parameters / result
+  */
+  bool TimeOfImpact(const AABB& a, const m4f& aStart, const m4f& aEnd,
+    const OBB& b, const m4f& bStart, const m4f& bEnd,
+    f4* tImpact = nullptr, f4 tolerance = CCD_TOLERANCE,
+    u4 iterations = CCD_ITERATIONS);
+
+
+  /** Get the earliest time 2 moving oriented boxes come into contact
+  \brief
+    - get the earliest time 2 moving oriented boxes come into contact
+  \details
+    - see TimeOfImpact(const BSphere&, ...) for details on parameters / result
+  */
+  bool TimeOfImpact(const OBB& a, const m4f& aStart, const m4f& aEnd,
+    const OBB& b, const m4f& bStart, const m4f& bEnd,
+    f4* tImpact = nullptr, f4 tolerance = CCD_TOLERANCE,
+    u4 iterations = CCD_ITERATIONS);
+
+} // end dp namespace
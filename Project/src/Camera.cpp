@@ -19,6 +19,7 @@ written consent of DigiPen Institute of Technology is prohibited.
 // "./src/..."
 #include "Camera.h" // Associated class declaration header
 #include "Log.h"    // Output error / warning message / logging
+#include "m3f.h"    // Aimed basis to orientation quaternion conversion
 
 
 const dp::ang MAX_ANG(90.0f, dp::arc::degrees);
@@ -34,6 +35,7 @@ const dp::m4f dummyPersp(1.357995f,      0.0f,       0.0f,     0.0f,
 dp::Camera::Camera(const v3f& eye, const v3f& look, const v3f& up, ang FoV,
   v2f dimens, f4 near, f4 far)
 {
+  dirtyFrustum = true;
   MoveTo(eye).Aim(look, up).RenderRes(dimens).ViewAngle(FoV).Clip(near, far);
 
 } // Camera(const v3f&, const v3f&, const v3f&, ang, v2f, f4, f4)             */
@@ -74,7 +76,7 @@ dp::Camera& dp::Camera::Aim(v3f look, v3f up)
   // Update recalculation needed states
   dirty = true;
   dirtyRot = true;
-  dirtyLocals = true;
+  orient = q4f(m3f(localX, localY, localZ));
   dirtyView = true;
   return *this;
 
@@ -235,8 +237,21 @@ dp::Camera& dp::Camera::Roll(ang rollChange)
 } // end Camera& Camera::Roll(ang, bool)                                      */
 
 
-const f4& dp::Camera::RotateZRad(void) const
-{ return Transform::RotateZRad(); } // end const f4& RotateZRad(void) const   */
+const dp::q4f& dp::Camera::Rotation(void) const
+{ return Transform::Rotation(); } // end const q4f& Rotation(void) const      */
+
+
+dp::Camera& dp::Camera::Rotation(const q4f& orientation)
+{
+  Transform::Rotation(orientation);
+  dirtyView = true;
+  return *this;
+
+} // end Camera& Camera::Rotation(const q4f&)                                 */
+
+
+f4 dp::Camera::RotateZRad(void) const
+{ return Transform::RotateZRad(); } // end f4 RotateZRad(void) const          */
 
 
 dp::Camera& dp::Camera::Tilt(f4 upwardDistance)
@@ -288,6 +303,14 @@ const dp::m4f& dp::Camera::View(void)
 } // end const m4f& Camera::ViewMatrix(void)                                  */
 
 
+const dp::Frustum& dp::Camera::ViewFrustum(void)
+{
+  RecalculateFrustum();
+  return frustum;
+
+} // end const Frustum& Camera::ViewFrustum(void)                             */
+
+
 dp::Camera& dp::Camera::Yaw(ang yawChange)
 {
   Transform::Yaw(yawChange, true);
@@ -334,6 +357,44 @@ void dp::Camera::RecalculateDevice(void)
   }
 } // end void Camera::RecalculateDevice(void)                                 */
 
+void dp::Camera::RecalculateFrustum(void)
+{
+  RecalculateView();
+  RecalculatePersp();
+  if (dirtyFrustum)
+  {
+    // View space bounds, looking down -z: |x| <= w, |y| <= h at 1 unit deep
+    // (spans grow with depth, unless orthogonal), within [near, far] deep
+    f4 w = viewRes.x * 0.5f, h = viewRes.y * 0.5f;
+    f4 slope = Orthogonal() ? 0.0f : 1.0f;
+    v4f bound[Frustum::PLANES] = {
+      v4f(-1.0f, 0.0f, w * slope, w * (1.0f - slope)),  // Left
+      v4f( 1.0f, 0.0f, w * slope, w * (1.0f - slope)),  // Right
+      v4f(0.0f, -1.0f, h * slope, h * (1.0f - slope)),  // Bottom
+      v4f(0.0f,  1.0f, h * slope, h * (1.0f - slope)),  // Top
+      v4f(0.0f, 0.0f,  1.0f, -nearClip),                // Near
+      v4f(0.0f, 0.0f, -1.0f,  farClip) };               // Far
+
+    // n.Dot(view * p) <= s  =>  (n * view).Dot(p) <= s - n.Dot(view[3])
+    for (u1 i = 0u; i < Frustum::PLANES; ++i)
+    {
+      v3f normal;
+      f4 sum = bound[i].w;
+      for (s1 r = 0; r < 3; ++r)
+      {
+        normal.x += bound[i][r] * viewMat[0u][r];
+        normal.y += bound[i][r] * viewMat[1u][r];
+        normal.z += bound[i][r] * viewMat[2u][r];
+        sum -= bound[i][r] * viewMat[3u][r];
+      }
+      f4 scale = 1.0f / normal.Length();
+      frustum.Set(static_cast<Frustum::Face>(i),
+        Plane(normal * scale, sum * scale));
+    }
+    dirtyFrustum = false;
+  }
+} // end void Camera::RecalculateFrustum(void)                                */
+
 // Recalculate frustum distortion matrix based on local state flags           */
 void dp::Camera::RecalculatePersp(void)
 {
@@ -363,6 +424,7 @@ void dp::Camera::RecalculatePersp(void)
       //Log::D(perspMat.ToString(true));
     }
     dirtyLook = false;
+    dirtyFrustum = true;
   }
 } // end void Camera::RecalculatePersp(void)
 
@@ -374,5 +436,6 @@ void dp::Camera::RecalculateView(void)
     viewMat = TransforMatrix().Inverse(); // model->world inverse =: world->view
     //Log::D("view\n" + viewMat.ToString(true));
     dirtyView = false;
+    dirtyFrustum = true;
   }
 } // end void Camera::RecalculateView(void)
\ No newline at end of file
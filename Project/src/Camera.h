@@ -16,6 +16,7 @@ written consent of DigiPen Institute of Technology is prohibited.
 /*                                  Includes                                  */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
+#include "Frustum.h"    // Cached view volume bounding planes
 #include "Transform.h"  // Base class for inheritance
 #include "v2f.h"       // Picture plane dimension parameters
 
@@ -300,13 +301,33 @@ namespace dp //! Contents for use within class assignments
     Camera& Roll(ang rollChange);
 
 
+    /** Get the orientation as a unit quaternion (ie for interpolation)
+    \brief
+      - get the orientation as a unit quaternion (ie for interpolation)
+    \return
+      - reference to the stored unit quaternion of the camera orientation
+    */
+    const q4f& Rotation(void) const;
+
+
+    /** Set the orientation from a quaternion (ie a Slerp / Nlerp result)
+    \brief
+      - set the orientation from a quaternion (ie a Slerp / Nlerp result)
+    \param orientation
+      - rotation from world axes to camera axes (normalized when stored)
+    \return
+      - reference to the modified Camera for easier subsequent inline action
+    */
+    Camera& Rotation(const q4f& orientation);
+
+
     /** Get 2D rotation of the object, presuming no other axial rotation values
     \brief
       - get 2D rotation of the object, presuming no other axial rotation values
     \return
-      - reference to the contained Z value of the orientation v3f of radians
+      - Z value of the orientation's euler angles, in radians
     */
-    const f4& RotateZRad(void) const;
+    f4 RotateZRad(void) const;
 
 
     /** Set Camera to move by given amount from current values in local Y
@@ -364,6 +385,18 @@ namespace dp //! Contents for use within class assignments
     const m4f& View(void);
 
 
+    /** Get view volume bounded by the camera's 6 clip planes, in world space
+    \brief
+      - get view volume bounded by the camera's 6 clip planes, in world space
+    \details
+      - though a getter, must be non-constant to recalculate only as needed;
+      planes face outward, for culling volumes before they are drawn
+    \return
+      - frustum of the current view & perspective settings
+    */
+    const Frustum& ViewFrustum(void);
+
+
     /** Rotate the local orientation along the horizontal axis (+right / -left)
     \brief
       - rotate the local orientation along the horizontal axis (+right / -left)
@@ -411,6 +444,13 @@ namespace dp //! Contents for use within class assignments
     void RecalculateDevice(void);
 
 
+    /** Recalculate view volume planes as view or perspective matrices change
+    \brief
+      - recalculate view volume planes as view or perspective matrices change
+    */
+    void RecalculateFrustum(void);
+
+
     /** Recalculate frustum distortion matrix based on local state flags
     \brief
       - recalculate frustum distortion matrix based on local state flags
@@ -437,6 +477,9 @@ namespace dp //! Contents for use within class assignments
     //! Matrix for scaling view frustum world coordinates into render space
     m4f devMat;
 
+    //! World space view volume from view & perspective settings (as of last)
+    Frustum frustum;
+
     //! Viewport internal picture plane resolution (API scale of view frustum)
     v2f viewRes;
 
@@ -468,6 +511,9 @@ namespace dp //! Contents for use within class assignments
     //! Whether render scale device matrix is out of sync; needs recalculation
     bool dirtySlant;
 
+    //! Whether frustum planes lag the view or perspective matrix; recalculate
+    bool dirtyFrustum;
+
   }; // end Camera class
 
 } // end dp namespace
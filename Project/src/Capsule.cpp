@@ -0,0 +1,475 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  Capsule.cpp
+Purpose:  Swept sphere volume: every point within a radius of a line segment
+Details:  box tests run in the box's own frame (centered, axis aligned), where
+  segment to box distance is the least of: 0 if the segment crosses the box,
+  either end point's distance to the box, or the segment's distance to any
+  of the 12 box edges (a closest pair on a box face can always slide to one
+  of these without changing distance).  Triangles follow the same pattern.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// "./src/..."
+#include "AABB.h"     // Bounding Box in extrema, for intersection testing
+#include "AOBB.h"     // Bounding Box in center & extents, for intersection
+#include "BSphere.h"  // Bounding Sphere, for intersection testing
+#include "Capsule.h"  // Class declaration header
+#include "m3f.h"      // 3D matrix data: PCA method, 3D covariance matrix, etc.
+#include "m4f.h"      // Placement of mesh vertex data into world coordinates
+#include "Mesh.h"     // Vertex data iteration to scan for appropriate bounds
+#include "OBB.h"      // Oriented Bounding Box, for intersection testing
+#include "Plane.h"    // 2D boundary < <norm>, sum >; side output, intersection
+#include "Ray.h"      // Ray origin / direction, for intersection testing
+#include "Triangle.h" // Triangle points / plane, for intersection testing
+#include "v2f.h"      // Quadratic root pairs, projected spans along an axis
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+//! Whether segment [a, b] crosses a box centered at the origin (slab clipping)
+static bool SegmentCrossesBox(const dp::v3f& a, const dp::v3f& b,
+  const dp::v3f& ext)
+{
+  dp::v3f d = DistV3F(a, b);
+  dp::v2f t(0.0f, 1.0f); // Running [enter, exit] span of the segment in slabs
+  for (s1 i = 0; i < 3; ++i)
+  {
+    if (AbsF(d[i]) < _INf) // Parallel: must already lie within this slab
+    {
+      if (ext[i] < AbsF(a[i])) { return false; }
+      continue;
+    }
+    f4 inv = 1.0f / d[i];
+    f4 t0 = (-ext[i] - a[i]) * inv, t1 = (ext[i] - a[i]) * inv;
+    SwapIfF(t0, t1, t1 < t0);
+    t.min = MaxF(t.min, t0);
+    t.max = MinF(t.max, t1);
+    if (t.max < t.min) { return false; }
+  }
+  return true;
+
+} // end bool SegmentCrossesBox(const v3f&, const v3f&, const v3f&)           */
+
+
+//! Squared distance from segment [a, b] to a box centered at the origin
+static f4 SegmentBoxDistSq(const dp::v3f& a, const dp::v3f& b,
+  const dp::v3f& ext)
+{
+  if (SegmentCrossesBox(a, b, ext)) { return 0.0f; }
+  f4 best = MinF(dp::BoxDistSq(a, ext), dp::BoxDistSq(b, ext));
+  // 12 box edges: 4 per axis, running -ext to +ext along that axis
+  for (s1 i = 0; i < 3; ++i)
+  {
+    s1 j = (i + 1) % 3, k = (i + 2) % 3;
+    for (u1 c = 0; c < 4; ++c)
+    {
+      dp::v3f e0, e1;
+      e0[i] = -ext[i];
+      e1[i] = ext[i];
+      e0[j] = e1[j] = (c & 1) ? ext[j] : -ext[j];
+      e0[k] = e1[k] = (c & 2) ? ext[k] : -ext[k];
+      best = MinF(best, dp::SegmentDistSq(a, b, e0, e1));
+    }
+  }
+  return best;
+
+} // end f4 SegmentBoxDistSq(const v3f&, const v3f&, const v3f&)              */
+
+
+//! Least root of a*t^2 + b*t + c = 0 within [lo, hi], if any
+static bool LeastRootIn(f4 a, f4 b, f4 c, f4 lo, f4 hi, f4& root)
+{
+  // a shrinks with the square of the motion, so no absolute bound on it can
+  // tell a small sweep from a degenerate one.  q = -(b + sign(b) sqrt(disc))
+  // / 2 never cancels, & its roots c / q, q / a hold as a nears 0 (c / q
+  // then being the linear root -c / b, q / a running off to infinity)
+  f4 disc = b * b - 4.0f * a * c;
+  if (disc < 0.0f) { return false; }
+  f4 q = -AHALF * (b + (IsNegF(b) ? -SqrtF(disc) : SqrtF(disc)));
+  f4 r0 = (q != 0.0f) ? c / q : NaNf; // NaN: no root, never in range
+  f4 r1 = (a != 0.0f) ? q / a : NaNf;
+  if (r1 < r0) { SwapF(r0, r1); }
+  if (IsInF(r0, hi, lo)) { root = r0; return true; }
+  if (IsInF(r1, hi, lo)) { root = r1; return true; }
+  return false;
+
+} // end bool LeastRootIn(f4, f4, f4, f4, f4, f4&)                            */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::Capsule::Capsule(const Mesh& mesh, const m4f& place, u4 samples,
+  s2 step, u2 first)
+{
+  // Get list of vertex world coordinates to sample (VertexBuffer() reads
+  // the 1st vertex, so an empty mesh must be caught before it)
+  u4 verts = mesh.VertexCount();
+  if (!verts) // No points to bound: degenerate capsule at the placed origin
+  {
+    a = b = place.PProd(nullv3f);
+    r = 0.0f;
+    return;
+  }
+  const Mesh::Vertex* v = &mesh.VertexBuffer();
+  std::vector<v3f> wPos(verts);
+  v3f mean; // Axis line passes through the centroid of the data
+  for (u4 i = 0; i < verts; ++i) { wPos[i] = place.PProd(v[i].pos); }
+  for (u4 i = 0; i < verts; ++i) { mean += wPos[i]; }
+  mean *= InvF(static_cast<f4>(verts));
+
+  // Segment lies along the major axis of sampled statistical spread
+  v3f spread;
+  m3f basis = PCA3(Covariance3D(&wPos[0], verts, samples, step, first),
+    &spread);
+  v3f axis = basis[MaxB3F(spread.x, spread.y, spread.z)].UnitVec();
+
+  // Radius: widest (squared) distance of any point from the axis line
+  f4 rSq = 0.0f;
+  for (u4 i = 0; i < verts; ++i)
+  {
+    v3f d = DistV3F(mean, wPos[i]);
+    f4 t = d.Dot(axis);
+    rSq = MaxF(rSq, d.LengthSquared() - t * t);
+  }
+  r = SqrtF(rSq);
+
+  // Pull each end in as far as its hemisphere cap still bounds every point
+  v2f ends(INf, -INf); // <A, B> axis scalars; each point bounds how far in
+  for (u4 i = 0; i < verts; ++i)
+  {
+    v3f d = DistV3F(mean, wPos[i]);
+    f4 t = d.Dot(axis);
+    f4 h = SqrtF(MaxF(rSq - (d.LengthSquared() - t * t), 0.0f));
+    ends.min = MinF(ends.min, t + h);
+    ends.max = MaxF(ends.max, t - h);
+  }
+  if (ends.max < ends.min) // Round data: caps overlap, so meet in the middle
+  { ends.min = ends.max = (ends.min + ends.max) * AHALF; }
+  a = mean + axis * ends.min;
+  b = mean + axis * ends.max;
+
+} // end Capsule::Capsule(const Mesh&, const m4f&, u4, s2, u2)                */
+
+
+dp::Capsule::Capsule(const v3f& a, const v3f& b, f4 radius)
+  : a(a), b(b), r(AbsF(radius))
+{ } // end Capsule::Capsule(const v3f&, const v3f&, f4)                       */
+
+
+dp::Capsule::Capsule(const BSphere& ball, const v3f& displacement)
+  : a(ball.Center()), b(ball.Center() + displacement), r(ball.Radius())
+{ } // end Capsule::Capsule(const BSphere&, const v3f&)                       */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::v3f dp::Capsule::Closest(const v3f& point, f4* t) const
+{
+  v3f ab = AB();
+  f4 len = ab.LengthSquared();
+  f4 s = (len < _INf) ? 0.0f : InF(DistV3F(a, point).Dot(ab) / len, 1.0f);
+  if (t) { *t = s; }
+  return a + ab * s;
+
+} // end v3f Capsule::Closest(const v3f&, f4*) const                          */
+
+
+bool dp::Capsule::IsIn(const AABB& box) const
+{
+  return SegmentBoxDistSq(a - box.Mid(), b - box.Mid(), box.HalfExt())
+    <= r * r;
+
+} // end bool Capsule::IsIn(const AABB&) const                                */
+
+
+bool dp::Capsule::IsIn(const AOBB& box) const
+{
+  return SegmentBoxDistSq(a - box.Mid(), b - box.Mid(), box.Ext()) <= r * r;
+
+} // end bool Capsule::IsIn(const AOBB&) const                                */
+
+
+bool dp::Capsule::IsIn(const BSphere& ball) const
+{
+  f4 rad = r + ball.Radius();
+  return DistSq(Closest(ball.Center()), ball.Center()) <= rad * rad;
+
+} // end bool Capsule::IsIn(const BSphere&) const                             */
+
+
+bool dp::Capsule::IsIn(const Capsule& other) const
+{
+  f4 rad = r + other.r;
+  return SegmentDistSq(a, b, other.a, other.b) <= rad * rad;
+
+} // end bool Capsule::IsIn(const Capsule&) const                             */
+
+
+bool dp::Capsule::IsIn(const OBB& box) const
+{
+  // Rotate the segment into the box's local frame: then it's an AOBB test
+  const m3f& basis = box.Basis();
+  v3f dA = DistV3F(box.Center(), a), dB = DistV3F(box.Center(), b);
+  v3f lA(dA.Dot(basis[0]), dA.Dot(basis[1]), dA.Dot(basis[2]));
+  v3f lB(dB.Dot(basis[0]), dB.Dot(basis[1]), dB.Dot(basis[2]));
+  return SegmentBoxDistSq(lA, lB, box.HalfExt()) <= r * r;
+
+} // end bool Capsule::IsIn(const OBB&) const                                 */
+
+
+bool dp::Capsule::IsIn(const Plane& plane) const
+{
+  f4 dA = plane.Normal().Dot(a) - plane.Sum(); // Signed end point distances
+  f4 dB = plane.Normal().Dot(b) - plane.Sum();
+  return AbsF(dA) <= r || AbsF(dB) <= r || (IsNegF(dA) != IsNegF(dB));
+
+} // end bool Capsule::IsIn(const Plane&) const                               */
+
+
+bool dp::Capsule::IsIn(const Ray& ray, f4* tDist) const
+{
+  const v3f& o = ray.Origin();
+  const v3f& n = ray.Direction();
+  if (IsIn(o)) { if (tDist) { *tDist = 0.0f; } return true; }
+  f4 best = INf, t;
+
+  // Cylinder body: |(m + tn) x d|^2 = r^2 |d|^2, limited to axial [0, |d|^2]
+  v3f d = AB(), m = DistV3F(a, o);
+  f4 md = m.Dot(d), nd = n.Dot(d), dd = d.Dot(d);
+  f4 qa = dd - nd * nd; // =: dd * n.n - nd^2, unit direction (n.n = 1)
+  f4 qb = 2.0f * (dd * m.Dot(n) - nd * md);
+  f4 qc = dd * (m.Dot(m) - r * r) - md * md;
+  if (_INf * dd < qa && LeastRootIn(qa, qb, qc, 0.0f, INf, t)
+    && IsInF(md + t * nd, dd, 0.0f)) { best = t; }
+
+  // End caps: spheres of the radius at A and B
+  for (const v3f* c : { &a, &b })
+  {
+    v3f mc = DistV3F(*c, o);
+    if (LeastRootIn(1.0f, 2.0f * mc.Dot(n), mc.Dot(mc) - r * r, 0.0f, best,
+      t)) { best = t; }
+  }
+  if (tDist) { *tDist = best; }
+  return best != INf;
+
+} // end bool Capsule::IsIn(const Ray&, f4*) const                            */
+
+
+bool dp::Capsule::IsIn(const Triangle& tri) const
+{
+  f4 rSq = r * r;
+  // Either end point within a radius of the triangle
+  if (DistSq(a, ClosestOnTriangle(tri, a)) <= rSq) { return true; }
+  if (DistSq(b, ClosestOnTriangle(tri, b)) <= rSq) { return true; }
+  // Segment passing within a radius of any triangle edge
+  if (SegmentDistSq(a, b, tri.A(), tri.B()) <= rSq
+    || SegmentDistSq(a, b, tri.B(), tri.C()) <= rSq
+    || SegmentDistSq(a, b, tri.C(), tri.A()) <= rSq) { return true; }
+  // Otherwise only a segment piercing the face can be within the radius
+  f4 dA = tri.Normal().Dot(a) - tri.NSum();
+  f4 dB = tri.Normal().Dot(b) - tri.NSum();
+  if (IsNegF(dA) == IsNegF(dB) || dA == dB) { return false; }
+  v3f p = a + AB() * (dA / (dA - dB)); // Segment crossing of the tri plane
+  return DistSq(p, ClosestOnTriangle(tri, p)) <= rSq;
+
+} // end bool Capsule::IsIn(const Triangle&) const                            */
+
+
+bool dp::Capsule::IsIn(const v3f& point) const
+{
+  return DistSq(Closest(point), point) <= r * r;
+
+} // end bool Capsule::IsIn(const v3f&) const                                 */
+
+
+bool dp::Capsule::SweptIn(const Triangle& tri, f4* tImpact,
+  v3f* contact) const
+{
+  return SweptSphereIn(BSphere(a, r), AB(), tri, tImpact, contact);
+
+} // end bool Capsule::SweptIn(const Triangle&, f4*, v3f*) const              */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Helper Functions                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::v3f dp::ClosestOnTriangle(const Triangle& tri, const v3f& point)
+{
+  const v3f& a = tri.A();
+  v3f b = tri.B(), c = tri.C();
+  v3f ab = DistV3F(a, b), ac = DistV3F(a, c);
+
+  // Vertex region A
+  v3f ap = DistV3F(a, point);
+  f4 d1 = ab.Dot(ap), d2 = ac.Dot(ap);
+  if (d1 <= 0.0f && d2 <= 0.0f) { return a; }
+  // Vertex region B
+  v3f bp = DistV3F(b, point);
+  f4 d3 = ab.Dot(bp), d4 = ac.Dot(bp);
+  if (0.0f <= d3 && d4 <= d3) { return b; }
+  // Edge region AB
+  f4 vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.0f && 0.0f <= d1 && d3 <= 0.0f)
+  { return a + ab * (d1 / (d1 - d3)); }
+  // Vertex region C
+  v3f cp = DistV3F(c, point);
+  f4 d5 = ab.Dot(cp), d6 = ac.Dot(cp);
+  if (0.0f <= d6 && d5 <= d6) { return c; }
+  // Edge region AC
+  f4 vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.0f && 0.0f <= d2 && d6 <= 0.0f)
+  { return a + ac * (d2 / (d2 - d6)); }
+  // Edge region BC
+  f4 va = d3 * d6 - d5 * d4;
+  if (va <= 0.0f && 0.0f <= (d4 - d3) && 0.0f <= (d5 - d6))
+  { return b + DistV3F(b, c) * ((d4 - d3) / ((d4 - d3) + (d5 - d6))); }
+  // Face region: barycentric <u, v, w> from the sub-areas
+  f4 denom = 1.0f / (va + vb + vc);
+  return a + ab * (vb * denom) + ac * (vc * denom);
+
+} // end v3f ClosestOnTriangle(const Triangle&, const v3f&)                   */
+
+
+f4 dp::SegmentDistSq(const v3f& p0, const v3f& p1, const v3f& q0,
+  const v3f& q1, f4* s, f4* t)
+{
+  v3f d1 = DistV3F(p0, p1), d2 = DistV3F(q0, q1), r = DistV3F(q0, p0);
+  f4 a = d1.Dot(d1), e = d2.Dot(d2), f = d2.Dot(r);
+  f4 sc = 0.0f, tc = 0.0f; // Closest point ratios along each segment
+
+  if (a <= _INf && e <= _INf) { } // Both degenerate to points
+  else if (a <= _INf) { tc = InF(f / e, 1.0f); } // First is a point
+  else
+  {
+    f4 c = d1.Dot(r);
+    if (e <= _INf) { sc = InF(-c / a, 1.0f); } // Second is a point
+    else
+    {
+      f4 b = d1.Dot(d2);
+      f4 denom = a * e - b * b; // 0 when parallel: any sc works, so use 0
+      sc = (denom != 0.0f) ? InF((b * f - c * e) / denom, 1.0f) : 0.0f;
+      tc = (b * sc + f) / e;
+      // Clamp t to [0, 1], then recompute s for that clamped t
+      if (tc < 0.0f)      { tc = 0.0f; sc = InF(-c / a, 1.0f); }
+      else if (1.0f < tc) { tc = 1.0f; sc = InF((b - c) / a, 1.0f); }
+    }
+  }
+  if (s) { *s = sc; }
+  if (t) { *t = tc; }
+  return DistSq(p0 + d1 * sc, q0 + d2 * tc);
+
+} // end f4 SegmentDistSq(const v3f&, const v3f&, const v3f&, const v3f&...)  */
+
+
+bool dp::SweptSphereIn(const BSphere& ball, const v3f& displacement,
+  const Triangle& tri, f4* tImpact, v3f* contact)
+{
+  const v3f& c = ball.Center();
+  const v3f& v = displacement;
+  f4 rad = ball.Radius(), rSq = rad * rad;
+  f4 best = INf, t;
+  v3f hit;
+
+  // Already touching at the start of the sweep
+  hit = ClosestOnTriangle(tri, c);
+  if (DistSq(c, hit) <= rSq)
+  {
+    if (tImpact) { *tImpact = 0.0f; }
+    if (contact) { *contact = hit; }
+    return true;
+  }
+
+  // Face: sphere reaches the plane (from its side) at a point inside the tri
+  const v3f& n = tri.Normal();
+  f4 d0 = n.Dot(c) - tri.NSum(), dn = n.Dot(v);
+  if (dn * d0 < 0.0f) // Moving toward the plane
+  {
+    f4 side = IsNegF(d0) ? -rad : rad;
+    t = (side - d0) / dn;
+    v3f p = c + v * t - n * side; // Sphere's lead point on the plane
+    // Inside the triangle, to rounding of the triangle's own (squared) size
+    f4 span = DistSq(tri.A(), tri.B()) + DistSq(tri.B(), tri.C())
+      + DistSq(tri.C(), tri.A());
+    if (IsInF(t, 1.0f, 0.0f)
+      && DistSq(p, ClosestOnTriangle(tri, p)) <= _INf * span)
+    { best = t; hit = p; } // Face contact precedes any edge / vertex contact
+  }
+
+  if (best == INf)
+  {
+    f4 vv = v.Dot(v);
+    const v3f pts[3] = { tri.A(), tri.B(), tri.C() };
+    for (u1 i = 0; i < 3; ++i)
+    {
+      // Vertex: center ray vs sphere of the radius about the vertex
+      v3f m = DistV3F(pts[i], c);
+      if (LeastRootIn(vv, 2.0f * v.Dot(m), m.Dot(m) - rSq, 0.0f,
+        MinF(best, 1.0f), t)) { best = t; hit = pts[i]; }
+
+      // Edge: center ray vs cylinder of the radius about the edge
+      v3f e = DistV3F(pts[i], pts[(i + 1) % 3]);
+      f4 ee = e.Dot(e), ev = e.Dot(v), em = e.Dot(m);
+      if (LeastRootIn(ee * vv - ev * ev, 2.0f * (ee * v.Dot(m) - ev * em),
+        ee * (m.Dot(m) - rSq) - em * em, 0.0f, MinF(best, 1.0f), t))
+      {
+        f4 f = (ev * t + em) / ee; // Contact ratio along the edge
+        if (IsInF(f, 1.0f, 0.0f)) { best = t; hit = pts[i] + e * f; }
+      }
+    }
+  }
+  if (tImpact) { *tImpact = best; }
+  if (contact && best != INf) { *contact = hit; }
+  return best != INf;
+
+} // end bool SweptSphereIn(const BSphere&, const v3f&, const Triangle&, ...) */
+
+
+u4 dp::SweptSphereCheck(f8* error)
+{
+  const Triangle tri(nullv3f, X_HAT, Y_HAT);
+  const f4 rad = AHALF, gap = 0.5e-3f; // Half of the 1e-3 sweep to cross
+  u4 failed = 0u;
+  f8 worst = 0.0;
+
+  // Each sweep starts the gap past touching the feature, straight at it
+  auto sweep = [&](const v3f& feature, const v3f& away)
+  {
+    v3f u = away.UnitVec();
+    BSphere ball(feature + u * (rad + gap), rad);
+    f4 t = INf;
+    v3f hit;
+    if (!SweptSphereIn(ball, u * (-2.0f * gap), tri, &t, &hit)) { ++failed; }
+    else
+    {
+      f8 miss = MaxD(AbsD(t - AHALF), SqrtF(DistSq(hit, feature)));
+      if (1e-3 < miss) { ++failed; }
+      worst = MaxD(worst, miss);
+    }
+    if (SweptSphereIn(ball, u * (2.0f * gap), tri)) { ++failed; } // Away
+  };
+  sweep(nullv3f, v3f(-1.0f, -1.0f, -1.0f));               // Vertex A
+  sweep(v3f(AHALF, 0.0f, 0.0f), v3f(0.0f, -1.0f, -1.0f)); // Edge AB
+  sweep(v3f(0.25f, 0.25f, 0.0f), Z_HAT);                  // Face
+
+  if (error) { *error = worst; }
+  return failed;
+
+} // end u4 SweptSphereCheck(f8*)                                             */
@@ -0,0 +1,445 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  Capsule.h
+Purpose:  Swept sphere volume: every point within a radius of a line segment
+Details:  footprint of 2 segment end points and a radius, the same as a sphere
+  swept from one end point to the other, so a moving BSphere over a frame
+  and a standing character body both test as one primitive.
+
+  Each test reduces to a closest-distance query from the segment to the
+  other shape, compared against the (combined) radius: closed-form for
+  points, segments, planes and spheres, and a feature walk (end points,
+  then the other shape's edges) for boxes and triangles.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// "./src/..."
+#include "v3f.h"  // Segment end point members, for cartesian grouping semantic
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class AABB;    // Bounding box with <min, max>; intersection tests
+  class AOBB;    // Bounding box with <centroid, extents>; intersection tests
+  class BSphere; // Bounding sphere <center, radius>, for collision tests
+  class Mesh;    // Vertex data to scan for bounding volume context
+  class OBB;     // Bounding box with local basis; intersection tests
+  class Plane;   // Boundary <normal, sum>; test intersection (bool, dist...)
+  class Ray;     // Intersection tests (bool, dist) of (Point),<direction> pair
+  class Triangle;// Test intersection (bool, dist...) with 2D boundary subset
+  class m4f;     // Placement matrix from mesh model space into world coords
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! Capsule: <segment [A, B], radius> bounding elongated / moving objects
+  class Capsule
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create a Capsule fit along the PCA major axis of Mesh vertex spread
+    \brief
+      - create a Capsule fit along the PCA major axis of Mesh vertex spread
+    \details
+      - radius is the widest point distance from the major axis line, then
+      each end point is pulled in as far as its cap still bounds every point
+    \param mesh
+      - mesh to have vertex data read for maximal spread to use as data bounds
+    \param place
+      - position, scale and rotation to convert mesh data to world coordinates
+    \param samples
+      - [1, s =: mesh.VertexCount()] sampled points read from vertex dataset
+    \param step
+      - [-s, 0),(0, s] point samples to be skipped per scan step
+    \param first
+      - [1, s] point samples to offset by in first scan iteration
+    */
+    Capsule(const Mesh& mesh, const m4f& place, u4 samples = u4_INVALID,
+      s2 step = 1, u2 first = 0u);
+
+
+    /** Create a Capsule from segment end points and a radius
+    \brief
+      - create a Capsule from segment end points and a radius
+    \param a
+      - cartesian coordinate of the segment's initial end point (sweep start)
+    \param b
+      - cartesian coordinate of the segment's terminal end point (sweep end)
+    \param radius
+      - distance from the segment bounded (absolute value used)
+    */
+    Capsule(const v3f& a = nullv3f, const v3f& b = nullv3f, f4 radius = 0.0f);
+
+
+    /** Create a Capsule as the volume a BSphere sweeps across a displacement
+    \brief
+      - create a Capsule as the volume a BSphere sweeps across a displacement
+    \param ball
+      - sphere at its initial position (segment end A)
+    \param displacement
+      - distance vector moved by the sphere's center to reach end B
+    */
+    Capsule(const BSphere& ball, const v3f& displacement);
+
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Public Methods                                */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Access cartesian < x, y, z > coordinate of segment's initial end point
+    \brief
+      - access cartesian < x, y, z > coordinate of segment's initial end point
+    \return
+      - reference to the segment's initial end point
+    */
+    inline const v3f& A(void) const
+    { return a; } // end const v3f& Capsule::A(void) const                    */
+
+
+    /** Access cartesian < x, y, z > coordinate of segment's terminal end point
+    \brief
+      - access cartesian < x, y, z > coordinate of segment's terminal end point
+    \return
+      - reference to the segment's terminal end point
+    */
+    inline const v3f& B(void) const
+    { return b; } // end const v3f& Capsule::B(void) const                    */
+
+
+    /** Get the vector spanning the segment, from end point A to end point B
+    \brief
+      - get the vector spanning the segment, from end point A to end point B
+    \return
+      - segment direction scaled to the segment length (B - A)
+    */
+    inline v3f AB(void) const
+    { return DistV3F(a, b); } // end v3f Capsule::AB(void) const              */
+
+
+    /** Get the closest point on the capsule's segment to a given point
+    \brief
+      - get the closest point on the capsule's segment to a given point
+    \param point
+      - cartesian world space coord to find the nearest segment point to
+    \param t
+      - [0, 1] ratio from A to B of the closest point, to be set if given
+    \return
+      - point on segment [A, B] closest to the given point
+    */
+    v3f Closest(const v3f& point, f4* t = nullptr) const;
+
+
+    /** Get whether an axis aligned box overlaps this capsule
+    \brief
+      - get whether an axis aligned box overlaps this capsule
+    \param box
+      - box tested in its own <mid, ext> frame: segment to box distance
+    \return
+      - true if the segment comes within a radius of the box
+    */
+    bool IsIn(const AABB& box) const;
+
+
+    /** Get whether an axis aligned <mid, ext> box overlaps this capsule
+    \brief
+      - get whether an axis aligned <mid, ext> box overlaps this capsule
+    \param box
+      - box tested in its own <mid, ext> frame: segment to box distance
+    \return
+      - true if the segment comes within a radius of the box
+    */
+    bool IsIn(const AOBB& box) const;
+
+
+    /** Get whether a bounding sphere overlaps this capsule
+    \brief
+      - get whether a bounding sphere overlaps this capsule
+    \param ball
+      - sphere whose center is tested against the segment
+    \return
+      - true if segment to center distance is within the combined radius
+    */
+    bool IsIn(const BSphere& ball) const;
+
+
+    /** Get whether another capsule overlaps this capsule
+    \brief
+      - get whether another capsule overlaps this capsule
+    \param other
+      - capsule whose segment is tested against this segment
+    \return
+      - true if segment to segment distance is within the combined radius
+    */
+    bool IsIn(const Capsule& other) const;
+
+
+    /** Get whether an oriented bounding box overlaps this capsule
+    \brief
+      - get whether an oriented bounding box overlaps this capsule
+    \param box
+      - box whose basis the segment is rotated into, then tested as an AOBB
+    \return
+      - true if the segment comes within a radius of the box
+    */
+    bool IsIn(const OBB& box) const;
+
+
+    /** Get whether this capsule touches or straddles a given plane
+    \brief
+      - get whether this capsule touches or straddles a given plane
+    \param plane
+      - plane to find the end points' signed distances to
+    \return
+      - true if either end is within a radius, or the ends are on both sides
+    */
+    bool IsIn(const Plane& plane) const;
+
+
+    /** Get whether a ray hits this capsule, and the distance to reach it
+    \brief
+      - get whether a ray hits this capsule, and the distance to reach it
+    \details
+      - nearest of the ray's hits on the cylinder body and both end caps;
+      false return =: INf => "intersect at infinity" for consistency of results
+    \param ray
+      - ray to test for collision with this capsule's surface
+    \param tDist
+      - ray length to meet capsule, to be set (0 if starting inside) if given
+    \return
+      - true only if the ray has a real, non-negative scalar to reach capsule
+    */
+    bool IsIn(const Ray& ray, f4* tDist = nullptr) const;
+
+
+    /** Get whether a triangle overlaps this capsule
+    \brief
+      - get whether a triangle overlaps this capsule
+    \param tri
+      - triangle tested by segment crossing, end points, then its 3 edges
+    \return
+      - true if the segment comes within a radius of the triangle
+    */
+    bool IsIn(const Triangle& tri) const;
+
+
+    /** Get whether a cartesian point is within the capsule's radius
+    \brief
+      - get whether a cartesian point is within the capsule's radius
+    \param point
+      - cartesian world space coord to be evaluated for intersection with this
+    \return
+      - true if given point is within a radius of the segment
+    */
+    bool IsIn(const v3f& point) const;
+
+
+    /** Get the length of the capsule's segment (sans the radius end caps)
+    \brief
+      - get the length of the capsule's segment (sans the radius end caps)
+    \return
+      - distance from end point A to end point B
+    */
+    inline f4 Length(void) const
+    { return Dist(a, b); } // end f4 Capsule::Length(void) const              */
+
+
+    /** Access the capsule's radius from its segment
+    \brief
+      - access the capsule's radius from its segment
+    \return
+      - distance every bound point is within from the segment
+    */
+    inline const f4& Radius(void) const
+    { return r; } // end const f4& Capsule::Radius(void) const                */
+
+
+    /** Set the capsule's radius from its segment
+    \brief
+      - set the capsule's radius from its segment
+    \param radius
+      - distance from the segment bounded (absolute value used)
+    \return
+      - reference to the modified Capsule for easier subsequent inline action
+    */
+    inline Capsule& Radius(f4 radius)
+    {
+      r = AbsF(radius); return *this;
+    } // end Capsule& Capsule::Radius(f4)                                     */
+
+
+    /** Set the segment end points of the capsule
+    \brief
+      - set the segment end points of the capsule
+    \param initial
+      - cartesian coordinate of the segment's initial end point A
+    \param terminal
+      - cartesian coordinate of the segment's terminal end point B
+    \return
+      - reference to the modified Capsule for easier subsequent inline action
+    */
+    inline Capsule& Segment(const v3f& initial, const v3f& terminal)
+    {
+      a = initial; b = terminal; return *this;
+    } // end Capsule& Capsule::Segment(const v3f&, const v3f&)                */
+
+
+    /** Get the earliest time a sphere swept along the segment hits a triangle
+    \brief
+      - get the earliest time a sphere swept along the segment hits a triangle
+    \details
+      - the capsule read as a sphere of its radius moving from A (t = 0) to B
+      (t = 1); see SweptSphereIn for the full query details
+    \param tri
+      - triangle (static) which the sphere may hit on its way from A to B
+    \param tImpact
+      - [0, 1] sweep ratio of first contact to be set if given (INf on miss)
+    \param contact
+      - point of first contact on the triangle to be set if given
+    \return
+      - true if the swept sphere touches the triangle within the sweep
+    */
+    bool SweptIn(const Triangle& tri, f4* tImpact = nullptr,
+      v3f* contact = nullptr) const;
+
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                        Operator Overloads                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Move the capsule's segment by the given displacement
+    \brief
+      - move the capsule's segment by the given displacement
+    \param displacement
+      - distance vector moving both segment end points
+    \return
+      - reference to the modified Capsule for easier subsequent inline action
+    */
+    inline Capsule& operator+=(const v3f& displacement)
+    {
+      a += displacement; b += displacement; return *this;
+    } // end Capsule& Capsule::operator+=(const v3f&)                         */
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Segment initial end point (sweep start)
+    v3f a;
+
+    //! Segment terminal end point (sweep end)
+    v3f b;
+
+    //! Distance every bound point lies within from the segment
+    f4 r;
+
+  }; // end Capsule class declaration
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                      Helper Function Declarations                        */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  /** Get the closest point on a triangle to a given point (by Voronoi region)
+  \brief
+    - get the closest point on a triangle to a given point (by Voronoi region)
+  \param tri
+    - triangle whose vertex, edge, or face region the point falls into
+  \param point
+    - cartesian world space coord to find the nearest triangle point to
+  \return
+    - point on (or in) the triangle closest to the given point
+  */
+  v3f ClosestOnTriangle(const Triangle& tri, const v3f& point);
+
+
+  /** Get the squared distance between two segments, and the closest points
+  \brief
+    - get the squared distance between two segments, and the closest points
+  \param p0
+    - initial end point of the first segment
+  \param p1
+    - terminal end point of the first segment
+  \param q0
+    - initial end point of the second segment
+  \param q1
+    - terminal end point of the second segment
+  \param s
+    - [0, 1] ratio along the first segment of its closest point, if given
+  \param t
+    - [0, 1] ratio along the second segment of its closest point, if given
+  \return
+    - squared distance between the closest points of the two segments
+  */
+  f4 SegmentDistSq(const v3f& p0, const v3f& p1, const v3f& q0,
+    const v3f& q1, f4* s = nullptr, f4* t = nullptr);
+
+
+  /** Get the earliest time a moving sphere touches a (static) triangle
+  \brief
+    - get the earliest time a moving sphere touches a (static) triangle
+  \details
+    - first contact is checked against the face (touching its plane inside
+    the triangle), then the 3 vertices (ray vs sphere) and 3 edges (ray vs
+    cylinder): the earliest of these is the time of impact; a sphere already
+    within its radius of the triangle at the start returns t = 0
+  \param ball
+    - sphere at its start position (t = 0)
+  \param displacement
+    - distance vector its center moves by the end of the sweep (t = 1)
+  \param tri
+    - triangle which may be hit by the sphere during its sweep
+  \param tImpact
+    - [0, 1] sweep ratio of first contact to be set if given (INf on miss)
+  \param contact
+    - point of first contact on the triangle to be set if given
+  \return
+    - true if the moving sphere touches the triangle within the sweep
+  */
+  bool SweptSphereIn(const BSphere& ball, const v3f& displacement,
+    const Triangle& tri, f4* tImpact = nullptr, v3f* contact = nullptr);
+
+
+  /** Check SweptSphereIn against known impacts of small (1e-3 long) sweeps
+  \brief
+    - check SweptSphereIn against known impacts of small (1e-3 long) sweeps
+  \details
+    - a half unit sphere half way into a 1e-3 sweep onto a vertex, an edge &
+    the face of a unit right triangle must hit at t = 0.5 on that feature,
+    and the same sweeps reversed must miss
+  \param error
+    - largest miss of a time of impact or contact point, to be set if given
+  \return
+    - count of failed checks: 0 if all passed
+  */
+  u4 SweptSphereCheck(f8* error = nullptr);
+
+
+ /*^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+ /*                             Helper Constants                              */
+ /*^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  // Ensurance that memory footprint is as intended
+  static_assert(sizeof(Capsule) == 7*4, "Capsule size not packed");
+
+} // end dp namespace
@@ -0,0 +1,359 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  Contact.cpp
+Purpose:  OBB / OBB separating axis test, building a contact manifold
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// "./src/..."
+#include "Contact.h"  // Function / class declarations header
+#include "OBB.h"      // Box center, basis & half-extents
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace
+{
+  //! Penetration an edge axis must beat a face axis by, to be chosen over it
+  constexpr f4 EDGE_SLOP = 0.001f;
+
+  //! Most points a quad keeps, clipped by 4 planes (1 more per plane)
+  constexpr u4 CLIPPED = 8u;
+
+  //! A box read once: world center, unit axes & half-extents
+  struct Frame
+  {
+    dp::v3f c;    //! World space center
+    dp::v3f u[3]; //! World space unit axes
+    dp::v3f e;    //! Half-extents along each axis
+
+    //! Read a box's placement
+    explicit Frame(const dp::OBB& box)
+      : c(box.Center()), e(box.HalfExt())
+    {
+      u[0] = box.LocalX();
+      u[1] = box.LocalY();
+      u[2] = box.LocalZ();
+    }
+
+    //! Get the box's projected radius on a unit axis
+    f4 Reach(const dp::v3f& axis) const
+    {
+      return dp::BoxReach(u, e, axis);
+    }
+  };
+
+} // end anonymous namespace
+
+
+//! Pack a pair of handles, lower first, into a key
+static inline u8 PairKey(u4 a, u4 b)
+{
+  return (a < b) ? ((static_cast<u8>(a) << 32) | b)
+                 : ((static_cast<u8>(b) << 32) | a);
+
+} // end u8 PairKey(u4, u4)                                                   */
+
+
+//! Renumber an axis for the boxes given in swapped order
+static inline u1 SwapAxis(u1 axis)
+{
+  if (axis < 3u) { return static_cast<u1>(axis + 3u); }
+  if (axis < 6u) { return static_cast<u1>(axis - 3u); }
+  if (axis < dp::Manifold::AXES)
+  {
+    u1 k = static_cast<u1>(axis - 6u);
+    return static_cast<u1>(6u + (k % 3u) * 3u + k / 3u);
+  }
+  return axis;
+
+} // end u1 SwapAxis(u1)                                                      */
+
+
+//! Get a numbered axis' gap (negative: penetration), & its unit normal a->b
+static f4 Gap(u1 axis, const Frame& a, const Frame& b, const dp::v3f& d,
+  dp::v3f& n)
+{
+  if (axis < 3u) { n = a.u[axis]; }
+  else if (axis < 6u) { n = b.u[axis - 3u]; }
+  else
+  {
+    n = a.u[(axis - 6u) / 3u].Cross(b.u[(axis - 6u) % 3u]);
+    f4 len = n.Length();
+    if (len < _INf) { return -INf; } // Parallel edges: face axes cover them
+    n /= len;
+  }
+  f4 dist = n.Dot(d);
+  if (dist < 0.0f) { n = -n; dist = -dist; }
+  return dist - a.Reach(n) - b.Reach(n);
+
+} // end f4 Gap(u1, const Frame&, const Frame&, const v3f&, v3f&)             */
+
+
+//! Clip a polygon to the half-space (axis . p <= limit), returning its count
+static u4 Clip(const dp::v3f* in, u4 count, const dp::v3f& axis, f4 limit,
+  dp::v3f* out)
+{
+  u4 kept = 0u;
+  for (u4 i = 0u; i < count; ++i)
+  {
+    const dp::v3f& p = in[i];
+    const dp::v3f& q = in[(i + 1u) % count];
+    f4 sp = axis.Dot(p) - limit, sq = axis.Dot(q) - limit;
+    if (sp <= 0.0f) { out[kept++] = p; }
+    if ((sp < 0.0f && 0.0f < sq) || (0.0f < sp && sq < 0.0f)) // Crossing
+    {
+      out[kept++] = p + (q - p) * (sp / (sp - sq));
+    }
+  }
+  return kept;
+
+} // end u4 Clip(const v3f*, u4, const v3f&, f4, v3f*)                        */
+
+
+//! Keep the (up to) 4 points spanning the widest area, deepest one first
+static void Reduce(dp::Manifold& contact, const dp::v3f* p, const f4* depth,
+  u4 count)
+{
+  if (count <= dp::Manifold::POINTS)
+  {
+    for (u4 i = 0u; i < count; ++i)
+    {
+      contact.point[i] = p[i];
+      contact.depths[i] = depth[i];
+    }
+    contact.count = count;
+    return;
+  }
+  u4 pick[dp::Manifold::POINTS] = { 0u, 0u, 0u, 0u };
+  for (u4 i = 1u; i < count; ++i) // Deepest point holds the most weight
+  {
+    if (depth[pick[0]] < depth[i]) { pick[0] = i; }
+  }
+  f4 best = -1.0f;
+  for (u4 i = 0u; i < count; ++i) // Farthest from it
+  {
+    f4 dist = DistSq(p[i], p[pick[0]]);
+    if (best < dist) { best = dist; pick[1] = i; }
+  }
+  dp::v3f edge = p[pick[1]] - p[pick[0]];
+  dp::v3f side = contact.normal; // Signed area about the contact normal
+  f4 most = -1.0f, least = 1.0f;
+  for (u4 i = 0u; i < count; ++i) // Widest triangle on each side of that
+  {
+    f4 area = side.Dot(edge.Cross(p[i] - p[pick[0]]));
+    if (most < area) { most = area; pick[2] = i; }
+    if (area < least) { least = area; pick[3] = i; }
+  }
+  contact.count = 0u;
+  for (u4 i = 0u; i < dp::Manifold::POINTS; ++i) // Collinear: fewer unique
+  {
+    bool seen = false;
+    for (u4 j = 0u; j < i; ++j) { seen = seen || pick[j] == pick[i]; }
+    if (seen) { continue; }
+    contact.point[contact.count] = p[pick[i]];
+    contact.depths[contact.count++] = depth[pick[i]];
+  }
+
+} // end void Reduce(Manifold&, const v3f*, const f4*, u4)                    */
+
+
+//! Clip the incident face of one box to the reference face of the other
+static void FaceContact(const Frame& ref, u1 face, const Frame& inc,
+  const dp::v3f& n, dp::Manifold& contact)
+{
+  // Incident face: the one facing most against the reference normal
+  u1 k = 0u;
+  f4 facing = 0.0f;
+  for (u1 i = 0u; i < 3u; ++i)
+  {
+    f4 dot = AbsF(inc.u[i].Dot(n));
+    if (facing < dot) { facing = dot; k = i; }
+  }
+  u1 k1 = static_cast<u1>((k + 1u) % 3u), k2 = static_cast<u1>((k + 2u) % 3u);
+  dp::v3f fc = inc.c + inc.u[k] * ((inc.u[k].Dot(n) > 0.0f) ? -inc.e[k]
+    : inc.e[k]);
+  dp::v3f span1 = inc.u[k1] * inc.e[k1], span2 = inc.u[k2] * inc.e[k2];
+  dp::v3f poly[CLIPPED], temp[CLIPPED];
+  poly[0] = fc + span1 + span2;
+  poly[1] = fc - span1 + span2;
+  poly[2] = fc - span1 - span2;
+  poly[3] = fc + span1 - span2;
+
+  // Clip to the 4 side planes of the reference face
+  u4 count = 4u;
+  for (u1 i = 1u; i < 3u && count; ++i)
+  {
+    const dp::v3f& side = ref.u[(face + i) % 3u];
+    f4 mid = side.Dot(ref.c), reach = ref.e[static_cast<s1>((face + i) % 3u)];
+    count = Clip(poly, count, side, mid + reach, temp);
+    count = count ? Clip(temp, count, -side, reach - mid, poly) : 0u;
+  }
+
+  // Keep points under the reference face, placed midway to its surface
+  dp::v3f found[CLIPPED];
+  f4 depth[CLIPPED];
+  f4 plane = n.Dot(ref.c) + ref.e[face];
+  u4 under = 0u;
+  for (u4 i = 0u; i < count; ++i)
+  {
+    f4 s = n.Dot(poly[i]) - plane;
+    if (s <= 0.0f)
+    {
+      found[under] = poly[i] - n * (s * AHALF);
+      depth[under++] = -s;
+    }
+  }
+  if (!under) // Only when clipping rounds away a grazing touch: 1 point
+  {
+    found[0] = fc;
+    depth[0] = contact.depth;
+    under = 1u;
+  }
+  Reduce(contact, found, depth, under);
+
+} // end void FaceContact(const Frame&, u1, const Frame&, const v3f&, ...)    */
+
+
+//! Find the closest points of the 2 supporting edges, for an edge axis
+static void EdgeContact(const Frame& a, u1 i, const Frame& b, u1 j,
+  const dp::v3f& n, dp::Manifold& contact)
+{
+  // Supporting edge of each box: its corner pushed furthest toward the other
+  dp::v3f pA = a.c, pB = b.c;
+  for (u1 k = 0u; k < 3u; ++k)
+  {
+    if (k != i) { pA += a.u[k] * ((a.u[k].Dot(n) > 0.0f) ? a.e[k] : -a.e[k]); }
+    if (k != j) { pB += b.u[k] * ((b.u[k].Dot(n) > 0.0f) ? -b.e[k] : b.e[k]); }
+  }
+  // Closest points of the 2 edge lines, clamped to the edges' lengths
+  const dp::v3f& uA = a.u[i];
+  const dp::v3f& uB = b.u[j];
+  dp::v3f r = pA - pB;
+  f4 dot = uA.Dot(uB), c = uA.Dot(r), f = uB.Dot(r);
+  f4 denom = 1.0f - dot * dot; // Not parallel: edge axis would be skipped
+  f4 s = MinF(MaxF((dot * f - c) / denom, -a.e[i]), a.e[i]);
+  f4 t = MinF(MaxF(dot * s + f, -b.e[j]), b.e[j]);
+  s = MinF(MaxF(dot * t - c, -a.e[i]), a.e[i]);
+
+  contact.point[0] = ((pA + uA * s) + (pB + uB * t)) * AHALF;
+  contact.depths[0] = contact.depth;
+  contact.count = 1u;
+
+} // end void EdgeContact(const Frame&, u1, const Frame&, u1, ...)            */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::ContactCache& dp::ContactCache::Clear(void)
+{
+  last.clear();
+  return *this;
+
+} // end ContactCache& ContactCache::Clear(void)                              */
+
+
+bool dp::ContactCache::Collide(u4 a, const OBB& boxA, u4 b, const OBB& boxB,
+  Manifold& contact)
+{
+  auto it = last.emplace(PairKey(a, b), u1(Manifold::AXES)).first;
+  if (a <= b) { return dp::Collide(boxA, boxB, contact, &it->second); }
+
+  // Cached axis numbers the lower handle's box first: test in that order
+  bool hit = dp::Collide(boxB, boxA, contact, &it->second);
+  contact.normal = -contact.normal;
+  contact.axis = SwapAxis(contact.axis);
+  return hit;
+
+} // end bool ContactCache::Collide(u4, const OBB&, u4, const OBB&, ...)      */
+
+
+dp::ContactCache& dp::ContactCache::Forget(u4 a, u4 b)
+{
+  last.erase(PairKey(a, b));
+  return *this;
+
+} // end ContactCache& ContactCache::Forget(u4, u4)                           */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Helper Functions                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+bool dp::Collide(const OBB& a, const OBB& b, Manifold& contact, u1* lastAxis)
+{
+  Frame fA(a), fB(b);
+  v3f d = fB.c - fA.c, n;
+  contact.count = 0u;
+  contact.tested = 0u;
+
+  // Coherence: last frame's separating axis most likely still separates
+  if (lastAxis && *lastAxis < Manifold::AXES)
+  {
+    f4 gap = Gap(*lastAxis, fA, fB, d, n);
+    contact.tested = 1u;
+    if (gap > 0.0f)
+    {
+      contact.normal = n;
+      contact.depth = -gap;
+      contact.axis = *lastAxis;
+      return false;
+    }
+  }
+
+  // All 15 axes: exit on any separating one, else keep the least penetration
+  f4 best = -INf;
+  u1 bestAxis = 0u;
+  v3f bestN;
+  for (u1 axis = 0u; axis < Manifold::AXES; ++axis)
+  {
+    f4 gap = Gap(axis, fA, fB, d, n);
+    ++contact.tested;
+    if (gap > 0.0f)
+    {
+      contact.normal = n;
+      contact.depth = -gap;
+      contact.axis = axis;
+      if (lastAxis) { *lastAxis = axis; }
+      return false;
+    }
+    if ((axis < 6u) ? (best < gap) : (best + EDGE_SLOP < gap))
+    {
+      best = gap;
+      bestAxis = axis;
+      bestN = n;
+    }
+  }
+  if (lastAxis) { *lastAxis = bestAxis; }
+  contact.normal = bestN;
+  contact.depth = -best;
+  contact.axis = bestAxis;
+
+  // Reference face pushes out toward the incident box: second's face faces a
+  if (bestAxis < 3u) { FaceContact(fA, bestAxis, fB, bestN, contact); }
+  else if (bestAxis < 6u)
+  {
+    FaceContact(fB, bestAxis - 3u, fA, -bestN, contact);
+  }
+  else
+  {
+    EdgeContact(fA, (bestAxis - 6u) / 3u, fB, (bestAxis - 6u) % 3u, bestN,
+      contact);
+  }
+  return true;
+
+} // end bool Collide(const OBB&, const OBB&, Manifold&, u1*)                 */
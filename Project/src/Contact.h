@@ -0,0 +1,186 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  Contact.h
+Purpose:  OBB / OBB separating axis test, building a contact manifold
+Details:  Two boxes are disjoint only if some axis separates their projections.
+  For boxes, 15 axes suffice: each box's 3 face normals, and the 9 cross
+  products of an edge direction from each box.  Rather than only answering
+  whether the boxes touch, the test keeps the axis of least penetration.  That
+  gives the contact normal and depth, and contact points follow from it:
+
+  - Face axis: the most anti-parallel face of the other (incident) box is
+    clipped to the side planes of the reference face, and clipped points under
+    the reference face are kept (reduced to the 4 spanning the widest area)
+  - Edge axis: the closest points of the 2 supporting edges give 1 contact
+
+  Face axes win ties against edge axes (within a small slop), keeping resting
+  contacts on faces, where a whole face of points holds a box stack steady.
+
+  Boxes move little between frames, so the axis separating a pair last frame
+  most likely still does.  Given the pair's last axis, it is tested first, so
+  a coherent separated pair exits after 1 axis instead of up to 15.  The
+  ContactCache keeps that axis per pair of handles, for a whole narrow phase.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <unordered_map>  // Last axis per pair, keyed by packed handles
+
+// "./src/..."
+#include "v3f.h"  // Contact normal / point members
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class OBB;  // Boxes tested against each other
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! Result of a box / box test: contact points, or the separating axis
+  struct Manifold
+  {
+    static const u1 AXES = 15u; //! SAT axes of 2 boxes (also: no axis known)
+
+    static const u4 POINTS = 4u; //! Most contact points kept per manifold
+
+    //! Contact point positions, midway between the 2 boxes' surfaces
+    v3f point[POINTS];
+
+    //! Penetration depth at each contact point
+    f4 depths[POINTS];
+
+    //! Unit normal from the first box toward the second (pushes second out)
+    v3f normal;
+
+    //! Least penetration over all axes (or, if separated: -gap along axis)
+    f4 depth;
+
+    //! Contact points found: 0 if the boxes are separated
+    u4 count;
+
+    //! Axis of least penetration (or the separating one): 0-2 first box's
+    //! faces, 3-5 second box's faces, 6 + 3*i + j first's edge i x second's j
+    u1 axis;
+
+    //! Count of axes tested before the result was known (1 for cached exits)
+    u1 tested;
+  };
+
+  //! Last separating (or least penetration) axis of each pair of boxes
+  class ContactCache
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Forget every pair's last axis
+    \brief
+      - forget every pair's last axis
+    \return
+      - reference to the emptied cache for easier subsequent inline action
+    */
+    ContactCache& Clear(void);
+
+
+    /** Test 2 boxes named by handles, starting from the pair's last axis
+    \brief
+      - test 2 boxes named by handles, starting from the pair's last axis
+    \details
+      - the pair is the same whichever order the handles come in; the result
+      is always from boxA toward boxB (axis numbered with boxA first)
+    \param a
+      - handle of the first box (e.g. its broadphase proxy)
+    \param boxA
+      - first box
+    \param b
+      - handle of the second box
+    \param boxB
+      - second box
+    \param contact
+      - manifold to be set from boxA toward boxB
+    \return
+      - true if the boxes touch
+    */
+    bool Collide(u4 a, const OBB& boxA, u4 b, const OBB& boxB,
+      Manifold& contact);
+
+
+    /** Get the count of pairs with a cached axis
+    \brief
+      - get the count of pairs with a cached axis
+    \return
+      - number of pairs tested and not since forgotten
+    */
+    inline u4 Count(void) const
+    { return static_cast<u4>(last.size()); } // end u4 ContactCache::Count    */
+
+
+    /** Forget a pair's last axis (e.g. once the broadphase drops the pair)
+    \brief
+      - forget a pair's last axis (e.g. once the broadphase drops the pair)
+    \param a
+      - handle of either box of the pair
+    \param b
+      - handle of the other box of the pair
+    \return
+      - reference to the modified cache for easier subsequent inline action
+    */
+    ContactCache& Forget(u4 a, u4 b);
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Last axis by packed handles (numbered with the lower handle first)
+    std::unordered_map<u8, u1> last;
+
+  }; // end ContactCache class declaration
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                      Helper Function Declarations                        */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  /** Test 2 boxes by separating axes, building their contact manifold
+  \brief
+    - test 2 boxes by separating axes, building their contact manifold
+  \details
+    - only reads the boxes' center, basis & half-extents, so safe to run
+    concurrently over shared boxes (each call with its own manifold / axis)
+  \param a
+    - first box
+  \param b
+    - second box
+  \param contact
+    - manifold to be set: points, normal & depth if touching, else the
+    separating axis & gap
+  \param lastAxis
+    - pair's axis from the prior test (tested first if < AXES), to be set to
+    this test's axis; ignored if null
+  \return
+    - true if the boxes touch
+  */
+  bool Collide(const OBB& a, const OBB& b, Manifold& contact,
+    u1* lastAxis = nullptr);
+
+} // end dp namespace
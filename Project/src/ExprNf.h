@@ -0,0 +1,513 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  ExprNf.h
+Purpose:  Lazily evaluated element-wise expressions of vNf's & mNf's
+Details:  vNf / mNf elements are heap allocated, so returning a new vector per
+  operator costs an allocation, a write & a later free per step of a chain:
+  a + b * s - c made 3 temporaries before reaching its destination.
+
+  Instead, +, -, unary -, scalar * & scalar / build small expression nodes
+  by value (no allocation): leaves point at operands' elements, & each node
+  holds its children.  Assigning a node to a vNf / mNf (or constructing from
+  one, or += / -= one) then runs the whole chain in a single loop, once per
+  element.  When every operand has the destination's size (the usual case)
+  that loop is branch free over contiguous elements, which the compiler
+  vectorizes; otherwise each leaf checks its bounds, reading 0 past its end.
+
+  Sizes follow the eager operators these replace:
+  - vNf: a chain is as long as its longest operand (shorter ones 0 extended)
+  - mNf: a chain is the size of its leftmost operand (others 0 extended or
+    truncated to fit)
+
+  Assignment is aliasing safe: elements only combine at the same subscript,
+  so a destination that is also an operand is read before it is written, &
+  a destination that must grow evaluates into its new cells before freeing
+  the old ones.  Nodes hold pointers to their operands' elements: evaluate
+  them within the statement that made them (don't keep them in auto).
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_MAT300_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <type_traits>  // Restricting operator templates to expression types
+// "./src/..."
+#include "Log.h"        // Warning of vector division by 0 requests
+#include "TypeErrata.h" // Platform primitive type aliases for easier porting
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Expression Nodes                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  //! Element combination of binary nodes & += assignment: sum
+  struct AddNf
+  {
+    static inline f4 Apply(f4 l, f4 r) { return l + r; }
+    static inline void Store(f4& out, f4 value) { out += value; }
+  };
+
+  //! Element combination of binary nodes & -= assignment: difference
+  struct SubNf
+  {
+    static inline f4 Apply(f4 l, f4 r) { return l - r; }
+    static inline void Store(f4& out, f4 value) { out -= value; }
+  };
+
+  //! Element combination of = assignment: replacement (out is never read)
+  struct SetNf
+  {
+    static inline void Store(f4& out, f4 value) { out = value; }
+  };
+
+
+  //! Vector expression base: E is the node type (for conversion from nodes)
+  template <typename E>
+  struct vExprNf
+  {
+    //! Get the node as its own type
+    inline const E& Self(void) const { return static_cast<const E&>(*this); }
+  };
+
+
+  //! Vector leaf: a vNf's elements, read as 0 past its end
+  struct vLeafNf : vExprNf<vLeafNf>
+  {
+    inline vLeafNf(const f4* elements, u4 dimensions)
+      : elem(elements), dimens(dimensions) { }
+
+    //! Get an element by subscript, 0 if past the end
+    inline f4 At(u4 i) const { return i < dimens ? elem[i] : 0.0f; }
+
+    //! Get the element count
+    inline u4 Dimens(void) const { return dimens; }
+
+    //! Get an element by subscript (must be under Dimens())
+    inline f4 Get(u4 i) const { return elem[i]; }
+
+    //! Check if every leaf has at least n elements (so Get() is safe to n)
+    inline bool Spans(u4 n) const { return dimens >= n; }
+
+    const f4* elem; //! Operand's elements
+    u4 dimens;      //! Operand's element count
+  };
+
+
+  //! Vector binary node: l op r, as long as the longer of the 2
+  template <typename L, typename R, typename Op>
+  struct vBinaryNf : vExprNf<vBinaryNf<L, R, Op>>
+  {
+    inline vBinaryNf(const L& left, const R& right) : l(left), r(right) { }
+
+    inline f4 At(u4 i) const { return Op::Apply(l.At(i), r.At(i)); }
+
+    inline u4 Dimens(void) const
+    {
+      u4 a = l.Dimens(), b = r.Dimens();
+      return a < b ? b : a;
+    }
+
+    inline f4 Get(u4 i) const { return Op::Apply(l.Get(i), r.Get(i)); }
+
+    inline bool Spans(u4 n) const { return l.Spans(n) && r.Spans(n); }
+
+    L l; //! Left operand node
+    R r; //! Right operand node
+  };
+
+
+  //! Vector scaled node: e * scalar
+  template <typename E>
+  struct vScaledNf : vExprNf<vScaledNf<E>>
+  {
+    inline vScaledNf(const E& expr, f4 scalar) : e(expr), s(scalar) { }
+
+    inline f4 At(u4 i) const { return e.At(i) * s; }
+
+    inline u4 Dimens(void) const { return e.Dimens(); }
+
+    inline f4 Get(u4 i) const { return e.Get(i) * s; }
+
+    inline bool Spans(u4 n) const { return e.Spans(n); }
+
+    E e;  //! Scaled operand node
+    f4 s; //! Scale
+  };
+
+
+  //! Vector negated node: -e, keeping 0's unsigned (as vNf's ! operator)
+  template <typename E>
+  struct vNegatedNf : vExprNf<vNegatedNf<E>>
+  {
+    inline explicit vNegatedNf(const E& expr) : e(expr) { }
+
+    inline f4 At(u4 i) const { return 0.0f - e.At(i); }
+
+    inline u4 Dimens(void) const { return e.Dimens(); }
+
+    inline f4 Get(u4 i) const { return 0.0f - e.Get(i); }
+
+    inline bool Spans(u4 n) const { return e.Spans(n); }
+
+    E e; //! Negated operand node
+  };
+
+
+  //! Matrix expression base: E is the node type (for conversion from nodes)
+  template <typename E>
+  struct mExprNf
+  {
+    //! Get the node as its own type
+    inline const E& Self(void) const { return static_cast<const E&>(*this); }
+  };
+
+
+  //! Matrix leaf: an mNf's column major cells, read as 0 outside it
+  struct mLeafNf : mExprNf<mLeafNf>
+  {
+    inline mLeafNf(const f4* cells, u4 dimensions, u4 columnStride)
+      : cell(cells), dimens(dimensions), stride(columnStride) { }
+
+    //! Get a cell by row & column, 0 if outside the matrix
+    inline f4 At(u4 r, u4 c) const
+    { return r < dimens && c < dimens ? cell[c * stride + r] : 0.0f; }
+
+    //! Get the N value / square dimensions
+    inline u4 Dimens(void) const { return dimens; }
+
+    //! Get a cell by flat subscript c * stride + r (padding cells are 0)
+    inline f4 Get(u4 i) const { return cell[i]; }
+
+    //! Check if every leaf is n x n (so all share 1 layout for Get())
+    inline bool Uniform(u4 n) const { return dimens == n; }
+
+    const f4* cell; //! Operand's cells
+    u4 dimens;      //! Operand's N value
+    u4 stride;      //! Operand's cells from 1 column's start to the next
+  };
+
+
+  //! Matrix binary node: l op r, the size of the left operand
+  template <typename L, typename R, typename Op>
+  struct mBinaryNf : mExprNf<mBinaryNf<L, R, Op>>
+  {
+    inline mBinaryNf(const L& left, const R& right) : l(left), r(right) { }
+
+    inline f4 At(u4 row, u4 c) const
+    { return Op::Apply(l.At(row, c), r.At(row, c)); }
+
+    inline u4 Dimens(void) const { return l.Dimens(); }
+
+    inline f4 Get(u4 i) const { return Op::Apply(l.Get(i), r.Get(i)); }
+
+    inline bool Uniform(u4 n) const { return l.Uniform(n) && r.Uniform(n); }
+
+    L l; //! Left operand node
+    R r; //! Right operand node
+  };
+
+
+  //! Matrix scaled node: e * scalar
+  template <typename E>
+  struct mScaledNf : mExprNf<mScaledNf<E>>
+  {
+    inline mScaledNf(const E& expr, f4 scalar) : e(expr), s(scalar) { }
+
+    inline f4 At(u4 r, u4 c) const { return e.At(r, c) * s; }
+
+    inline u4 Dimens(void) const { return e.Dimens(); }
+
+    inline f4 Get(u4 i) const { return e.Get(i) * s; }
+
+    inline bool Uniform(u4 n) const { return e.Uniform(n); }
+
+    E e;  //! Scaled operand node
+    f4 s; //! Scale
+  };
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                              Node Mappings                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! Node type an operand is held as: nodes as themselves (vNf.h maps vNf)
+  template <typename T>
+  struct vNodeNf
+  {
+    using type = T;
+    static inline const T& Make(const T& operand) { return operand; }
+  };
+
+  //! Node type an operand is held as: nodes as themselves (mNf.h maps mNf)
+  template <typename T>
+  struct mNodeNf
+  {
+    using type = T;
+    static inline const T& Make(const T& operand) { return operand; }
+  };
+
+  //! True for vector operands: vector nodes (& vNf, specialized in vNf.h)
+  template <typename T>
+  struct IsVecNf : std::is_base_of<vExprNf<T>, T> { };
+
+  //! True for matrix operands: matrix nodes (& mNf, specialized in mNf.h)
+  template <typename T>
+  struct IsMatNf : std::is_base_of<mExprNf<T>, T> { };
+
+  //! Vector node of an operand
+  template <typename T>
+  using vNodeOf = typename vNodeNf<T>::type;
+
+  //! Matrix node of an operand
+  template <typename T>
+  using mNodeOf = typename mNodeNf<T>::type;
+
+  //! Enabled (void) only if both operands are vector operands
+  template <typename L, typename R = L>
+  using IfVecNf = typename std::enable_if<IsVecNf<L>::value
+    && IsVecNf<R>::value>::type;
+
+  //! Enabled (void) only if both operands are matrix operands
+  template <typename L, typename R = L>
+  using IfMatNf = typename std::enable_if<IsMatNf<L>::value
+    && IsMatNf<R>::value>::type;
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                        Helper Operator Overloads                         */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  /** Get the (lazy) member-wise sum of 2 vector operands
+  \brief
+    - get the (lazy) member-wise sum of 2 vector operands
+  \param lhs
+    - left hand vNf or vector expression
+  \param rhs
+    - right hand vNf or vector expression
+  \return
+    - sum node, as long as the longer operand
+  */
+  template <typename L, typename R, typename = IfVecNf<L, R>>
+  inline vBinaryNf<vNodeOf<L>, vNodeOf<R>, AddNf> operator+(const L& lhs,
+    const R& rhs)
+  {
+    return vBinaryNf<vNodeOf<L>, vNodeOf<R>, AddNf>(vNodeNf<L>::Make(lhs),
+      vNodeNf<R>::Make(rhs));
+
+  } // end vBinaryNf<...> operator+(const L&, const R&)                       */
+
+
+  /** Get the (lazy) member-wise difference of 2 vector operands
+  \brief
+    - get the (lazy) member-wise difference of 2 vector operands
+  \param lhs
+    - left hand vNf or vector expression
+  \param rhs
+    - right hand vNf or vector expression
+  \return
+    - difference node, as long as the longer operand
+  */
+  template <typename L, typename R, typename = IfVecNf<L, R>>
+  inline vBinaryNf<vNodeOf<L>, vNodeOf<R>, SubNf> operator-(const L& lhs,
+    const R& rhs)
+  {
+    return vBinaryNf<vNodeOf<L>, vNodeOf<R>, SubNf>(vNodeNf<L>::Make(lhs),
+      vNodeNf<R>::Make(rhs));
+
+  } // end vBinaryNf<...> operator-(const L&, const R&)                       */
+
+
+  /** Get the (lazy) negation of a vector operand
+  \brief
+    - get the (lazy) negation of a vector operand
+  \param operand
+    - vNf or vector expression
+  \return
+    - negated node
+  */
+  template <typename E, typename = IfVecNf<E>>
+  inline vNegatedNf<vNodeOf<E>> operator-(const E& operand)
+  {
+    return vNegatedNf<vNodeOf<E>>(vNodeNf<E>::Make(operand));
+
+  } // end vNegatedNf<...> operator-(const E&)                                */
+
+
+  /** Get the (lazy) uniform scale of a vector operand
+  \brief
+    - get the (lazy) uniform scale of a vector operand
+  \param operand
+    - vNf or vector expression
+  \param scalar
+    - amount by which to multiply every element
+  \return
+    - scaled node
+  */
+  template <typename E, typename = IfVecNf<E>>
+  inline vScaledNf<vNodeOf<E>> operator*(const E& operand, f4 scalar)
+  {
+    return vScaledNf<vNodeOf<E>>(vNodeNf<E>::Make(operand), scalar);
+
+  } // end vScaledNf<...> operator*(const E&, f4)                             */
+
+
+  /** Left hand scalar multiplication scales each element of rhs uniformly
+  \brief
+    - left hand scalar multiplication scales each element of rhs uniformly
+  \param scalar
+    - amount by which to multiply every element
+  \param operand
+    - vNf or vector expression
+  \return
+    - scaled node
+  */
+  template <typename E, typename = IfVecNf<E>>
+  inline vScaledNf<vNodeOf<E>> operator*(f4 scalar, const E& operand)
+  {
+    return vScaledNf<vNodeOf<E>>(vNodeNf<E>::Make(operand), scalar);
+
+  } // end vScaledNf<...> operator*(f4, const E&)                             */
+
+
+  /** Get the (lazy) uniform division of a vector operand
+  \brief
+    - get the (lazy) uniform division of a vector operand
+  \param operand
+    - vNf or vector expression
+  \param divisor
+    - amount by which to divide every element (0 is ignored, scaling by 1)
+  \return
+    - node scaled by 1 / divisor
+  */
+  template <typename E, typename = IfVecNf<E>>
+  inline vScaledNf<vNodeOf<E>> operator/(const E& operand, f4 divisor)
+  {
+    if (divisor == 0.0f)
+    {
+      Log::Warn("vNf::operator/ - division by 0 request ignored");
+      divisor = 1.0f;
+    }
+    return vScaledNf<vNodeOf<E>>(vNodeNf<E>::Make(operand), 1.0f / divisor);
+
+  } // end vScaledNf<...> operator/(const E&, f4)                             */
+
+
+  /** Get the (lazy) member-wise sum of 2 matrix operands
+  \brief
+    - get the (lazy) member-wise sum of 2 matrix operands
+  \param lhs
+    - left hand mNf or matrix expression
+  \param rhs
+    - right hand mNf or matrix expression
+  \return
+    - sum node, the size of the left operand
+  */
+  template <typename L, typename R, typename = IfMatNf<L, R>>
+  inline mBinaryNf<mNodeOf<L>, mNodeOf<R>, AddNf> operator+(const L& lhs,
+    const R& rhs)
+  {
+    return mBinaryNf<mNodeOf<L>, mNodeOf<R>, AddNf>(mNodeNf<L>::Make(lhs),
+      mNodeNf<R>::Make(rhs));
+
+  } // end mBinaryNf<...> operator+(const L&, const R&)                       */
+
+
+  /** Get the (lazy) member-wise difference of 2 matrix operands
+  \brief
+    - get the (lazy) member-wise difference of 2 matrix operands
+  \param lhs
+    - left hand mNf or matrix expression
+  \param rhs
+    - right hand mNf or matrix expression
+  \return
+    - difference node, the size of the left operand
+  */
+  template <typename L, typename R, typename = IfMatNf<L, R>>
+  inline mBinaryNf<mNodeOf<L>, mNodeOf<R>, SubNf> operator-(const L& lhs,
+    const R& rhs)
+  {
+    return mBinaryNf<mNodeOf<L>, mNodeOf<R>, SubNf>(mNodeNf<L>::Make(lhs),
+      mNodeNf<R>::Make(rhs));
+
+  } // end mBinaryNf<...> operator-(const L&, const R&)                       */
+
+
+  /** Get the (lazy) negation of a matrix operand
+  \brief
+    - get the (lazy) negation of a matrix operand
+  \param operand
+    - mNf or matrix expression
+  \return
+    - node of the operand scaled by -1
+  */
+  template <typename E, typename = IfMatNf<E>>
+  inline mScaledNf<mNodeOf<E>> operator-(const E& operand)
+  {
+    return mScaledNf<mNodeOf<E>>(mNodeNf<E>::Make(operand), -1.0f);
+
+  } // end mScaledNf<...> operator-(const E&)                                 */
+
+
+  /** Get the (lazy) uniform scale of a matrix operand
+  \brief
+    - get the (lazy) uniform scale of a matrix operand
+  \param operand
+    - mNf or matrix expression
+  \param scalar
+    - amount by which to multiply every cell
+  \return
+    - scaled node
+  */
+  template <typename E, typename = IfMatNf<E>>
+  inline mScaledNf<mNodeOf<E>> operator*(const E& operand, f4 scalar)
+  {
+    return mScaledNf<mNodeOf<E>>(mNodeNf<E>::Make(operand), scalar);
+
+  } // end mScaledNf<...> operator*(const E&, f4)                             */
+
+
+  /** Left hand scalar multiplication scales each cell of rhs uniformly
+  \brief
+    - left hand scalar multiplication scales each cell of rhs uniformly
+  \param scalar
+    - amount by which to multiply every cell
+  \param operand
+    - mNf or matrix expression
+  \return
+    - scaled node
+  */
+  template <typename E, typename = IfMatNf<E>>
+  inline mScaledNf<mNodeOf<E>> operator*(f4 scalar, const E& operand)
+  {
+    return mScaledNf<mNodeOf<E>>(mNodeNf<E>::Make(operand), scalar);
+
+  } // end mScaledNf<...> operator*(f4, const E&)                             */
+
+
+  /** Get the (lazy) uniform division of a matrix operand
+  \brief
+    - get the (lazy) uniform division of a matrix operand
+  \param operand
+    - mNf or matrix expression
+  \param divisor
+    - amount by which to divide every cell (multiplies by 1 / divisor)
+  \return
+    - node scaled by 1 / divisor
+  */
+  template <typename E, typename = IfMatNf<E>>
+  inline mScaledNf<mNodeOf<E>> operator/(const E& operand, f4 divisor)
+  {
+    return mScaledNf<mNodeOf<E>>(mNodeNf<E>::Make(operand), 1.0f / divisor);
+
+  } // end mScaledNf<...> operator/(const E&, f4)                             */
+
+} // end dp namespace
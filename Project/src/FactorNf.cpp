@@ -0,0 +1,487 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  FactorNf.cpp
+Purpose:  Reusable LU, Cholesky & QR factors of N-D matrices, for solving
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_MAT300_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <cfloat>     // Float epsilon, for pivots relative to the largest
+#include <cmath>      // Double precision square roots & logs of pivots
+// "./src/..."
+#include "FactorNf.h" // Class declaration header
+#include "Log.h"      // Invalid factor / singular solve warnings
+#include "mNf.h"      // Square matrices to factor, inverses to return
+#include "mNMf.h"     // N by M matrices to factor for least squares
+#include "Value.h"    // Basic numerical operations: abs, sqrt, near, swap
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace
+{
+  //! Get the magnitude at or under which a pivot counts as 0: a few float
+  //! epsilons (1 per dimension) of the largest pivot, as rounding is relative
+  f4 Tiny(f4 largest, u4 dimens)
+  {
+    return static_cast<f4>(dimens) * FLT_EPSILON * largest;
+  }
+
+  //! Get a vector's elements as exactly count values (0 extended / truncated)
+  std::vector<f4> Fit(const dp::vNf& b, u4 count)
+  {
+    std::vector<f4> values(count, 0.0f);
+    u4 shorter = MinU(count, b.Dimens());
+    for (u4 i = 0; i < shorter; ++i) { values[i] = b[i]; }
+    return values;
+  }
+
+  //! Solve for each of a set of vectors with a factor's single vector Solve
+  template <typename Factor>
+  std::vector<dp::vNf> SolveEach(const Factor& factor,
+    const std::vector<dp::vNf>& b)
+  {
+    std::vector<dp::vNf> x;
+    x.reserve(b.size());
+    for (u4 i = 0; i < b.size(); ++i) { x.push_back(factor.Solve(b[i])); }
+    return x;
+  }
+
+  //! Get the inverse matrix, solving for each standard basis vector
+  template <typename Factor>
+  dp::mNf Invert(const Factor& factor)
+  {
+    u4 n = factor.Dimens();
+    dp::mNf inverse(n, 0.0f);
+    dp::vNf basis(n);
+    for (u4 c = 0; c < n; ++c)
+    {
+      basis[c] = 1.0f;
+      inverse[c] = factor.Solve(basis);
+      basis[c] = 0.0f;
+    }
+    return inverse;
+  }
+
+} // end anonymous namespace
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::LUNf::LUNf(const mNf& matrix)
+  : factors(matrix.Cells()), pivot(matrix.Dimens()), sign(1.0f), tiny(0.0f)
+{
+  u4 n = Dimens();
+  for (u4 r = 0; r < n; ++r) { pivot[r] = r; }
+  for (u4 k = 0; k < n; ++k)
+  {
+    // Pivot on the largest magnitude cell at or below the trace
+    f4* ck = factors.Col(k);
+    u4 p = k;
+    for (u4 r = k + 1; r < n; ++r)
+    {
+      if (AbsF(ck[r]) > AbsF(ck[p])) { p = r; }
+    }
+    if (p != k)
+    {
+      for (u4 c = 0; c < n; ++c)
+      {
+        SwapF(factors.Col(c)[p], factors.Col(c)[k]);
+      }
+      u4 swap = pivot[p]; pivot[p] = pivot[k]; pivot[k] = swap;
+      sign = -sign;
+    }
+    if (ck[k] == 0.0f) { continue; } // Singular: nothing left to cancel
+
+    // L column: multipliers cancelling each row below the pivot
+    f4 reciprocal = 1.0f / ck[k];
+    for (u4 r = k + 1; r < n; ++r) { ck[r] *= reciprocal; }
+
+    // Update the trailing columns (contiguous, down each column)
+    for (u4 c = k + 1; c < n; ++c)
+    {
+      f4* cc = factors.Col(c);
+      f4 u = cc[k];
+      if (u == 0.0f) { continue; }
+      for (u4 r = k + 1; r < n; ++r) { cc[r] -= ck[r] * u; }
+    }
+  }
+  f4 largest = 0.0f; // Pivots count as 0 relative to the largest of them
+  for (u4 k = 0; k < n; ++k)
+  {
+    largest = MaxF(largest, AbsF(factors.Col(k)[k]));
+  }
+  tiny = Tiny(largest, n);
+
+} // end LUNf::LUNf(const mNf&)                                               */
+
+
+dp::CholeskyNf::CholeskyNf(const mNf& matrix)
+  : factors(matrix.Cells()), valid(true)
+{
+  u4 n = Dimens();
+  for (u4 k = 0; k < n; ++k)
+  {
+    f4* ck = factors.Col(k);
+    if (ck[k] <= 0.0f)
+    {
+      Log::Warn("CholeskyNf - matrix is not symmetric positive definite");
+      valid = false;
+      return;
+    }
+    // L column: scaled by the square root of the remaining pivot
+    f4 root = SqrtF(ck[k]);
+    f4 reciprocal = 1.0f / root;
+    ck[k] = root;
+    for (u4 r = k + 1; r < n; ++r) { ck[r] *= reciprocal; }
+
+    // Update the trailing lower triangle (contiguous, down each column)
+    for (u4 c = k + 1; c < n; ++c)
+    {
+      f4* cc = factors.Col(c);
+      f4 l = ck[c];
+      for (u4 r = c; r < n; ++r) { cc[r] -= ck[r] * l; }
+    }
+  }
+
+} // end CholeskyNf::CholeskyNf(const mNf&)                                   */
+
+
+dp::QRNf::QRNf(const mNf& matrix) : factors(matrix.Cells())
+{
+  Factor();
+
+} // end QRNf::QRNf(const mNf&)                                               */
+
+
+dp::QRNf::QRNf(const mNMf& matrix) : factors(matrix.Cells())
+{
+  Factor();
+
+} // end QRNf::QRNf(const mNMf&)                                              */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+f4 dp::LUNf::Det(void) const
+{
+  f8 det = sign;
+  for (u4 k = 0; k < Dimens(); ++k) { det *= factors.Col(k)[k]; }
+  return static_cast<f4>(det);
+
+} // end f4 LUNf::Det(void) const                                             */
+
+
+dp::mNf dp::LUNf::Inverse(void) const
+{
+  if (IsSingular()) { return nullmat; }
+  return Invert(*this);
+
+} // end mNf LUNf::Inverse(void) const                                        */
+
+
+bool dp::LUNf::IsSingular(void) const
+{
+  for (u4 k = 0; k < Dimens(); ++k)
+  {
+    if (AbsF(factors.Col(k)[k]) <= tiny) { return true; }
+  }
+  return false;
+
+} // end bool LUNf::IsSingular(void) const                                    */
+
+
+f8 dp::LUNf::LogDet(f4* detSign) const
+{
+  f8 log = 0.0;
+  f4 s = sign;
+  for (u4 k = 0; k < Dimens(); ++k)
+  {
+    f4 u = factors.Col(k)[k];
+    if (u == 0.0f)
+    {
+      if (detSign) { *detSign = 0.0f; }
+      return -INf;
+    }
+    if (u < 0.0f) { s = -s; }
+    log += std::log(static_cast<f8>(AbsF(u)));
+  }
+  if (detSign) { *detSign = s; }
+  return log;
+
+} // end f8 LUNf::LogDet(f4*) const                                           */
+
+
+dp::vNf dp::LUNf::Solve(const vNf& b) const
+{
+  u4 n = Dimens();
+  std::vector<f4> given = Fit(b, n), x(n);
+  for (u4 r = 0; r < n; ++r) { x[r] = given[pivot[r]]; } // P b
+
+  // Forward substitution: L y = P b (unit trace)
+  for (u4 k = 0; k < n; ++k)
+  {
+    const f4* ck = factors.Col(k);
+    for (u4 r = k + 1; r < n; ++r) { x[r] -= ck[r] * x[k]; }
+  }
+  // Back substitution: U x = y
+  for (u4 k = n; k-- > 0;)
+  {
+    const f4* ck = factors.Col(k);
+    if (AbsF(ck[k]) <= tiny)
+    {
+      Log::Warn("LUNf::Solve - matrix is singular");
+      return vNf(n);
+    }
+    x[k] /= ck[k];
+    for (u4 r = 0; r < k; ++r) { x[r] -= ck[r] * x[k]; }
+  }
+  return vNf(x);
+
+} // end vNf LUNf::Solve(const vNf&) const                                    */
+
+
+std::vector<dp::vNf> dp::LUNf::Solve(const std::vector<vNf>& b) const
+{
+  return SolveEach(*this, b);
+
+} // end vector<vNf> LUNf::Solve(const vector<vNf>&) const                    */
+
+
+f4 dp::CholeskyNf::Det(void) const
+{
+  if (!valid) { return 0.0f; }
+  f8 det = 1.0;
+  for (u4 k = 0; k < Dimens(); ++k) { det *= factors.Col(k)[k]; }
+  return static_cast<f4>(det * det);
+
+} // end f4 CholeskyNf::Det(void) const                                       */
+
+
+dp::mNf dp::CholeskyNf::Inverse(void) const
+{
+  if (!valid) { return nullmat; }
+  return Invert(*this);
+
+} // end mNf CholeskyNf::Inverse(void) const                                  */
+
+
+dp::vNf dp::CholeskyNf::Solve(const vNf& b) const
+{
+  u4 n = Dimens();
+  if (!valid)
+  {
+    Log::Warn("CholeskyNf::Solve - factor is invalid");
+    return vNf(n);
+  }
+  std::vector<f4> x = Fit(b, n);
+
+  // Forward substitution: L y = b
+  for (u4 k = 0; k < n; ++k)
+  {
+    const f4* ck = factors.Col(k);
+    x[k] /= ck[k];
+    for (u4 r = k + 1; r < n; ++r) { x[r] -= ck[r] * x[k]; }
+  }
+  // Back substitution: L^T x = y (L^T's rows are L's columns: contiguous)
+  for (u4 k = n; k-- > 0;)
+  {
+    const f4* ck = factors.Col(k);
+    f4 sum = x[k];
+    for (u4 r = k + 1; r < n; ++r) { sum -= ck[r] * x[r]; }
+    x[k] = sum / ck[k];
+  }
+  return vNf(x);
+
+} // end vNf CholeskyNf::Solve(const vNf&) const                              */
+
+
+std::vector<dp::vNf> dp::CholeskyNf::Solve(const std::vector<vNf>& b) const
+{
+  return SolveEach(*this, b);
+
+} // end vector<vNf> CholeskyNf::Solve(const vector<vNf>&) const              */
+
+
+f4 dp::QRNf::Det(void) const
+{
+  if (Rows() != Cols()) { return 0.0f; }
+  f8 det = 1.0;
+  for (u4 k = 0; k < Cols(); ++k)
+  {
+    det *= trace[k];
+    if (scale[k] != 0.0f) { det = -det; } // Each reflection has det -1
+  }
+  return static_cast<f4>(det);
+
+} // end f4 QRNf::Det(void) const                                             */
+
+
+bool dp::QRNf::IsRankDeficient(void) const
+{
+  for (u4 k = 0; k < Cols(); ++k)
+  {
+    if (AbsF(trace[k]) <= tiny) { return true; }
+  }
+  return false;
+
+} // end bool QRNf::IsRankDeficient(void) const                               */
+
+
+dp::vNf dp::QRNf::Solve(const vNf& b) const
+{
+  u4 m = Rows(), n = Cols(), steps = MinU(m, n);
+  std::vector<f4> y = Fit(b, m), x(n, 0.0f);
+
+  // y = Q^T b: apply each reflection in factoring order
+  for (u4 k = 0; k < steps; ++k)
+  {
+    if (scale[k] == 0.0f) { continue; }
+    const f4* v = factors.Col(k);
+    f8 dot = 0.0;
+    for (u4 r = k; r < m; ++r) { dot += v[r] * y[r]; }
+    f4 s = static_cast<f4>(dot) * scale[k];
+    for (u4 r = k; r < m; ++r) { y[r] -= s * v[r]; }
+  }
+  // Back substitution: R x = (Q^T b)'s first rows; dependent columns give 0
+  for (u4 k = steps; k-- > 0;)
+  {
+    if (AbsF(trace[k]) <= tiny) { continue; }
+    const f4* ck = factors.Col(k);
+    x[k] = y[k] / trace[k];
+    for (u4 r = 0; r < k; ++r) { y[r] -= ck[r] * x[k]; }
+  }
+  return vNf(x);
+
+} // end vNf QRNf::Solve(const vNf&) const                                    */
+
+
+std::vector<dp::vNf> dp::QRNf::Solve(const std::vector<vNf>& b) const
+{
+  return SolveEach(*this, b);
+
+} // end vector<vNf> QRNf::Solve(const vector<vNf>&) const                    */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+void dp::QRNf::Factor(void)
+{
+  u4 m = Rows(), n = Cols(), steps = MinU(m, n);
+  trace.assign(n, 0.0f);
+  scale.assign(n, 0.0f);
+  for (u4 k = 0; k < steps; ++k)
+  {
+    // Reflect column k's cells on & under the trace onto -sign(x) |x| e
+    f4* ck = factors.Col(k);
+    f8 normSq = 0.0;
+    for (u4 r = k; r < m; ++r) { normSq += static_cast<f8>(ck[r]) * ck[r]; }
+    if (normSq == 0.0) { continue; } // Already 0: dependent, not reflected
+    f4 norm = static_cast<f4>(std::sqrt(normSq));
+    f4 alpha = (ck[k] > 0.0f) ? -norm : norm; // Opposite sign: no cancelling
+    f8 first = ck[k], head = first - alpha;
+    ck[k] = static_cast<f4>(head); // v = x - alpha e, kept in place
+    trace[k] = alpha;
+    scale[k] = static_cast<f4>(2.0 / (normSq - first * first + head * head));
+
+    // Reflect the trailing columns: c -= v (scale v . c)
+    for (u4 c = k + 1; c < n; ++c)
+    {
+      f4* cc = factors.Col(c);
+      f8 dot = 0.0;
+      for (u4 r = k; r < m; ++r) { dot += static_cast<f8>(ck[r]) * cc[r]; }
+      f4 s = static_cast<f4>(dot) * scale[k];
+      for (u4 r = k; r < m; ++r) { cc[r] -= s * ck[r]; }
+    }
+  }
+  f4 largest = 0.0f;
+  for (u4 k = 0; k < n; ++k) { largest = MaxF(largest, AbsF(trace[k])); }
+  tiny = Tiny(largest, MaxU(m, n));
+
+} // end void QRNf::Factor(void)                                              */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Helper Functions                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+u4 dp::FactorNfCheck(u4 dimens, f8* error)
+{
+  // Fixed seed linear congruential generator: repeatable runs to compare
+  u4 seed = 0x2545F491u;
+  auto random = [&seed](void)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    return static_cast<f4>(seed >> 8) * (1.0f / 16777216.0f) - 0.5f;
+  };
+
+  // Solve A x = b for a known x by LU & QR: tally failures & the worst miss
+  u4 failed = 0u;
+  f8 worst = 0.0;
+  auto solves = [&](const mNf& a)
+  {
+    u4 n = a.Dimens();
+    vNf x(n);
+    for (u4 i = 0; i < n; ++i) { x[i] = random(); }
+    vNf b = a * x;
+    LUNf lu(a);
+    QRNf qr(a);
+    if (lu.IsSingular()) { ++failed; }
+    if (qr.IsRankDeficient()) { ++failed; }
+    vNf xLU = lu.Solve(b), xQR = qr.Solve(b);
+    f8 miss = 0.0;
+    for (u4 i = 0; i < n; ++i)
+    {
+      miss = MaxD(miss, std::abs(static_cast<f8>(xLU[i]) - x[i]));
+      miss = MaxD(miss, std::abs(static_cast<f8>(xQR[i]) - x[i]));
+    }
+    if (1e-3 < miss) { ++failed; } // Well conditioned: a few float ulps off
+    worst = MaxD(worst, miss);
+  };
+
+  // Scaled identity: det 1e-10 is tiny, yet every pivot is as large as any
+  mNf scaled(10u, 0.1f);
+  solves(scaled);
+  f4 sign = 0.0f;
+  f8 log = LUNf(scaled).LogDet(&sign);
+  if (sign != 1.0f || 1e-4 < std::abs(log - 10.0 * std::log(0.1))) { ++failed; }
+
+  // Diagonally dominant: well conditioned at any size
+  mNf dominant(dimens, 0.0f);
+  for (u4 c = 0; c < dimens; ++c)
+  {
+    for (u4 r = 0; r < dimens; ++r) { dominant[c][r] = random(); }
+    dominant[c][c] += AHALF * static_cast<f4>(dimens) + 1.0f;
+  }
+  solves(dominant);
+
+  // 2 equal columns: singular / rank deficient, whatever the rounding
+  if (1u < dimens)
+  {
+    dominant[1] = dominant[0];
+    if (!LUNf(dominant).IsSingular()) { ++failed; }
+    if (!QRNf(dominant).IsRankDeficient()) { ++failed; }
+  }
+
+  if (error) { *error = worst; }
+  return failed;
+
+} // end u4 FactorNfCheck(u4, f8*)                                            */
@@ -0,0 +1,417 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  FactorNf.h
+Purpose:  Reusable LU, Cholesky & QR factors of N-D matrices, for solving
+Details:  Elimination on an augmented matrix redoes all O(N^3) work for each
+  new set of right hand sides.  Factoring once keeps that work: each solve
+  afterwards is only O(N^2) triangular substitution, and the determinant &
+  inverse come straight from the factors.
+
+  - LUNf: P A = L U by partial (row) pivoting; any square matrix
+  - CholeskyNf: A = L L^T; symmetric positive definite matrices only, at half
+    the work of LU, and needing no pivoting
+  - QRNf: A = Q R by Householder reflections; N by M (rows >= columns), where
+    solving gives the least squares fit (min |A x - b|) of overdetermined data
+
+  Factors are held column major in a cellNf, as mNf / mNMf cells are, so the
+  inner loops of factoring & solving run down contiguous columns.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_MAT300_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <vector>       // Row permutation, sets of right hand side vectors
+// "./src/..."
+#include "cellNf.h"     // Contiguous, aligned column major factor storage
+#include "TypeErrata.h" // Platform primitive type aliases for easier porting
+#include "vNf.h"        // Right hand side & solution vectors
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class mNf;  // Square matrices to factor / inverses to return
+  class mNMf; // N by M matrices to factor for least squares
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  class LUNf //! Partial pivoted [L]ower * [U]pper factors of a[N]y [f]loat mat
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Factor a square matrix into row permuted lower & upper triangles
+    \brief
+      - factor a square matrix into row permuted lower & upper triangles
+    \details
+      - each column pivots on its largest magnitude cell at or under the trace
+    \param matrix
+      - square matrix to factor (a 0 pivot leaves the factors singular)
+    */
+    LUNf(const mNf& matrix);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the determinant of the factored matrix: +/- product of U's trace
+    \brief
+      - get the determinant of the factored matrix: +/- product of U's trace
+    \return
+      - determinant, negated once per row swap made while pivoting
+    */
+    f4 Det(void) const;
+
+
+    /** Get the N value / square dimensions of the factored matrix
+    \brief
+      - get the N value / square dimensions of the factored matrix
+    \return
+      - element count in rows or columns of the factored matrix
+    */
+    inline u4 Dimens(void) const
+    { return factors.Cols(); } // end u4 LUNf::Dimens(void) const             */
+
+
+    /** Get the inverse of the factored matrix, solving for each basis vector
+    \brief
+      - get the inverse of the factored matrix, solving for each basis vector
+    \return
+      - inverse matrix, or nullmat if the factored matrix was singular
+    */
+    mNf Inverse(void) const;
+
+
+    /** Check if the factored matrix is non-invertible (a pivot near 0)
+    \brief
+      - check if the factored matrix is non-invertible (a pivot near 0)
+    \details
+      - a pivot counts as 0 at or under N float epsilons of the largest one,
+      so the test scales with the matrix (0.1 I is as invertible as I)
+    \return
+      - true if the factored matrix has no inverse, otherwise false
+    */
+    bool IsSingular(void) const;
+
+
+    /** Get the log magnitude & sign of the determinant, at any size or scale
+    \brief
+      - get the log magnitude & sign of the determinant, at any size or scale
+    \details
+      - Det()'s product leaves float range for large N (0.1 I at N = 50 has a
+      determinant of 1e-50); the sum of the pivots' logs does not
+    \param detSign
+      - set to the determinant's sign (-1, 0 or 1), if given
+    \return
+      - natural log of |determinant|, or -INf if a pivot is exactly 0
+    */
+    f8 LogDet(f4* detSign = nullptr) const;
+
+
+    /** Solve (factored matrix) * x = b for x
+    \brief
+      - solve (factored matrix) * x = b for x
+    \param b
+      - right hand side vector (shorter is 0 extended, longer is truncated)
+    \return
+      - solution vector x, or all 0's if the factored matrix was singular
+    */
+    vNf Solve(const vNf& b) const;
+
+
+    /** Solve (factored matrix) * x = b for x, for each of a set of b vectors
+    \brief
+      - solve (factored matrix) * x = b for x, for each of a set of b vectors
+    \param b
+      - set of right hand side vectors, each solved without refactoring
+    \return
+      - solution vector x for each b, in order
+    */
+    std::vector<vNf> Solve(const std::vector<vNf>& b) const;
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! U on & above the trace; L (unit trace implied) below it
+    cellNf factors;
+
+    //! Source row of each factored row: row r of P A is row pivot[r] of A
+    std::vector<u4> pivot;
+
+    //! Determinant sign of the permutation: -1 if odd row swaps, else 1
+    f4 sign;
+
+    //! Pivot magnitude at or under which U's trace cells count as 0
+    f4 tiny;
+
+  }; // end LUNf class declaration
+
+
+  class CholeskyNf //! Symmetric positive definite A = L L^T factor of a[N]y f
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Factor a symmetric positive definite matrix into L * L^T
+    \brief
+      - factor a symmetric positive definite matrix into L * L^T
+    \details
+      - only the lower triangle (& trace) of the matrix is read: symmetry is
+      assumed, not checked.  A non-positive pivot means the matrix is not
+      positive definite: the factor is left invalid (see IsValid)
+    \param matrix
+      - symmetric positive definite square matrix to factor
+    */
+    CholeskyNf(const mNf& matrix);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the determinant of the factored matrix: (product of L's trace)^2
+    \brief
+      - get the determinant of the factored matrix: (product of L's trace)^2
+    \return
+      - determinant, or 0 if the factor is invalid
+    */
+    f4 Det(void) const;
+
+
+    /** Get the N value / square dimensions of the factored matrix
+    \brief
+      - get the N value / square dimensions of the factored matrix
+    \return
+      - element count in rows or columns of the factored matrix
+    */
+    inline u4 Dimens(void) const
+    { return factors.Cols(); } // end u4 CholeskyNf::Dimens(void) const       */
+
+
+    /** Get the inverse of the factored matrix, solving for each basis vector
+    \brief
+      - get the inverse of the factored matrix, solving for each basis vector
+    \return
+      - inverse matrix, or nullmat if the factor is invalid
+    */
+    mNf Inverse(void) const;
+
+
+    /** Check if the matrix was symmetric positive definite, & so factored
+    \brief
+      - check if the matrix was symmetric positive definite, & so factored
+    \return
+      - true if the factor may be used, false if factoring hit a pivot <= 0
+    */
+    inline bool IsValid(void) const
+    { return valid; } // end bool CholeskyNf::IsValid(void) const             */
+
+
+    /** Solve (factored matrix) * x = b for x
+    \brief
+      - solve (factored matrix) * x = b for x
+    \param b
+      - right hand side vector (shorter is 0 extended, longer is truncated)
+    \return
+      - solution vector x, or all 0's if the factor is invalid
+    */
+    vNf Solve(const vNf& b) const;
+
+
+    /** Solve (factored matrix) * x = b for x, for each of a set of b vectors
+    \brief
+      - solve (factored matrix) * x = b for x, for each of a set of b vectors
+    \param b
+      - set of right hand side vectors, each solved without refactoring
+    \return
+      - solution vector x for each b, in order
+    */
+    std::vector<vNf> Solve(const std::vector<vNf>& b) const;
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! L on & below the trace (cells above the trace are unused)
+    cellNf factors;
+
+    //! False if the matrix was not positive definite (factors are partial)
+    bool valid;
+
+  }; // end CholeskyNf class declaration
+
+
+  class QRNf //! Householder [Q]rthogonal * upper t[R]iangle factors, N by M f
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Factor a square matrix into orthogonal Q * upper triangular R
+    \brief
+      - factor a square matrix into orthogonal Q * upper triangular R
+    \param matrix
+      - square matrix to factor
+    */
+    QRNf(const mNf& matrix);
+
+
+    /** Factor an N by M matrix into orthogonal Q * upper triangular R
+    \brief
+      - factor an N by M matrix into orthogonal Q * upper triangular R
+    \details
+      - rows should be at least columns (overdetermined): with fewer rows,
+      only the first (rows) columns are factored, and the rest solve to 0
+    \param matrix
+      - N by M matrix to factor
+    */
+    QRNf(const mNMf& matrix);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the number of columns of the factored matrix
+    \brief
+      - get the number of columns of the factored matrix
+    \return
+      - element count in each row of the factored matrix
+    */
+    inline u4 Cols(void) const
+    { return factors.Cols(); } // end u4 QRNf::Cols(void) const               */
+
+
+    /** Get the determinant of a factored square matrix: +/- product of R's
+    \brief
+      - get the determinant of a factored square matrix: +/- product of R's
+    \details
+      - each reflection negates the determinant; only square matrices have 1
+    \return
+      - determinant, or 0 if the factored matrix was not square
+    */
+    f4 Det(void) const;
+
+
+    /** Check if R has a (near) 0 on its trace: columns not independent
+    \brief
+      - check if R has a (near) 0 on its trace: columns not independent
+    \details
+      - as LUNf::IsSingular, relative to the largest magnitude on R's trace
+    \return
+      - true if the columns of the factored matrix are linearly dependent
+    */
+    bool IsRankDeficient(void) const;
+
+
+    /** Get the number of rows of the factored matrix
+    \brief
+      - get the number of rows of the factored matrix
+    \return
+      - element count in each column of the factored matrix
+    */
+    inline u4 Rows(void) const
+    { return factors.Rows(); } // end u4 QRNf::Rows(void) const               */
+
+
+    /** Solve for x minimizing |(factored matrix) * x - b| (least squares)
+    \brief
+      - solve for x minimizing |(factored matrix) * x - b| (least squares)
+    \details
+      - exact solution for square, invertible matrices.  Columns with a 0 on
+      R's trace (dependent columns) solve to 0
+    \param b
+      - right hand side vector of Rows() elements (0 extended / truncated)
+    \return
+      - solution vector x of Cols() elements
+    */
+    vNf Solve(const vNf& b) const;
+
+
+    /** Solve least squares x for each of a set of b vectors
+    \brief
+      - solve least squares x for each of a set of b vectors
+    \param b
+      - set of right hand side vectors, each solved without refactoring
+    \return
+      - least squares solution vector x for each b, in order
+    */
+    std::vector<vNf> Solve(const std::vector<vNf>& b) const;
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                           Private Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Reflect each column in turn, leaving R above & Householder vectors below
+    \brief
+      - reflect each column in turn, leaving R above & Householder vectors below
+    */
+    void Factor(void);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! R above the trace; each column's Householder vector on & below it
+    cellNf factors;
+
+    //! Trace of R (the trace cells hold Householder vectors' first elements)
+    std::vector<f4> trace;
+
+    //! Reflection scale of each column: 2 / (v . v), or 0 if not reflected
+    std::vector<f4> scale;
+
+    //! Magnitude at or under which R's trace cells count as 0
+    f4 tiny;
+
+  }; // end QRNf class declaration
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                      Helper Function Declarations                        */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  /** Check the LU & QR singularity tests & solves on scaled, well posed data
+  \brief
+    - check the LU & QR singularity tests & solves on scaled, well posed data
+  \details
+    - 10 x 10 0.1 I, & a random diagonally dominant matrix of the given size,
+    must both factor as invertible / full rank & solve back to a known x; a
+    matrix with 2 equal columns must factor as singular / rank deficient
+  \param dimens
+    - row & column count of the random, well conditioned matrix
+  \param error
+    - largest solved element's distance from the known x, to be set if given
+  \return
+    - count of failed checks: 0 if all passed
+  */
+  u4 FactorNfCheck(u4 dimens = 500u, f8* error = nullptr);
+
+} // end dp namespace
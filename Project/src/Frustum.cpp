@@ -0,0 +1,342 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  Frustum.cpp
+Purpose:  6 plane view volume, classifying bounding volumes for culling
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <std>
+#include <xmmintrin.h>  // SSE 4-wide float lanes
+#if defined(__AVX__)
+#include <immintrin.h>  // AVX 8-wide float lanes
+#endif
+
+// "./src/..."
+#include "AABB.h"         // Box center & half-extents
+#include "AABBCompact.h"  // <min, max> boxes, single & batched
+#include "BSphere.h"      // Sphere center & radius
+#include "Frustum.h"      // Class declaration header
+#include "OBB.h"          // Oriented box center, axes & half-extents
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+//! Set the side of each box of a block from its outside / cutting lane masks
+static inline void Sort(u4 out, u4 cut, u4 first, u4 last,
+  std::vector<dp::Frustum::Side>& sides)
+{
+  for (u4 k = 0u; first + k < last; ++k, out >>= 1u, cut >>= 1u)
+  {
+    sides[first + k] = (out & 1u) ? dp::Frustum::Side::Outside
+      : (cut & 1u) ? dp::Frustum::Side::Intersect : dp::Frustum::Side::Inside;
+  }
+
+} // end void Sort(u4, u4, u4, u4, vector<Side>&)                             */
+
+
+//! Push the index of each set bit of a lane mask, from a block's 1st index
+static inline void Push(u4 mask, u4 first, std::vector<u4>& found)
+{
+  for (u4 k = 0u; mask; ++k, mask >>= 1u)
+  {
+    if (mask & 1u) { found.push_back(first + k); }
+  }
+
+} // end void Push(u4, u4, vector<u4>&)                                       */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::Frustum::Frustum(void)
+{
+  for (u1 i = PLANES; i < LANES; ++i) // Padding: nothing is in front of these
+  {
+    nx[i] = ny[i] = nz[i] = 0.0f;
+    sum[i] = INf;
+  }
+  for (u1 i = 0u; i < PLANES; ++i) // Planes set: as far out as can be placed
+  {
+    Set(static_cast<Face>(i), Plane(Z_HAT, f4_MAX));
+  }
+
+} // end Frustum::Frustum(void)                                               */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::Frustum::Side dp::Frustum::Classify(const AABB& box, u1* mask) const
+{
+  v3f e(box.HalfExt());
+  v3f axes[3] = { v3f(e.x, 0.0f, 0.0f), v3f(0.0f, e.y, 0.0f),
+    v3f(0.0f, 0.0f, e.z) };
+  return Test(box.Mid(), 0.0f, axes, mask);
+
+} // end Side Frustum::Classify(const AABB&, u1*) const                       */
+
+
+dp::Frustum::Side dp::Frustum::Classify(const AABBCompact& box, u1* mask)
+  const
+{
+  if (box.IsEmpty()) { return Side::Outside; }
+  v3f e(box.Extent() * AHALF);
+  v3f axes[3] = { v3f(e.x, 0.0f, 0.0f), v3f(0.0f, e.y, 0.0f),
+    v3f(0.0f, 0.0f, e.z) };
+  return Test(box.Center(), 0.0f, axes, mask);
+
+} // end Side Frustum::Classify(const AABBCompact&, u1*) const                */
+
+
+dp::Frustum::Side dp::Frustum::Classify(const BSphere& sphere, u1* mask) const
+{
+  return Test(sphere.Center(), sphere.Radius(), nullptr, mask);
+
+} // end Side Frustum::Classify(const BSphere&, u1*) const                    */
+
+
+dp::Frustum::Side dp::Frustum::Classify(const OBB& box, u1* mask) const
+{
+  v3f e(box.HalfExt());
+  v3f axes[3] = { box.LocalX() * e.x, box.LocalY() * e.y,
+    box.LocalZ() * e.z };
+  return Test(box.Center(), 0.0f, axes, mask);
+
+} // end Side Frustum::Classify(const OBB&, u1*) const                        */
+
+
+u4 dp::Frustum::Classify(const AABBSoA& boxes, std::vector<Side>& sides) const
+{
+  return Cull(boxes, &sides, nullptr);
+
+} // end u4 Frustum::Classify(const AABBSoA&, vector<Side>&) const            */
+
+
+u4 dp::Frustum::Classify(const BSphere* spheres, u4 count,
+  std::vector<Side>& sides) const
+{
+  sides.resize(count);
+  u4 visible = 0u;
+  for (u4 i = 0u; i < count; ++i)
+  {
+    sides[i] = Classify(spheres[i]);
+    if (sides[i] != Side::Outside) { ++visible; }
+  }
+  return visible;
+
+} // end u4 Frustum::Classify(const BSphere*, u4, vector<Side>&) const        */
+
+
+u4 dp::Frustum::Classify(const OBB* boxes, u4 count,
+  std::vector<Side>& sides) const
+{
+  sides.resize(count);
+  u4 visible = 0u;
+  for (u4 i = 0u; i < count; ++i)
+  {
+    sides[i] = Classify(boxes[i]);
+    if (sides[i] != Side::Outside) { ++visible; }
+  }
+  return visible;
+
+} // end u4 Frustum::Classify(const OBB*, u4, vector<Side>&) const            */
+
+
+dp::Frustum& dp::Frustum::Set(Face face, const Plane& bound)
+{
+  u1 i = static_cast<u1>(face);
+  plane[i].Set(bound);
+  nx[i] = plane[i].Normal().x;
+  ny[i] = plane[i].Normal().y;
+  nz[i] = plane[i].Normal().z;
+  sum[i] = plane[i].Sum();
+  return *this;
+
+} // end Frustum& Frustum::Set(Face, const Plane&)                            */
+
+
+u4 dp::Frustum::Visible(const AABBSoA& boxes, std::vector<u4>& found) const
+{
+  return Cull(boxes, nullptr, &found);
+
+} // end u4 Frustum::Visible(const AABBSoA&, vector<u4>&) const               */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+u4 dp::Frustum::Cull(const AABBSoA& boxes, std::vector<Side>* sides,
+  std::vector<u4>* found) const
+{
+  u4 count = boxes.Count(), padded = boxes.Padded(), visible = 0u;
+  if (sides) { sides->resize(count); }
+  if (found) { found->clear(); }
+  const f4* low[3] = { boxes.Mins(0u), boxes.Mins(1u), boxes.Mins(2u) };
+  const f4* high[3] = { boxes.Maxs(0u), boxes.Maxs(1u), boxes.Maxs(2u) };
+
+  // Each plane's terms are broadcast once; each block of boxes then takes
+  // its center & half-extents, and is tested 1 plane at a time.  Padding &
+  // empty boxes (min past max) are marked outside outright
+#if defined(__AVX__)
+  const u4 width = 8u;
+  __m256 px[PLANES], py[PLANES], pz[PLANES], ps[PLANES];
+  __m256 ax[PLANES], ay[PLANES], az[PLANES];
+  __m256 sign = _mm256_set1_ps(-0.0f), half = _mm256_set1_ps(0.5f);
+  for (u1 p = 0u; p < PLANES; ++p)
+  {
+    px[p] = _mm256_set1_ps(nx[p]);
+    py[p] = _mm256_set1_ps(ny[p]);
+    pz[p] = _mm256_set1_ps(nz[p]);
+    ps[p] = _mm256_set1_ps(sum[p]);
+    ax[p] = _mm256_andnot_ps(sign, px[p]);
+    ay[p] = _mm256_andnot_ps(sign, py[p]);
+    az[p] = _mm256_andnot_ps(sign, pz[p]);
+  }
+  for (u4 first = 0u; first < padded; first += width)
+  {
+    __m256 c[3], e[3];
+    __m256 valid = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    for (u4 a = 0u; a < 3u; ++a)
+    {
+      __m256 lo = _mm256_loadu_ps(low[a] + first);
+      __m256 hi = _mm256_loadu_ps(high[a] + first);
+      c[a] = _mm256_mul_ps(_mm256_add_ps(lo, hi), half);
+      e[a] = _mm256_mul_ps(_mm256_sub_ps(hi, lo), half);
+      valid = _mm256_and_ps(valid, _mm256_cmp_ps(lo, hi, _CMP_LE_OQ));
+    }
+    __m256 out = _mm256_setzero_ps(), cut = out;
+    for (u1 p = 0u; p < PLANES; ++p)
+    {
+      __m256 d = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(
+        _mm256_mul_ps(px[p], c[0]), _mm256_mul_ps(py[p], c[1])),
+        _mm256_mul_ps(pz[p], c[2])), ps[p]);
+      __m256 r = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax[p], e[0]),
+        _mm256_mul_ps(ay[p], e[1])), _mm256_mul_ps(az[p], e[2]));
+      out = _mm256_or_ps(out, _mm256_cmp_ps(d, r, _CMP_GT_OQ));
+      cut = _mm256_or_ps(cut, _mm256_cmp_ps(d, _mm256_xor_ps(r, sign),
+        _CMP_GE_OQ));
+    }
+    u4 o = static_cast<u4>(_mm256_movemask_ps(_mm256_or_ps(out,
+      _mm256_xor_ps(valid, _mm256_castsi256_ps(_mm256_set1_epi32(-1))))));
+    u4 k = static_cast<u4>(_mm256_movemask_ps(cut));
+#else
+  const u4 width = 4u;
+  __m128 px[PLANES], py[PLANES], pz[PLANES], ps[PLANES];
+  __m128 ax[PLANES], ay[PLANES], az[PLANES];
+  __m128 sign = _mm_set1_ps(-0.0f), half = _mm_set1_ps(0.5f);
+  for (u1 p = 0u; p < PLANES; ++p)
+  {
+    px[p] = _mm_set1_ps(nx[p]);
+    py[p] = _mm_set1_ps(ny[p]);
+    pz[p] = _mm_set1_ps(nz[p]);
+    ps[p] = _mm_set1_ps(sum[p]);
+    ax[p] = _mm_andnot_ps(sign, px[p]);
+    ay[p] = _mm_andnot_ps(sign, py[p]);
+    az[p] = _mm_andnot_ps(sign, pz[p]);
+  }
+  for (u4 first = 0u; first < padded; first += width)
+  {
+    __m128 c[3], e[3];
+    __m128 valid = _mm_cmpeq_ps(half, half); // All set
+    for (u4 a = 0u; a < 3u; ++a)
+    {
+      __m128 lo = _mm_loadu_ps(low[a] + first);
+      __m128 hi = _mm_loadu_ps(high[a] + first);
+      c[a] = _mm_mul_ps(_mm_add_ps(lo, hi), half);
+      e[a] = _mm_mul_ps(_mm_sub_ps(hi, lo), half);
+      valid = _mm_and_ps(valid, _mm_cmple_ps(lo, hi));
+    }
+    __m128 out = _mm_setzero_ps(), cut = out;
+    for (u1 p = 0u; p < PLANES; ++p)
+    {
+      __m128 d = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(px[p], c[0]),
+        _mm_mul_ps(py[p], c[1])), _mm_mul_ps(pz[p], c[2])), ps[p]);
+      __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax[p], e[0]),
+        _mm_mul_ps(ay[p], e[1])), _mm_mul_ps(az[p], e[2]));
+      out = _mm_or_ps(out, _mm_cmpgt_ps(d, r));
+      cut = _mm_or_ps(cut, _mm_cmpge_ps(d, _mm_xor_ps(r, sign)));
+    }
+    u4 o = static_cast<u4>(_mm_movemask_ps(_mm_andnot_ps(valid,
+      _mm_cmpeq_ps(half, half)))) | static_cast<u4>(_mm_movemask_ps(out));
+    u4 k = static_cast<u4>(_mm_movemask_ps(cut));
+#endif
+    u4 in = ~o & ((1u << width) - 1u);
+    for (u4 m = in; m; m &= m - 1u) { ++visible; }
+    if (sides) { Sort(o, k, first, MinU(first + width, count), *sides); }
+    if (found) { Push(in, first, *found); }
+  }
+  return visible;
+
+} // end u4 Frustum::Cull(const AABBSoA&, vector<Side>*, vector<u4>*) const   */
+
+
+dp::Frustum::Side dp::Frustum::Test(const v3f& center, f4 radius,
+  const v3f* axes, u1* mask) const
+{
+  u4 out = 0u, cut = 0u;
+
+  // Lanes are planes here: every plane's distance & radius at once
+#if defined(__AVX__)
+  __m256 x = _mm256_loadu_ps(nx), y = _mm256_loadu_ps(ny);
+  __m256 z = _mm256_loadu_ps(nz), sign = _mm256_set1_ps(-0.0f);
+  __m256 d = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(
+    _mm256_mul_ps(x, _mm256_set1_ps(center.x)),
+    _mm256_mul_ps(y, _mm256_set1_ps(center.y))),
+    _mm256_mul_ps(z, _mm256_set1_ps(center.z))), _mm256_loadu_ps(sum));
+  __m256 r = _mm256_set1_ps(radius);
+  for (u4 a = 0u; axes && a < 3u; ++a)
+  {
+    r = _mm256_add_ps(r, _mm256_andnot_ps(sign, _mm256_add_ps(_mm256_add_ps(
+      _mm256_mul_ps(x, _mm256_set1_ps(axes[a].x)),
+      _mm256_mul_ps(y, _mm256_set1_ps(axes[a].y))),
+      _mm256_mul_ps(z, _mm256_set1_ps(axes[a].z)))));
+  }
+  out = static_cast<u4>(_mm256_movemask_ps(_mm256_cmp_ps(d, r, _CMP_GT_OQ)));
+  cut = static_cast<u4>(_mm256_movemask_ps(_mm256_cmp_ps(d,
+    _mm256_xor_ps(r, sign), _CMP_GE_OQ)));
+#else
+  __m128 sign = _mm_set1_ps(-0.0f);
+  for (u4 first = 0u; first < LANES; first += 4u)
+  {
+    __m128 x = _mm_loadu_ps(nx + first), y = _mm_loadu_ps(ny + first);
+    __m128 z = _mm_loadu_ps(nz + first);
+    __m128 d = _mm_sub_ps(_mm_add_ps(_mm_add_ps(
+      _mm_mul_ps(x, _mm_set1_ps(center.x)),
+      _mm_mul_ps(y, _mm_set1_ps(center.y))),
+      _mm_mul_ps(z, _mm_set1_ps(center.z))), _mm_loadu_ps(sum + first));
+    __m128 r = _mm_set1_ps(radius);
+    for (u4 a = 0u; axes && a < 3u; ++a)
+    {
+      r = _mm_add_ps(r, _mm_andnot_ps(sign, _mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(x, _mm_set1_ps(axes[a].x)),
+        _mm_mul_ps(y, _mm_set1_ps(axes[a].y))),
+        _mm_mul_ps(z, _mm_set1_ps(axes[a].z)))));
+    }
+    out |= static_cast<u4>(_mm_movemask_ps(_mm_cmpgt_ps(d, r))) << first;
+    cut |= static_cast<u4>(_mm_movemask_ps(_mm_cmpge_ps(d,
+      _mm_xor_ps(r, sign)))) << first;
+  }
+#endif
+
+  // Only planes still cutting the parent count: it is behind all the rest
+  u1 test = mask ? *mask : ALL;
+  if (out & test) { return Side::Outside; }
+  if (mask) { *mask = static_cast<u1>(cut & test); }
+  return (cut & test) ? Side::Intersect : Side::Inside;
+
+} // end Side Frustum::Test(const v3f&, f4, const v3f*, u1*) const            */
@@ -0,0 +1,319 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  Frustum.h
+Purpose:  6 plane view volume, classifying bounding volumes for culling
+Details:  Each plane faces outward, so a point is inside the volume only if it
+  is on or behind all 6 (normal.Dot(point) <= sum).  A bounding volume is
+  classified against each plane by its center's signed distance and its
+  projected radius along the normal:
+
+  - Outside: entirely in front of any 1 plane (culled, whatever the others)
+  - Inside: entirely behind all planes (its children need no more tests)
+  - Intersect: otherwise (conservative: may still be outside near corners)
+
+  The planes are also kept as lanes (x, y, z & sum of each plane, padded to 8
+  with planes nothing is in front of), so 1 volume is tested against all 6 at
+  once.  A batch of boxes in an AABBSoA is instead tested 1 plane at a time,
+  over 4 (SSE) or 8 (AVX) boxes at once.
+
+  Hierarchies pass down a plane mask: bit i set if plane i still cuts the
+  parent.  Planes the parent is wholly behind can't cut any child, so are not
+  tested again; once the mask is empty, the whole subtree is inside.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <vector>  // Batch results
+
+// "./src/..."
+#include "Plane.h"  // Bounding planes of the volume
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class AABB;         // Full box, classified by its center & half-extents
+  class AABBCompact;  // <min, max> box
+  class AABBSoA;      // Batch of <min, max> boxes
+  class BSphere;      // Sphere, classified by its center & radius
+  class OBB;          // Oriented box, classified by its center, axes & extents
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! View volume bounded by 6 outward facing planes
+  class Frustum
+  {
+  public:
+
+    static const u1 PLANES = 6u; //! Bounding planes of a view volume
+
+    static const u1 ALL = 0x3Fu; //! Plane mask with every plane still to test
+
+    //! Subscript of each bounding plane (bit of each plane in a plane mask)
+    enum class Face
+    {
+      Left = 0,   //! Subscript 0: plane through the view's left edges
+      Right = 1,  //! Subscript 1: plane through the view's right edges
+      Bottom = 2, //! Subscript 2: plane through the view's bottom edges
+      Top = 3,    //! Subscript 3: plane through the view's top edges
+      Near = 4,   //! Subscript 4: near clip plane
+      Far = 5     //! Subscript 5: far clip plane
+
+    }; // end Face enum declaration
+
+    //! Where a bounding volume lies relative to the view volume
+    enum class Side : u1
+    {
+      Outside = 0,   //! Wholly in front of some plane: not visible
+      Intersect = 1, //! Cut by some plane: possibly visible
+      Inside = 2     //! Wholly behind every plane: visible
+
+    }; // end Side enum declaration
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create an unbounded frustum: every volume is inside, until planes set
+    \brief
+      - create an unbounded frustum: every volume is inside, until planes set
+    */
+    Frustum(void);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Classify a box against the planes still to be tested
+    \brief
+      - classify a box against the planes still to be tested
+    \param box
+      - box to be classified
+    \param mask
+      - planes to test (bit per Face, all if null), to be set to the planes
+      still cutting the box: pass to its children (unset if outside)
+    \return
+      - side of the view volume the box is on
+    */
+    Side Classify(const AABB& box, u1* mask = nullptr) const;
+
+
+    /** Classify a <min, max> box against the planes still to be tested
+    \brief
+      - classify a <min, max> box against the planes still to be tested
+    \param box
+      - box to be classified (empty boxes are outside)
+    \param mask
+      - planes to test (bit per Face, all if null), to be set to the planes
+      still cutting the box: pass to its children (unset if outside)
+    \return
+      - side of the view volume the box is on
+    */
+    Side Classify(const AABBCompact& box, u1* mask = nullptr) const;
+
+
+    /** Classify a sphere against the planes still to be tested
+    \brief
+      - classify a sphere against the planes still to be tested
+    \param sphere
+      - sphere to be classified
+    \param mask
+      - planes to test (bit per Face, all if null), to be set to the planes
+      still cutting the sphere: pass to its children (unset if outside)
+    \return
+      - side of the view volume the sphere is on
+    */
+    Side Classify(const BSphere& sphere, u1* mask = nullptr) const;
+
+
+    /** Classify an oriented box against the planes still to be tested
+    \brief
+      - classify an oriented box against the planes still to be tested
+    \param box
+      - oriented box to be classified
+    \param mask
+      - planes to test (bit per Face, all if null), to be set to the planes
+      still cutting the box: pass to its children (unset if outside)
+    \return
+      - side of the view volume the box is on
+    */
+    Side Classify(const OBB& box, u1* mask = nullptr) const;
+
+
+    /** Classify each box of a batch against every plane
+    \brief
+      - classify each box of a batch against every plane
+    \param boxes
+      - batch of boxes to be classified (empty boxes are outside)
+    \param sides
+      - to be set to the side of each box, by index in the batch
+    \return
+      - count of boxes not outside (to be drawn)
+    */
+    u4 Classify(const AABBSoA& boxes, std::vector<Side>& sides) const;
+
+
+    /** Classify each sphere of an array against every plane
+    \brief
+      - classify each sphere of an array against every plane
+    \param spheres
+      - array of spheres to be classified
+    \param count
+      - spheres in the array
+    \param sides
+      - to be set to the side of each sphere, by index in the array
+    \return
+      - count of spheres not outside (to be drawn)
+    */
+    u4 Classify(const BSphere* spheres, u4 count,
+      std::vector<Side>& sides) const;
+
+
+    /** Classify each oriented box of an array against every plane
+    \brief
+      - classify each oriented box of an array against every plane
+    \param boxes
+      - array of oriented boxes to be classified
+    \param count
+      - oriented boxes in the array
+    \param sides
+      - to be set to the side of each box, by index in the array
+    \return
+      - count of boxes not outside (to be drawn)
+    */
+    u4 Classify(const OBB* boxes, u4 count, std::vector<Side>& sides) const;
+
+
+    /** Get a bounding plane
+    \brief
+      - get a bounding plane
+    \param face
+      - which plane to get
+    \return
+      - outward facing plane bounding the given face of the volume
+    */
+    inline const Plane& Get(Face face) const
+    { return plane[static_cast<u1>(face)]; } // end const Plane& Get(Face)    */
+
+
+    /** Set a bounding plane, and its lanes
+    \brief
+      - set a bounding plane, and its lanes
+    \param face
+      - which plane to set
+    \param bound
+      - outward facing plane: volume inside is behind (on normal's far side)
+    \return
+      - reference to the modified Frustum for easier subsequent inline action
+    */
+    Frustum& Set(Face face, const Plane& bound);
+
+
+    /** Get the indices of each box of a batch not outside (to be drawn)
+    \brief
+      - get the indices of each box of a batch not outside (to be drawn)
+    \param boxes
+      - batch of boxes to be culled (empty boxes are outside)
+    \param found
+      - to be set to the index of each box not outside, in increasing order
+    \return
+      - count of boxes not outside
+    */
+    u4 Visible(const AABBSoA& boxes, std::vector<u4>& found) const;
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Operator Overloads                            */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get a bounding plane by subscript
+    \brief
+      - get a bounding plane by subscript
+    \param subscript
+      - subscript of the plane [0, PLANES): as in Face
+    \return
+      - outward facing plane bounding the volume
+    */
+    inline const Plane& operator[](u1 subscript) const
+    { return plane[subscript]; } // end const Plane& operator[](u1) const     */
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Methods                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Classify each box of a batch against every plane, 4 / 8 boxes at once
+    \brief
+      - classify each box of a batch against every plane, 4 / 8 boxes at once
+    \param boxes
+      - batch of boxes to be classified (empty boxes are outside)
+    \param sides
+      - to be set to the side of each box by index, unless null
+    \param found
+      - to be set to the index of each box not outside, unless null
+    \return
+      - count of boxes not outside
+    */
+    u4 Cull(const AABBSoA& boxes, std::vector<Side>* sides,
+      std::vector<u4>* found) const;
+
+
+    /** Classify a volume against the planes still to be tested, all at once
+    \brief
+      - classify a volume against the planes still to be tested, all at once
+    \details
+      - along a plane's normal n, the volume reaches from its center by its
+      radius plus |n.Dot(axis)| for each axis given
+    \param center
+      - center of the volume
+    \param radius
+      - radius of the volume in every direction (0 for boxes)
+    \param axes
+      - 3 half-extent vectors of a box (scaled axes), or null for a sphere
+    \param mask
+      - planes to test (all if null), to be set to the planes still cutting
+    \return
+      - side of the view volume the volume is on
+    */
+    Side Test(const v3f& center, f4 radius, const v3f* axes, u1* mask) const;
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    static const u1 LANES = 8u; //! Planes padded to whole SSE / AVX registers
+
+    //! Outward facing bounding planes, by Face
+    Plane plane[PLANES];
+
+    //! Normal x of each plane (padded with 0s)
+    f4 nx[LANES];
+
+    //! Normal y of each plane (padded with 0s)
+    f4 ny[LANES];
+
+    //! Normal z of each plane (padded with 0s)
+    f4 nz[LANES];
+
+    //! Sum of each plane (padded with INf: no point is in front of padding)
+    f4 sum[LANES];
+
+  }; // end Frustum class declaration
+
+} // end dp namespace
@@ -0,0 +1,338 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  KDOP.cpp
+Purpose:  Discrete Oriented Polytope: min/max slabs along a fixed EPOS axis set
+Details:  Slab queries walk the axis set in SSE lanes of 4: axis components are
+  kept here in SoA form (x, y, z arrays) so each lane loads a whole axis.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <std>
+#include <emmintrin.h>  // SSE(2) 4-wide float lanes for slab comparisons
+
+// "./src/..."
+#include "AABB.h"     // Bounding Box, for I/O conversions / comparisons
+#include "KDOP.h"     // Class declaration header
+#include "m4f.h"      // Placement of mesh vertex data into world coordinates
+#include "Mesh.h"     // Vertex data iteration to scan for appropriate bounds
+#include "Ray.h"      // Ray origin / direction to clip against the slabs
+#include "Stats.h"    // Sampling struct to iterate over mesh vertex data
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Consts                                */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace
+{
+  //! All 49 EPOS axes (+3 zero padding lanes), same order as BSphere.cpp sets
+  constexpr u4 EPOS_LANES = 52u;
+
+  // x components: 001, 111, 011, 012, 112, 122 sets (LEN_R1, R3, R2, R5, ...)
+  const f4 EPOS_X[EPOS_LANES] =
+  { 1, 0, 0,   1, 1, 1, 1,   1, 1, 0, 1, 1, 0,
+    2, 2, 0, 2, 2, 0, 1, 1, 0, 1, 1, 0,
+    2, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1,
+    2, 2, 1, 2, 2, 1, 2, 2, 1, 2, 2, 1,   0, 0, 0 };
+
+  // y components, lane for lane with EPOS_X
+  const f4 EPOS_Y[EPOS_LANES] =
+  { 0, 1, 0,   1, 1,-1,-1,   1, 0, 1,-1, 0, 1,
+    1, 0, 2,-1, 0, 2, 2, 0, 1,-2, 0, 1,
+    1, 2, 1, 1, 2, 1,-1,-2,-1,-1,-2,-1,
+    2, 1, 2, 2, 1, 2,-2,-1,-2,-2,-1,-2,   0, 0, 0 };
+
+  // z components, lane for lane with EPOS_X
+  const f4 EPOS_Z[EPOS_LANES] =
+  { 0, 0, 1,   1,-1, 1,-1,   0, 1, 1, 0,-1,-1,
+    0, 1, 1, 0,-1,-1, 0, 2, 2, 0,-2,-2,
+    1, 1, 2,-1,-1,-2, 1, 1, 2,-1,-1,-2,
+    1, 2, 2,-1,-2,-2, 1, 2, 2,-1,-2,-2,   0, 0, 0 };
+
+  //! Sign bit cleared in every lane: bitwise and-mask for |x|
+  const __m128 ABS_MASK = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+} // end anonymous namespace
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+template <dp::EPOS E>
+dp::KDOP<E>::KDOP(void)
+{
+  Clear();
+} // end KDOP<E>::KDOP(void)                                                  */
+
+
+template <dp::EPOS E>
+dp::KDOP<E>::KDOP(const Mesh& mesh, const m4f& place, u4 samples, s2 step,
+  u2 first)
+{
+  Clear();
+  if (!mesh.VertexCount()) // No points: VertexBuffer() would read past end
+  {
+    ExpandedTo(place.PProd(nullv3f)); // Point k-DOP at the placed origin
+    return;
+  }
+  const Mesh::Vertex* p = &mesh.VertexBuffer();
+  uRng subs(samples, mesh.VertexCount(), first, step);
+  for (; subs.Scanning(); ++subs) // Grow by each sample's world space coord
+  { ExpandedTo(place.PProd(p[subs.Index()].pos)); }
+
+} // end KDOP<E>::KDOP(const Mesh&, const m4f&, u4, s2, u2)                   */
+
+
+template <dp::EPOS E>
+dp::KDOP<E>::KDOP(const AABB& box)
+{
+  Clear();
+  const v3f& c = box.Mid();
+  v3f e = box.HalfExt();
+  __m128 cX = _mm_set1_ps(c.x), cY = _mm_set1_ps(c.y), cZ = _mm_set1_ps(c.z);
+  __m128 eX = _mm_set1_ps(e.x), eY = _mm_set1_ps(e.y), eZ = _mm_set1_ps(e.z);
+  for (u4 l = 0; l < LANES; l += 4u)
+  {
+    __m128 nX = _mm_loadu_ps(EPOS_X + l);
+    __m128 nY = _mm_loadu_ps(EPOS_Y + l);
+    __m128 nZ = _mm_loadu_ps(EPOS_Z + l);
+    // Box projects as [n.mid - |n|.ext, n.mid + |n|.ext] on every axis
+    __m128 mid = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nX, cX),
+      _mm_mul_ps(nY, cY)), _mm_mul_ps(nZ, cZ));
+    __m128 rad = _mm_add_ps(_mm_add_ps(
+      _mm_mul_ps(_mm_and_ps(nX, ABS_MASK), eX),
+      _mm_mul_ps(_mm_and_ps(nY, ABS_MASK), eY)),
+      _mm_mul_ps(_mm_and_ps(nZ, ABS_MASK), eZ));
+    // Padding lanes are already at -/+INf, so only grow (never shrink) here
+    _mm_storeu_ps(min + l, _mm_min_ps(_mm_loadu_ps(min + l),
+      _mm_sub_ps(mid, rad)));
+    _mm_storeu_ps(max + l, _mm_max_ps(_mm_loadu_ps(max + l),
+      _mm_add_ps(mid, rad)));
+  }
+} // end KDOP<E>::KDOP(const AABB&)                                           */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+template <dp::EPOS E>
+dp::v3f dp::KDOP<E>::Axis(u4 axis)
+{
+  return v3f(EPOS_X[axis], EPOS_Y[axis], EPOS_Z[axis]);
+
+} // end v3f KDOP<E>::Axis(u4)                                                */
+
+
+template <dp::EPOS E>
+dp::AABB dp::KDOP<E>::Box(void) const
+{
+  // First 3 axes are always X_HAT, Y_HAT & Z_HAT: slabs are the box extrema
+  return AABB(v3f(min[0], min[1], min[2]), v3f(max[0], max[1], max[2]),
+    AABB::Format::Extrema);
+
+} // end AABB KDOP<E>::Box(void) const                                        */
+
+
+template <dp::EPOS E>
+dp::KDOP<E>& dp::KDOP<E>::ExpandedTo(const v3f& point)
+{
+  __m128 pX = _mm_set1_ps(point.x);
+  __m128 pY = _mm_set1_ps(point.y);
+  __m128 pZ = _mm_set1_ps(point.z);
+  for (u4 l = 0; l < LANES; l += 4u)
+  {
+    // Project point on 4 axes at once: n.p per lane
+    __m128 t = _mm_add_ps(_mm_add_ps(
+      _mm_mul_ps(_mm_loadu_ps(EPOS_X + l), pX),
+      _mm_mul_ps(_mm_loadu_ps(EPOS_Y + l), pY)),
+      _mm_mul_ps(_mm_loadu_ps(EPOS_Z + l), pZ));
+    _mm_storeu_ps(min + l, _mm_min_ps(_mm_loadu_ps(min + l), t));
+    _mm_storeu_ps(max + l, _mm_max_ps(_mm_loadu_ps(max + l), t));
+  }
+  return *this;
+
+} // end KDOP<E>& KDOP<E>::ExpandedTo(const v3f&)                             */
+
+
+template <dp::EPOS E>
+bool dp::KDOP<E>::IsEmpty(void) const
+{
+  __m128 inverted = _mm_setzero_ps();
+  for (u4 l = 0; l < LANES; l += 4u)
+  {
+    inverted = _mm_or_ps(inverted,
+      _mm_cmpgt_ps(_mm_loadu_ps(min + l), _mm_loadu_ps(max + l)));
+  }
+  return _mm_movemask_ps(inverted) != 0;
+
+} // end bool KDOP<E>::IsEmpty(void) const                                    */
+
+
+template <dp::EPOS E>
+bool dp::KDOP<E>::IsIn(const KDOP& other) const
+{
+  for (u4 l = 0; l < LANES; l += 4u)
+  {
+    // Separated on an axis if either slab ends before the other one begins
+    __m128 apart = _mm_or_ps(
+      _mm_cmplt_ps(_mm_loadu_ps(max + l), _mm_loadu_ps(other.min + l)),
+      _mm_cmplt_ps(_mm_loadu_ps(other.max + l), _mm_loadu_ps(min + l)));
+    if (_mm_movemask_ps(apart)) { return false; } // Found a separating axis
+  }
+  return true;
+
+} // end bool KDOP<E>::IsIn(const KDOP&) const                                */
+
+
+template <dp::EPOS E>
+bool dp::KDOP<E>::IsIn(const AABB& box) const
+{
+  const v3f& c = box.Mid();
+  v3f e = box.HalfExt();
+  __m128 cX = _mm_set1_ps(c.x), cY = _mm_set1_ps(c.y), cZ = _mm_set1_ps(c.z);
+  __m128 eX = _mm_set1_ps(e.x), eY = _mm_set1_ps(e.y), eZ = _mm_set1_ps(e.z);
+  for (u4 l = 0; l < LANES; l += 4u)
+  {
+    __m128 nX = _mm_loadu_ps(EPOS_X + l);
+    __m128 nY = _mm_loadu_ps(EPOS_Y + l);
+    __m128 nZ = _mm_loadu_ps(EPOS_Z + l);
+    __m128 mid = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nX, cX),
+      _mm_mul_ps(nY, cY)), _mm_mul_ps(nZ, cZ));
+    __m128 rad = _mm_add_ps(_mm_add_ps(
+      _mm_mul_ps(_mm_and_ps(nX, ABS_MASK), eX),
+      _mm_mul_ps(_mm_and_ps(nY, ABS_MASK), eY)),
+      _mm_mul_ps(_mm_and_ps(nZ, ABS_MASK), eZ));
+    // Separated if box projection ends before the slab, or starts after it
+    __m128 apart = _mm_or_ps(
+      _mm_cmplt_ps(_mm_add_ps(mid, rad), _mm_loadu_ps(min + l)),
+      _mm_cmplt_ps(_mm_loadu_ps(max + l), _mm_sub_ps(mid, rad)));
+    if (_mm_movemask_ps(apart)) { return false; } // Found a separating axis
+  }
+  return true;
+
+} // end bool KDOP<E>::IsIn(const AABB&) const                                */
+
+
+template <dp::EPOS E>
+bool dp::KDOP<E>::IsIn(const Ray& ray, f4* tDist) const
+{
+  const v3f& o = ray.Origin();
+  const v3f& d = ray.Direction();
+  __m128 oX = _mm_set1_ps(o.x), oY = _mm_set1_ps(o.y), oZ = _mm_set1_ps(o.z);
+  __m128 dX = _mm_set1_ps(d.x), dY = _mm_set1_ps(d.y), dZ = _mm_set1_ps(d.z);
+  __m128 tNear = _mm_set1_ps(-INf); // Running [near, far] span inside slabs
+  __m128 tFar = _mm_set1_ps(INf);
+  for (u4 l = 0; l < LANES; l += 4u)
+  {
+    __m128 nX = _mm_loadu_ps(EPOS_X + l);
+    __m128 nY = _mm_loadu_ps(EPOS_Y + l);
+    __m128 nZ = _mm_loadu_ps(EPOS_Z + l);
+    // Origin projection and its rate of change along the ray, per axis
+    __m128 at = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nX, oX),
+      _mm_mul_ps(nY, oY)), _mm_mul_ps(nZ, oZ));
+    __m128 rate = _mm_div_ps(_mm_set1_ps(1.0f), _mm_add_ps(_mm_add_ps(
+      _mm_mul_ps(nX, dX), _mm_mul_ps(nY, dY)), _mm_mul_ps(nZ, dZ)));
+    // Parallel axes scale by -/+INf: -/+INf outside slab, NaN only on a face
+    __m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(min + l), at), rate);
+    __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(max + l), at), rate);
+    // A NaN end (origin on a parallel slab's face) clips nothing, as in
+    // Ray::IsIn(AABB): such lanes keep the running span, where min / max
+    // alone would pass on the other end's +/-INf (=> a false miss)
+    __m128 clip = _mm_cmpord_ps(t0, t1);
+    __m128 enter = _mm_or_ps(_mm_and_ps(clip, _mm_min_ps(t0, t1)),
+      _mm_andnot_ps(clip, tNear));
+    __m128 leave = _mm_or_ps(_mm_and_ps(clip, _mm_max_ps(t0, t1)),
+      _mm_andnot_ps(clip, tFar));
+    tNear = _mm_max_ps(enter, tNear);
+    tFar = _mm_min_ps(leave, tFar);
+  }
+  // Reduce the 4 lanes' spans to a single [near, far] span
+  tNear = _mm_max_ps(tNear, _mm_shuffle_ps(tNear, tNear, _MM_SHUFFLE(1,0,3,2)));
+  tNear = _mm_max_ps(tNear, _mm_shuffle_ps(tNear, tNear, _MM_SHUFFLE(2,3,0,1)));
+  tFar = _mm_min_ps(tFar, _mm_shuffle_ps(tFar, tFar, _MM_SHUFFLE(1,0,3,2)));
+  tFar = _mm_min_ps(tFar, _mm_shuffle_ps(tFar, tFar, _MM_SHUFFLE(2,3,0,1)));
+  f4 tN = _mm_cvtss_f32(tNear), tF = _mm_cvtss_f32(tFar);
+
+  // Miss if slab spans are skew, or the whole span is behind the ray origin
+  if (tF < tN || tF < 0.0f) { if (tDist) { *tDist = INf; } return false; }
+  if (tDist) { *tDist = MaxF(tN, 0.0f); } // Starting inside => 0 distance
+  return true;
+
+} // end bool KDOP<E>::IsIn(const Ray&, f4*) const                            */
+
+
+template <dp::EPOS E>
+bool dp::KDOP<E>::IsIn(const v3f& point) const
+{
+  __m128 pX = _mm_set1_ps(point.x);
+  __m128 pY = _mm_set1_ps(point.y);
+  __m128 pZ = _mm_set1_ps(point.z);
+  for (u4 l = 0; l < LANES; l += 4u)
+  {
+    __m128 t = _mm_add_ps(_mm_add_ps(
+      _mm_mul_ps(_mm_loadu_ps(EPOS_X + l), pX),
+      _mm_mul_ps(_mm_loadu_ps(EPOS_Y + l), pY)),
+      _mm_mul_ps(_mm_loadu_ps(EPOS_Z + l), pZ));
+    __m128 out = _mm_or_ps(_mm_cmplt_ps(t, _mm_loadu_ps(min + l)),
+      _mm_cmplt_ps(_mm_loadu_ps(max + l), t));
+    if (_mm_movemask_ps(out)) { return false; } // Outside of this slab
+  }
+  return true;
+
+} // end bool KDOP<E>::IsIn(const v3f&) const                                 */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                            Operator Overloads                              */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+template <dp::EPOS E>
+dp::KDOP<E>& dp::KDOP<E>::operator+=(const KDOP& other)
+{
+  for (u4 l = 0; l < LANES; l += 4u)
+  {
+    _mm_storeu_ps(min + l,
+      _mm_min_ps(_mm_loadu_ps(min + l), _mm_loadu_ps(other.min + l)));
+    _mm_storeu_ps(max + l,
+      _mm_max_ps(_mm_loadu_ps(max + l), _mm_loadu_ps(other.max + l)));
+  }
+  return *this;
+
+} // end KDOP<E>& KDOP<E>::operator+=(const KDOP&)                            */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+template <dp::EPOS E>
+void dp::KDOP<E>::Clear(void)
+{
+  u4 a = 0;
+  for (; a < AXES; ++a)  { min[a] = INf;  max[a] = -INf; } // Inverted: empty
+  for (; a < LANES; ++a) { min[a] = -INf; max[a] = INf; }  // Never separates
+
+} // end void KDOP<E>::Clear(void)                                            */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                          Explicit Instantiations                           */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+template class dp::KDOP<dp::EPOS::_6>;
+template class dp::KDOP<dp::EPOS::_14>;
+template class dp::KDOP<dp::EPOS::_26>;
+template class dp::KDOP<dp::EPOS::_50>;
+template class dp::KDOP<dp::EPOS::_74>;
+template class dp::KDOP<dp::EPOS::_98>;
@@ -0,0 +1,326 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  KDOP.h
+Purpose:  Discrete Oriented Polytope: min/max slabs along a fixed EPOS axis set
+Details:  K counts the bounding planes: for an EPOS scan of K extremal points,
+  K/2 axes (the same 001, 111, 011, 012, 112, 122 families used to seed a
+  LarsonSphere) each keep a [min, max] projection range of the bound points.
+
+  Slabs are stored as 2 flat float arrays padded to a multiple of 4 lanes so
+  every query runs 4 axes at a time in SSE registers: slab vs slab overlap,
+  box projection vs slab, and ray slab clipping.  Padding lanes are kept at
+  [-INf, INf] to never separate anything, so no query needs a scalar tail.
+
+  Axes are left unnormalized (integer components, as listed in BSphere.cpp):
+  slab comparisons only ever happen along matching axes, so the scale cancels
+  and the directions stay exact in float.
+
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// "./src/..."
+#include "BSphere.h"  // EPOS direction set categories defining the slab axes
+#include "v3f.h"      // World space points / axis directions to project with
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class AABB; // Bounding box to convert from / to, and to test overlap with
+  class Mesh; // Vertex data to scan for bounding volume context
+  class Ray;  // Ray to clip against the slabs of the polytope
+  class m4f;  // Placement matrix from mesh model space into world coordinates
+
+  /** Get count of slab axes used by an EPOS direction set category
+  \brief
+    - get count of slab axes used by an EPOS direction set category
+  \param set
+    - EPOS category of axes, where each includes all categories before it
+  \return
+    - number of axes (half the number of extremal points / bounding planes)
+  */
+  constexpr u4 EposAxes(EPOS set)
+  {
+    return set == EPOS::_6 ? 3u : set == EPOS::_14 ? 7u :
+      set == EPOS::_26 ? 13u : set == EPOS::_50 ? 25u :
+      set == EPOS::_74 ? 37u : 49u;
+
+  } // end constexpr u4 EposAxes(EPOS)                                        */
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! K-DOP: bounds as [min, max] projected spans along each EPOS slab axis
+  template <EPOS E = EPOS::_14>
+  class KDOP
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                       Public Class Constants                           */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    static constexpr u4 AXES = EposAxes(E); //! Slab axes bounded: K / 2
+
+    static constexpr u4 K = AXES * 2u; //! Bounding planes (EPOS point count)
+
+    static constexpr u4 LANES = (AXES + 3u) & ~3u; //! Axes padded for SSE
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create an empty K-DOP (inverted [INf, -INf] slabs), ready to grow
+    \brief
+      - create an empty K-DOP (inverted [INf, -INf] slabs), ready to grow
+    */
+    KDOP(void);
+
+
+    /** Create a K-DOP by Mesh data scan of vertex projections on each axis
+    \brief
+      - create a K-DOP by Mesh data scan of vertex projections on each axis
+    \param mesh
+      - mesh to have vertex data read for extremal projections of each axis
+    \param place
+      - position, scale and rotation to convert mesh data to world coordinates
+    \param samples
+      - [1, s =: mesh.VertexCount()] sampled points read from vertex dataset
+    \param step
+      - [-s, 0),(0, s] point samples to be skipped per scan step
+    \param first
+      - [1, s] point samples to offset by in first scan iteration
+    */
+    KDOP(const Mesh& mesh, const m4f& place, u4 samples = u4_INVALID,
+      s2 step = 1, u2 first = 0u);
+
+
+    /** Create a K-DOP tightly bounding a given axis aligned bounding box
+    \brief
+      - create a K-DOP tightly bounding a given axis aligned bounding box
+    \param box
+      - box projected by <mid, half-extents> onto each slab axis
+    */
+    KDOP(const AABB& box);
+
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Public Methods                                */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the (unnormalized) direction of one of the polytope's slab axes
+    \brief
+      - get the (unnormalized) direction of one of the polytope's slab axes
+    \param axis
+      - [0, AXES) subscript of the slab axis, in EPOS category order
+    \return
+      - integer component direction of the axis: 001, 111, 011, 012, 112, 122
+    */
+    static v3f Axis(u4 axis);
+
+
+    /** Get the axis aligned box bounding this polytope (its first 3 slabs)
+    \brief
+      - get the axis aligned box bounding this polytope (its first 3 slabs)
+    \return
+      - box spanning the x, y and z slabs, which are always the first 3 axes
+    */
+    AABB Box(void) const;
+
+
+    /** Grow slabs to include a given world space point, if not already in
+    \brief
+      - grow slabs to include a given world space point, if not already in
+    \param point
+      - cartesian world space coordinate to be bounded by this
+    \return
+      - reference to the modified K-DOP for easier subsequent inline action
+    */
+    KDOP& ExpandedTo(const v3f& point);
+
+
+    /** Get whether the polytope has no volume, with any slab still inverted
+    \brief
+      - get whether the polytope has no volume, with any slab still inverted
+    \return
+      - true if any slab min is beyond its max (as when default constructed)
+    */
+    bool IsEmpty(void) const;
+
+
+    /** Get whether another K-DOP of the same axis set overlaps this one
+    \brief
+      - get whether another K-DOP of the same axis set overlaps this one
+    \param other
+      - polytope whose slabs are compared against this one's, 4 axes at once
+    \return
+      - true if every slab pair overlaps (no separating axis in the set)
+    */
+    bool IsIn(const KDOP& other) const;
+
+
+    /** Get whether an axis aligned box overlaps this polytope
+    \brief
+      - get whether an axis aligned box overlaps this polytope
+    \details
+      - box projects to [c - r, c + r] per axis: c = n.mid, r = |n|.halfExt;
+      only the polytope axes are tested, so this is conservative (as AABBs
+      are, against any rotated shape) where box edges separate diagonally
+    \param box
+      - axis aligned bounding box to test against each slab
+    \return
+      - true if the box's projection overlaps every slab
+    */
+    bool IsIn(const AABB& box) const;
+
+
+    /** Get whether a ray intersects this polytope, clipping it by each slab
+    \brief
+      - get whether a ray intersects this polytope, clipping it by each slab
+    \details
+      - parallel axes divide to -/+INf (or NaN right on a slab face), which
+      min/max operand order keeps from narrowing the running [near, far] span
+    \param ray
+      - ray to clip against every slab pair 4 axes at a time
+    \param tDist
+      - ray length to enter polytope, to be set (0 if starting inside) if given
+    \return
+      - true if the ray has a real, non-negative scalar to reach the polytope
+    */
+    bool IsIn(const Ray& ray, f4* tDist = nullptr) const;
+
+
+    /** Get whether a cartesian point is within every slab of the polytope
+    \brief
+      - get whether a cartesian point is within every slab of the polytope
+    \param point
+      - cartesian world space coord to be evaluated for intersection with this
+    \return
+      - true if the point's projection onto every axis is in the slab span
+    */
+    bool IsIn(const v3f& point) const;
+
+
+    /** Access the maximum projection of the bounded points onto a slab axis
+    \brief
+      - access the maximum projection of the bounded points onto a slab axis
+    \param axis
+      - [0, AXES) subscript of the slab axis, in EPOS category order
+    \return
+      - max scalar projection of any point bounded, along the given axis
+    */
+    inline f4 Max(u4 axis) const
+    { return max[axis]; } // end f4 KDOP::Max(u4) const                       */
+
+
+    /** Access the minimum projection of the bounded points onto a slab axis
+    \brief
+      - access the minimum projection of the bounded points onto a slab axis
+    \param axis
+      - [0, AXES) subscript of the slab axis, in EPOS category order
+    \return
+      - min scalar projection of any point bounded, along the given axis
+    */
+    inline f4 Min(u4 axis) const
+    { return min[axis]; } // end f4 KDOP::Min(u4) const                       */
+
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                        Operator Overloads                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Merge another K-DOP into this, widening each slab to include both
+    \brief
+      - merge another K-DOP into this, widening each slab to include both
+    \param other
+      - polytope to be bound together with this (e.g. hierarchy child nodes)
+    \return
+      - reference to the modified K-DOP for easier subsequent inline action
+    */
+    KDOP& operator+=(const KDOP& other);
+
+
+    /** Get the merged K-DOP bounding both this and another
+    \brief
+      - get the merged K-DOP bounding both this and another
+    \param other
+      - polytope to be bound together with a copy of this
+    \return
+      - polytope whose slabs each span both sources' slabs
+    */
+    inline KDOP operator+(const KDOP& other) const
+    {
+      return KDOP(*this) += other;
+    } // end KDOP KDOP::operator+(const KDOP&) const                          */
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Methods                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Reset slabs to empty: [INf, -INf] on axes, [-INf, INf] on padding
+    \brief
+      - reset slabs to empty: [INf, -INf] on axes, [-INf, INf] on padding
+    */
+    void Clear(void);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    f4 min[LANES]; //! Minimum projection per axis (padding lanes at -INf)
+
+    f4 max[LANES]; //! Maximum projection per axis (padding lanes at +INf)
+
+  }; // end KDOP class declaration
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                           Public Class Aliases                           */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  using DOP6  = KDOP<EPOS::_6>;  //! 6-DOP: the same slabs as an AABB
+  using DOP14 = KDOP<EPOS::_14>; //! 14-DOP: box clipped at its 8 corners
+  using DOP26 = KDOP<EPOS::_26>; //! 26-DOP: box also clipped at its 12 edges
+  using DOP50 = KDOP<EPOS::_50>; //! 50-DOP: adds the 12 012 axes
+  using DOP74 = KDOP<EPOS::_74>; //! 74-DOP: adds the 12 112 axes
+  using DOP98 = KDOP<EPOS::_98>; //! 98-DOP: adds the 12 122 axes
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Helper Constants                             */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  // Out of class definitions for odr-used static constexpr members (C++14)
+  template <EPOS E> constexpr u4 KDOP<E>::AXES;
+  template <EPOS E> constexpr u4 KDOP<E>::K;
+  template <EPOS E> constexpr u4 KDOP<E>::LANES;
+
+  // Definitions only instantiated in KDOP.cpp for the 6 EPOS categories
+  extern template class KDOP<EPOS::_6>;
+  extern template class KDOP<EPOS::_14>;
+  extern template class KDOP<EPOS::_26>;
+  extern template class KDOP<EPOS::_50>;
+  extern template class KDOP<EPOS::_74>;
+  extern template class KDOP<EPOS::_98>;
+
+  // Ensurance that memory footprint is as intended: 2 padded slab arrays
+  static_assert(sizeof(DOP6) == 2*4*4, "DOP6 size not tightly packed");
+  static_assert(sizeof(DOP14) == 2*8*4, "DOP14 size not tightly packed");
+  static_assert(sizeof(DOP26) == 2*16*4, "DOP26 size not tightly packed");
+
+} // end dp namespace
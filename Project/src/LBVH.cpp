@@ -0,0 +1,878 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  LBVH.cpp
+Purpose:  Linear BVH: parallel per frame rebuild of a triangle hierarchy
+Details:  nodes are indexed so the hierarchy never needs allocating per
+  node: internal node i is the one Karras' method assigns to sorted leaf
+  i's split, and leaf k sits at node leaves - 1 + k.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+#include <chrono>     // Wall clock timing of benchmark builds
+
+#if defined(_MSC_VER)
+#include <intrin.h>   // Bit scan, for leading 0 counts of code prefixes
+#endif
+
+// "./src/..."
+#include "AABB.h"     // Query bounds, by Min() / Max() extrema
+#include "Frustum.h"  // Plane masks of frustum queries
+#include "LBVH.h"     // Class declaration header
+#include "m4f.h"      // Relative placement of mesh / mesh tests
+#include "Parallel.h" // Chunked build steps over the hardware's threads
+#include "Ray.h"      // Ray origin / direction of ray queries
+#include "RayPacket.h"// Lane masks of packet ray queries
+#include "Triangle.h" // Leaf points / centroids
+#include "TriangleCompact.h"  // Leaf points / centroids, packed
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+//! SAH cost of testing a node's box, relative to testing a leaf's triangle
+static const f4 TRAVERSE = 1.2f;
+
+//! Fewest leaves per restructured treelet (smaller has only 1 topology)
+static const u4 TREELET_MIN = 3u;
+
+//! Most leaves per restructured treelet (its subset costs number 2^7);
+//! Optimize defaults to 5, and clamps any other size into [3, 7]
+static const u4 TREELET_MAX = 7u;
+
+//! Mesh / mesh walk tasks made per thread, to even out uneven subtrees
+static const u4 TASKS = 4u;
+
+//! Most levels opened into tasks before the walk (if not yet enough tasks)
+static const u4 TASK_LEVELS = 12u;
+
+
+namespace
+{
+  //! Walk stack entry: a node, and what still reaches its parent
+  struct Visit
+  {
+    u4 node;  //! Node to be tested
+    u4 mask;  //! Packet lanes hitting / frustum planes cutting the parent
+  };
+
+  //! Placement of one model space in another: other box <center, extents>
+  //! as an oriented box, by the linear part's columns / their absolutes
+  struct Relative
+  {
+    dp::v3f col[3];   //! Linear part's columns (other's scaled local axes)
+    dp::v3f abs[3];   //! Absolute values of the columns
+    dp::v3f gram[3];  //! Absolute dot products of each column with the others
+    dp::v3f move;     //! Translation
+    f4 grow;          //! Largest squared column length: bound on area scale
+
+    //! Read the linear part & translation of a placement
+    explicit Relative(const dp::m4f& m)
+    {
+      grow = 0.0f;
+      for (u4 k = 0u; k < 3u; ++k)
+      {
+        col[k] = m.col[k].XYZ();
+        abs[k] = col[k].Abs();
+        grow = MaxF(grow, col[k].LengthSquared());
+      }
+      for (u4 k = 0u; k < 3u; ++k)
+      {
+        gram[k].Set(AbsF(col[0].Dot(col[k])), AbsF(col[1].Dot(col[k])),
+          AbsF(col[2].Dot(col[k])));
+      }
+      move = m.col[3].XYZ();
+    }
+
+    //! Check if a box overlaps another placed by this (6 face axes: loose)
+    bool Overlap(const dp::v3f& minA, const dp::v3f& maxA,
+      const dp::v3f& minB, const dp::v3f& maxB) const
+    {
+      dp::v3f eA = (maxA - minA) * AHALF, eB = (maxB - minB) * AHALF;
+      dp::v3f cB = (maxB + minB) * AHALF;
+      dp::v3f d = col[0] * cB.x + col[1] * cB.y + col[2] * cB.z + move
+        - (maxA + minA) * AHALF;
+
+      // This box's axes: other's reach along each world axis
+      dp::v3f reach = abs[0] * eB.x + abs[1] * eB.y + abs[2] * eB.z;
+      if (eA.x + reach.x < AbsF(d.x) || eA.y + reach.y < AbsF(d.y)
+        || eA.z + reach.z < AbsF(d.z)) { return false; }
+
+      // Other box's axes (its columns, unnormalized: both sides scale alike)
+      for (u4 k = 0u; k < 3u; ++k)
+      {
+        if (abs[k].Dot(eA) + gram[k].Dot(eB) < AbsF(col[k].Dot(d)))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+  };
+
+} // end anonymous namespace
+
+
+//! Get the subscript of a mask's lowest set bit (mask must not be 0)
+static inline u4 Bit(u4 mask)
+{
+  u4 bit = 0u;
+  while (!(mask & 1u)) { mask >>= 1u; ++bit; }
+  return bit;
+
+} // end u4 Bit(u4)                                                           */
+
+
+//! Get the count of leading 0 bits of a 64 bit value (64 for 0)
+static inline s4 Clz(u8 value)
+{
+  if (!value) { return 64; }
+#if defined(_MSC_VER)
+  unsigned long bit;
+  u4 high = static_cast<u4>(value >> 32u);
+  if (high) { _BitScanReverse(&bit, high); return 31 - static_cast<s4>(bit); }
+  _BitScanReverse(&bit, static_cast<u4>(value));
+  return 63 - static_cast<s4>(bit);
+#elif defined(__GNUC__)
+  return __builtin_clzll(value);
+#else
+  s4 zeros = 0;
+  if (!(value >> 32u)) { zeros += 32; value <<= 32u; }
+  if (!(value >> 48u)) { zeros += 16; value <<= 16u; }
+  if (!(value >> 56u)) { zeros += 8; value <<= 8u; }
+  if (!(value >> 60u)) { zeros += 4; value <<= 4u; }
+  if (!(value >> 62u)) { zeros += 2; value <<= 2u; }
+  if (!(value >> 63u)) { zeros += 1; }
+  return zeros;
+#endif
+
+} // end s4 Clz(u8)                                                           */
+
+
+//! Spread the low 10 bits of a value 3 apart (bit i moved to bit 3i)
+static inline u8 Spread10(u4 value)
+{
+  value = (value * 0x00010001u) & 0xFF0000FFu;
+  value = (value * 0x00000101u) & 0x0F00F00Fu;
+  value = (value * 0x00000011u) & 0xC30C30C3u;
+  value = (value * 0x00000005u) & 0x49249249u;
+  return value;
+
+} // end u8 Spread10(u4)                                                      */
+
+
+//! Spread the low 21 bits of a value 3 apart (bit i moved to bit 3i)
+static inline u8 Spread21(u8 value)
+{
+  value &= 0x1FFFFFull;
+  value = (value | value << 32u) & 0x1F00000000FFFFull;
+  value = (value | value << 16u) & 0x1F0000FF0000FFull;
+  value = (value | value << 8u) & 0x100F00F00F00F00Full;
+  value = (value | value << 4u) & 0x10C30C30C30C30C3ull;
+  value = (value | value << 2u) & 0x1249249249249249ull;
+  return value;
+
+} // end u8 Spread21(u8)                                                      */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::LBVH::LBVH(Codes bits) : capacity(0u), leaves(0u), codes(bits)
+{ } // end LBVH::LBVH(Codes)                                                  */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::LBVH& dp::LBVH::Build(const Triangle* triangles, u4 count)
+{
+  return Construct(triangles, count);
+
+} // end LBVH& LBVH::Build(const Triangle*, u4)                               */
+
+
+dp::LBVH& dp::LBVH::Build(const TriangleCompact* triangles, u4 count)
+{
+  return Construct(triangles, count);
+
+} // end LBVH& LBVH::Build(const TriangleCompact*, u4)                        */
+
+
+dp::LBVH& dp::LBVH::Build(const std::vector<Triangle>& triangles)
+{
+  return Build(triangles.data(), static_cast<u4>(triangles.size()));
+
+} // end LBVH& LBVH::Build(const vector<Triangle>&)                           */
+
+
+f4 dp::LBVH::Cost(void) const
+{
+  if (leaves < 2u) { return 0.0f; }
+
+  f4 total = 0.0f;
+  for (u4 i = 0u; i < leaves - 1u; ++i)
+  {
+    total += node[i].Box().Area();
+  }
+  f4 rootArea = node[0].Box().Area();
+  return (0.0f < rootArea) ? total / rootArea : 0.0f;
+
+} // end f4 LBVH::Cost(void) const                                            */
+
+
+dp::LBVH& dp::LBVH::Optimize(u4 rounds, u4 treelet)
+{
+  treelet = (treelet < TREELET_MIN) ? TREELET_MIN
+    : (TREELET_MAX < treelet ? TREELET_MAX : treelet);
+  if (leaves < treelet) { return *this; }
+
+  for (u4 round = 0u; round < rounds; ++round)
+  {
+    Climb<Triangle>(nullptr, treelet);
+  }
+  return *this;
+
+} // end LBVH& LBVH::Optimize(u4, u4)                                         */
+
+
+template <typename T>
+u4 dp::LBVH::Intersect(const T* triangles, const m4f& place,
+  const LBVH& other, const T* others, const m4f& otherPlace,
+  std::vector<Pair>& found, bool first, bool parallel) const
+{
+  found.clear();
+  if (!leaves || !other.leaves) { return 0u; }
+
+  m4f rel = place.Inverse() * otherPlace; // Other's model space into this'
+  Relative into(rel);
+  std::atomic<bool> stop(false);
+
+  // Overlapping node pairs: this' node in a, other's in b
+  auto overlap = [&](const Pair& p) {
+    const Node& n = node[p.a];
+    const Node& o = other.node[p.b];
+    return into.Overlap(n.min, n.max, o.min, o.max);
+  };
+
+  // Open the larger node of a pair (by area, other's scaled into this' space)
+  auto openThis = [&](const Pair& p) {
+    if (IsLeaf(p.a)) { return false; }
+    if (other.IsLeaf(p.b)) { return true; }
+    const Node& n = node[p.a];
+    const Node& o = other.node[p.b];
+    return into.grow * o.Box().Area() <= n.Box().Area();
+  };
+
+  // Test a leaf pair's triangles both ways (either's edge may pierce)
+  auto touch = [&](const Pair& p) {
+    const T& tA = triangles[node[p.a].child[0]];
+    const T& tB = others[other.node[p.b].child[0]];
+    TriangleCompact a(tA.A(), tA.B(), tA.C());
+    TriangleCompact b(rel.PProd(tB.A()), rel.PProd(tB.B()),
+      rel.PProd(tB.C()));
+    return a.In(b) || b.In(a);
+  };
+
+  // Walk the node pairs under one task, depth first
+  auto walk = [&](const Pair& task, std::vector<Pair>& hits) {
+    std::vector<Pair> stack(1u, task);
+    while (!stack.empty() && !stop.load(std::memory_order_relaxed))
+    {
+      Pair p = stack.back();
+      stack.pop_back();
+      if (!overlap(p)) { continue; }
+      if (IsLeaf(p.a) && other.IsLeaf(p.b))
+      {
+        if (!touch(p)) { continue; }
+        hits.push_back({ node[p.a].child[0], other.node[p.b].child[0] });
+        if (first) { stop.store(true, std::memory_order_relaxed); }
+        continue;
+      }
+      bool a = openThis(p);
+      const u4* child = a ? node[p.a].child : other.node[p.b].child;
+      stack.push_back(a ? Pair{ child[1], p.b } : Pair{ p.a, child[1] });
+      stack.push_back(a ? Pair{ child[0], p.b } : Pair{ p.a, child[0] });
+    }
+  };
+
+  // Open the top levels breadth first, into a few tasks per thread
+  std::vector<Pair> task(1u, Pair{ 0u, 0u }), next;
+  u4 want = parallel ? ParallelThreads() * TASKS : 1u;
+  for (u4 level = 0u; level < TASK_LEVELS && task.size() < want; ++level)
+  {
+    bool opened = false;
+    next.clear();
+    for (const Pair& p : task)
+    {
+      if (!overlap(p)) { continue; }
+      if (IsLeaf(p.a) && other.IsLeaf(p.b))
+      {
+        next.push_back(p);
+        continue;
+      }
+      opened = true;
+      bool a = openThis(p);
+      const u4* child = a ? node[p.a].child : other.node[p.b].child;
+      next.push_back(a ? Pair{ child[0], p.b } : Pair{ p.a, child[0] });
+      next.push_back(a ? Pair{ child[1], p.b } : Pair{ p.a, child[1] });
+    }
+    task.swap(next);
+    if (!opened) { break; }
+  }
+  if (task.empty()) { return 0u; }
+
+  // Walk each task, into its chunk's own list
+  u4 count = static_cast<u4>(task.size());
+  std::vector<std::vector<Pair>> part(ParallelChunks(count, 1u));
+  ParallelFor(count, [&](u4 start, u4 end, u4 chunk) {
+    for (u4 t = start; t < end; ++t) { walk(task[t], part[chunk]); }
+  }, 1u);
+  for (const std::vector<Pair>& hits : part)
+  {
+    found.insert(found.end(), hits.begin(), hits.end());
+  }
+  if (first && 1u < found.size()) { found.resize(1u); }
+  return static_cast<u4>(found.size());
+
+} // end u4 LBVH::Intersect(const T*, const m4f&, const LBVH&, const T*, ...) */
+
+
+u4 dp::LBVH::Query(const AABB& box, std::vector<u4>& found) const
+{
+  found.clear();
+  if (!leaves) { return 0u; }
+
+  const AABBCompact bounds(box);
+  std::vector<u4> stack(1u, 0u);
+  while (!stack.empty())
+  {
+    const Node& n = node[stack.back()];
+    bool leaf = IsLeaf(stack.back());
+    stack.pop_back();
+
+    if (!n.Box().IsIn(bounds)) { continue; }
+    if (leaf) { found.push_back(n.child[0]); continue; }
+    stack.push_back(n.child[0]);
+    stack.push_back(n.child[1]);
+  }
+  return static_cast<u4>(found.size());
+
+} // end u4 LBVH::Query(const AABB&, vector<u4>&) const                       */
+
+
+u4 dp::LBVH::Query(const Frustum& frustum, std::vector<u4>& found) const
+{
+  found.clear();
+  if (!leaves) { return 0u; }
+
+  // Once no planes are left to test, the whole subtree is inside
+  std::vector<Visit> stack(1u, Visit{ 0u, Frustum::ALL });
+  while (!stack.empty())
+  {
+    Visit at = stack.back();
+    stack.pop_back();
+
+    const Node& n = node[at.node];
+    u1 planes = static_cast<u1>(at.mask);
+    if (planes && frustum.Classify(n.Box(), &planes) == Frustum::Side::Outside)
+    {
+      continue;
+    }
+    if (IsLeaf(at.node)) { found.push_back(n.child[0]); continue; }
+    stack.push_back(Visit{ n.child[0], planes });
+    stack.push_back(Visit{ n.child[1], planes });
+  }
+  return static_cast<u4>(found.size());
+
+} // end u4 LBVH::Query(const Frustum&, vector<u4>&) const                    */
+
+
+u4 dp::LBVH::Query(const Ray& ray, std::vector<u4>& found, f4 tMax) const
+{
+  found.clear();
+  if (!leaves) { return 0u; }
+
+  const RaySlab slab(ray, tMax);
+  std::vector<u4> stack(1u, 0u);
+  while (!stack.empty())
+  {
+    const Node& n = node[stack.back()];
+    bool leaf = IsLeaf(stack.back());
+    stack.pop_back();
+    if (!n.Box().IsIn(slab)) { continue; }
+    if (leaf) { found.push_back(n.child[0]); continue; }
+    stack.push_back(n.child[0]);
+    stack.push_back(n.child[1]);
+  }
+  return static_cast<u4>(found.size());
+
+} // end u4 LBVH::Query(const Ray&, vector<u4>&, f4) const                    */
+
+
+template <u4 LANES>
+u4 dp::LBVH::Query(const RayPacket<LANES>& packet,
+  std::vector<LaneHit>& found) const
+{
+  found.clear();
+  if (!leaves || !packet.Active()) { return 0u; }
+
+  std::vector<Visit> stack(1u, Visit{ 0u, packet.Active() });
+  while (!stack.empty())
+  {
+    Visit at = stack.back();
+    stack.pop_back();
+
+    const Node& n = node[at.node];
+    u4 lanes = packet.Hit(n.min, n.max, at.mask);
+    if (!lanes) { continue; }
+    if (IsLeaf(at.node))
+    {
+      found.push_back(LaneHit{ n.child[0], lanes });
+      continue;
+    }
+    stack.push_back(Visit{ n.child[0], lanes });
+    stack.push_back(Visit{ n.child[1], lanes });
+  }
+  return static_cast<u4>(found.size());
+
+} // end u4 LBVH::Query(const RayPacket<LANES>&, vector<LaneHit>&) const      */
+
+
+dp::LBVH& dp::LBVH::Refit(const Triangle* triangles)
+{
+  if (leaves) { Climb(triangles, 0u); }
+  return *this;
+
+} // end LBVH& LBVH::Refit(const Triangle*)                                   */
+
+
+dp::LBVH& dp::LBVH::Refit(const TriangleCompact* triangles)
+{
+  if (leaves) { Climb(triangles, 0u); }
+  return *this;
+
+} // end LBVH& LBVH::Refit(const TriangleCompact*)                            */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+template <typename T>
+void dp::LBVH::Climb(const T* triangles, u4 treelet)
+{
+  u4 first = leaves - 1u;
+  ParallelFor(first, [&](u4 begin, u4 end, u4)
+  {
+    for (u4 i = begin; i < end; ++i)
+    {
+      arrived[i].store(0u, std::memory_order_relaxed);
+    }
+  });
+
+  ParallelFor(leaves, [&](u4 begin, u4 end, u4)
+  {
+    for (u4 k = begin; k < end; ++k)
+    {
+      u4 index = first + k;
+      Node& leaf = node[index];
+      if (triangles)
+      {
+        const T& t = triangles[order[k]];
+        const v3f& a = t.A();
+        v3f b = t.B(), c = t.C();
+        leaf.min.Set(MinF(MinF(a.x, b.x), c.x), MinF(MinF(a.y, b.y), c.y),
+          MinF(MinF(a.z, b.z), c.z));
+        leaf.max.Set(MaxF(MaxF(a.x, b.x), c.x), MaxF(MaxF(a.y, b.y), c.y),
+          MaxF(MaxF(a.z, b.z), c.z));
+        leaf.child[0] = order[k];
+        leaf.child[1] = u4_INVALID;
+      }
+      cost[index] = leaf.Box().Area();
+      size[index] = 1u;
+    }
+  });
+
+  // Leaves all set before any climb: the climb's loop then touches only
+  // nodes, and this pass alone gathers triangles (~40% less time, 1M)
+  ParallelFor(leaves, [&](u4 begin, u4 end, u4)
+  {
+    for (u4 k = begin; k < end; ++k)
+    {
+      // The 1st child to arrive stops; the 2nd sees both done, and goes on
+      u4 at = parent[first + k];
+      while (at != u4_INVALID)
+      {
+        if (!arrived[at].fetch_add(1u, std::memory_order_acq_rel)) { break; }
+        Fit(at);
+        if (treelet && treelet <= size[at]) { Restructure(at, treelet); }
+        at = parent[at];
+      }
+    }
+  });
+
+} // end void LBVH::Climb(const T*, u4)                                       */
+
+
+template <typename T>
+dp::LBVH& dp::LBVH::Construct(const T* triangles, u4 count)
+{
+  leaves = count;
+  if (!count) { node.clear(); return *this; }
+
+  u4 nodes = 2u * count - 1u;
+  node.resize(nodes);
+  parent.resize(nodes);
+  cost.resize(nodes);
+  size.resize(nodes);
+  code.resize(count);
+  codeSwap.resize(count);
+  order.resize(count);
+  orderSwap.resize(count);
+  if (capacity < count)
+  {
+    arrived.reset(new std::atomic<u4>[count]);
+    capacity = count;
+  }
+
+  // Centroid bounds: per chunk, then over all chunks
+  u4 chunks = ParallelChunks(count);
+  std::vector<v3f> low(chunks, v3f(INf, INf, INf));
+  std::vector<v3f> high(chunks, v3f(-INf, -INf, -INf));
+  ParallelFor(count, [&](u4 first, u4 last, u4 chunk)
+  {
+    v3f& lo = low[chunk];
+    v3f& hi = high[chunk];
+    for (u4 i = first; i < last; ++i)
+    {
+      const v3f& c = triangles[i].Point0();
+      lo.Set(MinF(lo.x, c.x), MinF(lo.y, c.y), MinF(lo.z, c.z));
+      hi.Set(MaxF(hi.x, c.x), MaxF(hi.y, c.y), MaxF(hi.z, c.z));
+    }
+  });
+  for (u4 c = 1u; c < chunks; ++c)
+  {
+    low[0].Set(MinF(low[0].x, low[c].x), MinF(low[0].y, low[c].y),
+      MinF(low[0].z, low[c].z));
+    high[0].Set(MaxF(high[0].x, high[c].x), MaxF(high[0].y, high[c].y),
+      MaxF(high[0].z, high[c].z));
+  }
+
+  // Quantize centroids within their bounds (flat axes all map to 0)
+  bool wide = codes == Code63;
+  f4 cells = wide ? static_cast<f4>(1u << 21u) : 1024.0f;
+  u4 top = wide ? (1u << 21u) - 1u : 1023u;
+  v3f origin = low[0], extent = high[0] - low[0], scale;
+  for (s1 i = 0; i < 3; ++i)
+  {
+    scale[i] = (0.0f < extent[i]) ? cells / extent[i] : 0.0f;
+  }
+  ParallelFor(count, [&](u4 first, u4 last, u4)
+  {
+    for (u4 i = first; i < last; ++i)
+    {
+      v3f at = triangles[i].Point0() - origin;
+      u4 q[3];
+      for (s1 a = 0; a < 3; ++a)
+      {
+        f4 cell = at[a] * scale[a];
+        q[a] = (cell < static_cast<f4>(top)) ? static_cast<u4>(cell) : top;
+      }
+      code[i] = wide ? (Spread21(q[0]) << 2u | Spread21(q[1]) << 1u
+        | Spread21(q[2])) : (Spread10(q[0]) << 2u | Spread10(q[1]) << 1u
+        | Spread10(q[2]));
+      order[i] = i;
+    }
+  });
+
+  Sort();
+  parent[0] = u4_INVALID;
+  Link();
+  Climb(triangles, 0u);
+  return *this;
+
+} // end LBVH& LBVH::Construct(const T*, u4)                                  */
+
+
+s4 dp::LBVH::Delta(s4 i, s4 j) const
+{
+  if (j < 0 || static_cast<s4>(leaves) <= j) { return -1; }
+
+  u8 same = code[i] ^ code[j];
+  return same ? Clz(same) : 64 + Clz(static_cast<u8>(i ^ j));
+
+} // end s4 LBVH::Delta(s4, s4) const                                         */
+
+
+void dp::LBVH::Fit(u4 index)
+{
+  Node& n = node[index];
+  const Node& l = node[n.child[0]];
+  const Node& r = node[n.child[1]];
+  n.min.Set(MinF(l.min.x, r.min.x), MinF(l.min.y, r.min.y),
+    MinF(l.min.z, r.min.z));
+  n.max.Set(MaxF(l.max.x, r.max.x), MaxF(l.max.y, r.max.y),
+    MaxF(l.max.z, r.max.z));
+  cost[index] = TRAVERSE * n.Box().Area() + cost[n.child[0]]
+    + cost[n.child[1]];
+  size[index] = size[n.child[0]] + size[n.child[1]];
+
+} // end void LBVH::Fit(u4)                                                   */
+
+
+void dp::LBVH::Link(void)
+{
+  u4 first = leaves - 1u;
+  ParallelFor(first, [&](u4 begin, u4 end, u4)
+  {
+    for (u4 index = begin; index < end; ++index)
+    {
+      // Direction of the node's leaf run: toward the closer neighbour
+      s4 i = static_cast<s4>(index);
+      s4 d = (Delta(i, i - 1) < Delta(i, i + 1)) ? 1 : -1;
+
+      // Far end of the run: bound by doubling, then binary search
+      s4 least = Delta(i, i - d), reach = 2;
+      while (least < Delta(i, i + reach * d)) { reach <<= 1; }
+      s4 run = 0;
+      for (s4 step = reach >> 1; step; step >>= 1)
+      {
+        if (least < Delta(i, i + (run + step) * d)) { run += step; }
+      }
+      s4 j = i + run * d;
+
+      // Split: the last leaf sharing more than the run's common prefix
+      s4 common = Delta(i, j), split = 0, step = run;
+      do
+      {
+        step = (step + 1) >> 1;
+        if (common < Delta(i, i + (split + step) * d)) { split += step; }
+      } while (1 < step);
+      s4 gamma = i + split * d + (d < 0 ? d : 0);
+
+      // Children: a leaf if the split sits at the run's end, else internal
+      Node& n = node[index];
+      u4 low = static_cast<u4>(gamma), high = low + 1u;
+      n.child[0] = (gamma == (i < j ? i : j)) ? first + low : low;
+      n.child[1] = (gamma + 1 == (i < j ? j : i)) ? first + high : high;
+      parent[n.child[0]] = parent[n.child[1]] = index;
+    }
+  });
+
+} // end void LBVH::Link(void)                                                */
+
+
+void dp::LBVH::Restructure(u4 index, u4 treelet)
+{
+  // Grow the treelet by opening its largest internal leaf, until full
+  u4 leaf[TREELET_MAX], inner[TREELET_MAX - 1u], count = 2u, inners = 1u;
+  inner[0] = index;
+  leaf[0] = node[index].child[0];
+  leaf[1] = node[index].child[1];
+  while (count < treelet)
+  {
+    u4 widest = u4_INVALID;
+    f4 most = -1.0f;
+    for (u4 k = 0u; k < count; ++k)
+    {
+      if (IsLeaf(leaf[k])) { continue; }
+      f4 area = node[leaf[k]].Box().Area();
+      if (most < area) { most = area; widest = k; }
+    }
+    if (widest == u4_INVALID) { break; }
+
+    u4 opened = leaf[widest];
+    inner[inners++] = opened;
+    leaf[widest] = node[opened].child[0];
+    leaf[count++] = node[opened].child[1];
+  }
+
+  // Least cost of every subset of treelet leaves, smallest subsets first
+  // (each one's 2 part subsets are lower numbers, so already done)
+  const u4 sets = 1u << TREELET_MAX;
+  v3f low[sets], high[sets];
+  f4 least[sets];
+  u4 split[sets], leafs[sets];
+  for (u4 s = 1u; s < (1u << count); ++s)
+  {
+    u4 bit = s & (0u - s), rest = s ^ bit;
+    const Node& one = node[leaf[Bit(bit)]];
+    if (!rest)
+    {
+      low[s] = one.min;
+      high[s] = one.max;
+      least[s] = cost[leaf[Bit(bit)]];
+      leafs[s] = size[leaf[Bit(bit)]];
+      continue;
+    }
+    low[s].Set(MinF(low[rest].x, one.min.x), MinF(low[rest].y, one.min.y),
+      MinF(low[rest].z, one.min.z));
+    high[s].Set(MaxF(high[rest].x, one.max.x), MaxF(high[rest].y,
+      one.max.y), MaxF(high[rest].z, one.max.z));
+    leafs[s] = leafs[rest] + leafs[bit];
+
+    // Each split counted once: by the part holding the lowest leaf
+    f4 best = INf;
+    split[s] = bit;
+    for (u4 part = (s - 1u) & s; part; part = (part - 1u) & s)
+    {
+      if (!(part & bit)) { continue; }
+      f4 sum = least[part] + least[s ^ part];
+      if (sum < best) { best = sum; split[s] = part; }
+    }
+    least[s] = TRAVERSE * AABBCompact(low[s], high[s]).Area() + best;
+  }
+
+  u4 full = (1u << count) - 1u;
+  if (cost[index] <= least[full]) { return; }
+
+  // Relink top-down, handing the treelet's internal nodes out in turn
+  u4 set[TREELET_MAX - 1u], made = 1u;
+  set[0] = full;
+  for (u4 k = 0u; k < made; ++k)
+  {
+    u4 s = set[k], at = inner[k];
+    u4 part[2] = { split[s], s ^ split[s] };
+    for (u4 h = 0u; h < 2u; ++h)
+    {
+      u4 kid;
+      if (!(part[h] & (part[h] - 1u))) { kid = leaf[Bit(part[h])]; }
+      else
+      {
+        kid = inner[made];
+        set[made++] = part[h];
+      }
+      node[at].child[h] = kid;
+      parent[kid] = at;
+    }
+    node[at].min = low[s];
+    node[at].max = high[s];
+    cost[at] = least[s];
+    size[at] = leafs[s];
+  }
+
+} // end void LBVH::Restructure(u4, u4)                                       */
+
+
+void dp::LBVH::Sort(void)
+{
+  // 8 bit digits, least significant first: each pass a stable counting
+  // sort, with each chunk scattering its run into its own digit slots
+  u4 passes = (codes == Code63) ? 8u : 4u;
+  u4 chunks = ParallelChunks(leaves);
+  std::vector<u4> histogram(chunks * 256u);
+  for (u4 pass = 0u; pass < passes; ++pass)
+  {
+    u4 shift = pass * 8u;
+    ParallelFor(leaves, [&](u4 first, u4 last, u4 chunk)
+    {
+      u4* counts = &histogram[chunk * 256u];
+      for (u4 d = 0u; d < 256u; ++d) { counts[d] = 0u; }
+      for (u4 i = first; i < last; ++i)
+      {
+        ++counts[(code[i] >> shift) & 255u];
+      }
+    });
+
+    // Digit major, chunk minor prefix sum: each chunk's first slot per digit
+    u4 total = 0u;
+    bool sorted = false;
+    for (u4 d = 0u; d < 256u; ++d)
+    {
+      u4 digit = total;
+      for (u4 c = 0u; c < chunks; ++c)
+      {
+        u4 counted = histogram[c * 256u + d];
+        histogram[c * 256u + d] = total;
+        total += counted;
+      }
+      sorted |= (total - digit == leaves);
+    }
+    if (sorted) { continue; } // Every code shares this digit: order holds
+
+    ParallelFor(leaves, [&](u4 first, u4 last, u4 chunk)
+    {
+      u4* slots = &histogram[chunk * 256u];
+      for (u4 i = first; i < last; ++i)
+      {
+        u4 at = slots[(code[i] >> shift) & 255u]++;
+        codeSwap[at] = code[i];
+        orderSwap[at] = order[i];
+      }
+    });
+    code.swap(codeSwap);
+    order.swap(orderSwap);
+  }
+
+} // end void LBVH::Sort(void)                                                */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Helper Functions                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+f8 dp::LBVHBenchmark(u4 triangles, u4 builds, f8* cost)
+{
+  // Fixed seed linear congruential generator: repeatable runs to compare
+  u4 seed = 0x2545F491u;
+  auto random = [&seed](void)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    return static_cast<f4>(seed >> 8) * (1.0f / 16777216.0f);
+  };
+
+  // Unit triangles strewn through a slab of 100 x 30 x 100 units
+  std::vector<Triangle> mesh(triangles);
+  for (Triangle& t : mesh)
+  {
+    v3f at(random() * 100.0f, random() * 30.0f, random() * 100.0f);
+    v3f a(random(), random(), random());
+    v3f b(random(), random(), random());
+    v3f c(random(), random(), random());
+    t = Triangle(at + a - v3f(AHALF, AHALF, AHALF),
+      at + b - v3f(AHALF, AHALF, AHALF), at + c - v3f(AHALF, AHALF, AHALF));
+  }
+  LBVH tree;
+  tree.Build(mesh);
+
+  auto start = std::chrono::steady_clock::now();
+  for (u4 b = 0; b < builds; ++b)
+  {
+    tree.Build(mesh);
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  if (cost) { *cost = static_cast<f8>(tree.Cost()); }
+  if (!builds) { return 0.0; }
+  return std::chrono::duration<f8, std::milli>(end - start).count() / builds;
+
+} // end f8 LBVHBenchmark(u4, u4, f8*)                                        */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                          Explicit Instantiations                           */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+template u4 dp::LBVH::Intersect<dp::Triangle>(const Triangle*, const m4f&,
+  const LBVH&, const Triangle*, const m4f&, std::vector<Pair>&, bool, bool)
+  const;
+template u4 dp::LBVH::Intersect<dp::TriangleCompact>(const TriangleCompact*,
+  const m4f&, const LBVH&, const TriangleCompact*, const m4f&,
+  std::vector<Pair>&, bool, bool) const;
+template u4 dp::LBVH::Query<4u>(const RayPacket<4u>&, std::vector<LaneHit>&)
+  const;
+template u4 dp::LBVH::Query<8u>(const RayPacket<8u>&, std::vector<LaneHit>&)
+  const;
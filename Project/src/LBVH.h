@@ -0,0 +1,461 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  LBVH.h
+Purpose:  Linear BVH: parallel per frame rebuild of a triangle hierarchy
+Details:  each triangle's centroid is quantized within the centroids' bounds
+  and bit interleaved into a Morton code (30 or 63 bits), so sorting the
+  codes lays triangles out along a Z-order curve.  The sorted codes then
+  fix the whole hierarchy: every internal node covers the run of leaves
+  sharing its longest common code prefix, and splits it where that prefix
+  ends (Karras' method).  Each internal node finds its own run and split
+  with no knowledge of any other node, so all are built at once.
+
+  Boxes are then fit bottom-up, one thread per leaf climbing toward the
+  root: the first child to arrive at a node stops there, the second (which
+  sees both children done) fits it and carries on.  The same climb serves
+  Refit(), for deforming meshes whose topology holds, and Optimize(), which
+  restructures small treelets (5 leaves by default, 3 to 7) to their lowest
+  SAH cost on the way, buying back some of the quality a spatial sort gives up.
+
+  Two placed meshes are intersected by walking both hierarchies at once:
+  node pairs whose boxes are disjoint (the other's box placed by the relative
+  transform, an oriented box tested on the 6 face axes) drop every triangle
+  pair beneath them, so only the few leaf pairs near contact are tested.
+
+  Build steps are parallel over ParallelFor(): codes, a radix sort (8 bit
+  digits, stable per chunk scatter), node links and the climb.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <atomic>   // Child arrival counts of the bottom-up climb
+#include <memory>   // Owned array of atomics (not copyable into a vector)
+#include <vector>   // Node / sorted code lists, query result lists
+
+// "./src/..."
+#include "AABBCompact.h"  // Node box area / overlap / ray tests
+#include "v3f.h"          // Node box extrema members
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class AABB;     // Queried region
+  class Frustum;  // Queried view volume
+  class m4f;      // Placement of each hierarchy's mesh, for mesh / mesh tests
+  class Ray;      // Queried line of sight
+  class Triangle; // Leaf primitives, binned by centroid
+  class TriangleCompact;  // Leaf primitives, packed to their points
+  struct LaneHit; // Triangle reached by a packet, with the lanes reaching it
+
+  template <u4 LANES>
+  class RayPacket;  // Queried lines of sight, tested together
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! Linear BVH over a triangle set, rebuilt or refit in parallel per frame
+  class LBVH
+  {
+  public:
+
+    //! Morton code widths: more bits split dense clusters apart further
+    enum Codes
+    {
+      Code30, //! 10 bits per axis: 4 sort passes, fine for most meshes
+      Code63  //! 21 bits per axis: 8 sort passes, for large / uneven scenes
+    };
+
+    //! Hierarchy node: internal nodes come first, the root at 0, then leaves
+    struct Node
+    {
+      v3f min;      //! Lowest corner of the node's box
+      v3f max;      //! Highest corner of the node's box
+      u4 child[2];  //! Child nodes; leaves: triangle index, then u4_INVALID
+
+      //! Get the node's box, for its area / overlap / ray tests
+      inline AABBCompact Box(void) const { return AABBCompact(min, max); }
+    };
+
+    //! Triangles (one from each of 2 hierarchies) found intersecting
+    struct Pair
+    {
+      u4 a; //! Triangle index in this hierarchy's set
+      u4 b; //! Triangle index in the other hierarchy's set
+    };
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create an empty hierarchy, using the given Morton code width
+    \brief
+      - create an empty hierarchy, using the given Morton code width
+    \param codes
+      - bits of each centroid's Morton code, for following builds
+    */
+    LBVH(Codes codes = Code30);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Rebuild the hierarchy over a set of triangles (in parallel)
+    \brief
+      - rebuild the hierarchy over a set of triangles (in parallel)
+    \param triangles
+      - world space triangles, by index as named in leaves / query results
+    \param count
+      - number of triangles in the set
+    \return
+      - reference to the hierarchy for easier subsequent inline action
+    */
+    LBVH& Build(const Triangle* triangles, u4 count);
+
+
+    /** Rebuild the hierarchy over a set of compact triangles (in parallel)
+    \brief
+      - rebuild the hierarchy over a set of compact triangles (in parallel)
+    \param triangles
+      - world space triangles, by index as named in leaves / query results
+    \param count
+      - number of triangles in the set
+    \return
+      - reference to the hierarchy for easier subsequent inline action
+    */
+    LBVH& Build(const TriangleCompact* triangles, u4 count);
+
+
+    /** Rebuild the hierarchy over a list of triangles (in parallel)
+    \brief
+      - rebuild the hierarchy over a list of triangles (in parallel)
+    \param triangles
+      - world space triangles, by index as named in leaves / query results
+    \return
+      - reference to the hierarchy for easier subsequent inline action
+    */
+    LBVH& Build(const std::vector<Triangle>& triangles);
+
+
+    /** Get the Morton code width used by following builds
+    \brief
+      - get the Morton code width used by following builds
+    \return
+      - Morton code width
+    */
+    inline Codes CodeBits(void) const
+    { return codes; } // end Codes LBVH::CodeBits(void) const                 */
+
+
+    /** Set the Morton code width used by following builds
+    \brief
+      - set the Morton code width used by following builds
+    \param bits
+      - Morton code width
+    \return
+      - reference to the hierarchy for easier subsequent inline action
+    */
+    inline LBVH& CodeBits(Codes bits)
+    { codes = bits; return *this; } // end LBVH& LBVH::CodeBits(Codes)        */
+
+
+    /** Get the SAH cost of the hierarchy: internal node areas over the root's
+    \brief
+      - get the SAH cost of the hierarchy: internal node areas over the root's
+    \return
+      - summed internal node surface areas, relative to the root's (0 if none)
+    */
+    f4 Cost(void) const;
+
+
+    /** Get the number of triangles in the hierarchy, as of the last Build()
+    \brief
+      - get the number of triangles in the hierarchy, as of the last Build()
+    \return
+      - count of leaves
+    */
+    inline u4 Count(void) const
+    { return leaves; } // end u4 LBVH::Count(void) const                      */
+
+
+    /** Get the triangle pairs where 2 placed meshes intersect
+    \brief
+      - get the triangle pairs where 2 placed meshes intersect
+    \details
+      - both hierarchies are walked at once, each built over its mesh in model
+      space, so neither needs a rebuild as the meshes move; the other mesh is
+      brought into this one's space by the relative placement.  If parallel,
+      the overlapping node pairs at the top levels are split into tasks (a few
+      per thread), each walked on its own thread
+    \param triangles
+      - this hierarchy's built set of triangles, in model space
+    \param place
+      - placement of this mesh from model to world space
+    \param other
+      - hierarchy of the other mesh
+    \param others
+      - other hierarchy's built set of triangles, in its model space
+    \param otherPlace
+      - placement of the other mesh from model to world space
+    \param found
+      - list to be filled (after being cleared) with intersecting pairs
+    \param first
+      - stop at the first pair found (found holds 1 pair, if any)
+    \param parallel
+      - split the walk into tasks over the hardware's threads
+    \return
+      - count of pairs found
+    */
+    template <typename T>
+    u4 Intersect(const T* triangles, const m4f& place, const LBVH& other,
+      const T* others, const m4f& otherPlace, std::vector<Pair>& found,
+      bool first = false, bool parallel = true) const;
+
+
+    /** Check if a node is a leaf
+    \brief
+      - check if a node is a leaf
+    \param index
+      - node subscript, as found in Nodes() / a node's child links
+    \return
+      - true if the node holds a triangle rather than 2 children
+    */
+    inline bool IsLeaf(u4 index) const
+    { return leaves - 1u <= index; } // end bool LBVH::IsLeaf(u4) const       */
+
+
+    /** Access the node list, for custom traversals (root at 0 if not empty)
+    \brief
+      - access the node list, for custom traversals (root at 0 if not empty)
+    \return
+      - reference to the node list
+    */
+    inline const std::vector<Node>& Nodes(void) const
+    { return node; } // end const vector<Node>& LBVH::Nodes(void) const       */
+
+
+    /** Restructure treelets to lower the hierarchy's SAH cost (in parallel)
+    \brief
+      - restructure treelets to lower the hierarchy's SAH cost (in parallel)
+    \details
+      - each round climbs the hierarchy bottom-up, and at each node over
+      enough leaves, opens its largest descendants into a treelet of the
+      given leaf count, relinking them into whichever of their possible
+      topologies costs least; costs only ever drop, though each round gains
+      less than the last.  Work per node grows as 3^treelet: 7 leaves buy a
+      few % more quality than 5, for about 5 times the time
+    \param rounds
+      - number of bottom-up passes to be made
+    \param treelet
+      - leaves per treelet (5 by default), clamped into [3, 7]
+    \return
+      - reference to the hierarchy for easier subsequent inline action
+    */
+    LBVH& Optimize(u4 rounds = 1u, u4 treelet = 5u);
+
+
+    /** Get triangles whose boxes overlap a box
+    \brief
+      - get triangles whose boxes overlap a box
+    \param box
+      - world space region to be queried
+    \param found
+      - list to be filled (after being cleared) with triangle indices
+    \return
+      - count of triangles found
+    */
+    u4 Query(const AABB& box, std::vector<u4>& found) const;
+
+
+    /** Get triangles whose boxes are at least partly within a view volume
+    \brief
+      - get triangles whose boxes are at least partly within a view volume
+    \details
+      - each node passes its children the mask of planes still cutting it,
+      so planes it is wholly behind are not tested again below it
+    \param frustum
+      - view volume to be queried, in the hierarchy's space
+    \param found
+      - list to be filled (after being cleared) with triangle indices
+    \return
+      - count of triangles found
+    */
+    u4 Query(const Frustum& frustum, std::vector<u4>& found) const;
+
+
+    /** Get triangles whose boxes a ray passes through
+    \brief
+      - get triangles whose boxes a ray passes through
+    \param ray
+      - world space ray to be cast
+    \param found
+      - list to be filled (after being cleared) with triangle indices
+    \param tMax
+      - farthest distance along the ray to be queried
+    \return
+      - count of triangles found
+    */
+    u4 Query(const Ray& ray, std::vector<u4>& found, f4 tMax = INf) const;
+
+
+    /** Get triangles whose boxes any ray of a packet passes through
+    \brief
+      - get triangles whose boxes any ray of a packet passes through
+    \details
+      - the packet walks the hierarchy as one, entering a node if any active
+      ray reaches it, and testing only the lanes that reached its parent:
+      coherent rays (primary / shadow) share nearly every node visited, so
+      each 4 / 8 lane box test does the work of as many single ray tests
+    \param packet
+      - world space rays to be cast, each over [0, its Far()]
+    \param found
+      - list to be filled (after being cleared) with each triangle reached,
+      and the mask of the lanes whose rays reach it
+    \return
+      - count of triangles found
+    */
+    template <u4 LANES>
+    u4 Query(const RayPacket<LANES>& packet, std::vector<LaneHit>& found) const;
+
+
+    /** Refit every node box to moved triangles, keeping the topology
+    \brief
+      - refit every node box to moved triangles, keeping the topology
+    \details
+      - far cheaper than a rebuild for deforming meshes, but the hierarchy
+      grows worse as triangles drift from where they were sorted
+    \param triangles
+      - the built set of triangles, by the same indices, in new positions
+    \return
+      - reference to the hierarchy for easier subsequent inline action
+    */
+    LBVH& Refit(const Triangle* triangles);
+
+
+    /** Refit every node box to moved triangles, keeping the topology
+    \brief
+      - refit every node box to moved triangles, keeping the topology
+    \details
+      - far cheaper than a rebuild for deforming meshes, but the hierarchy
+      grows worse as triangles drift from where they were sorted
+    \param triangles
+      - the built set of triangles, by the same indices, in new positions
+    \return
+      - reference to the hierarchy for easier subsequent inline action
+    */
+    LBVH& Refit(const TriangleCompact* triangles);
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                           Private Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Fit every internal node from its children, leaves up (first fitting
+    //! leaves to the triangles if given, restructuring treelets of the given
+    //! leaf count if not 0)
+    template <typename T>
+    void Climb(const T* triangles, u4 treelet);
+
+    //! Rebuild the hierarchy over triangles of any type giving Point0(), A(),
+    //! B() and C()
+    template <typename T>
+    LBVH& Construct(const T* triangles, u4 count);
+
+    //! Get the common prefix length of 2 sorted leaves' codes (index broken
+    //! ties counted past 64 bits), or -1 if the 2nd is out of range
+    s4 Delta(s4 i, s4 j) const;
+
+    //! Fit an internal node's box, cost & leaf count from its children
+    void Fit(u4 index);
+
+    //! Link each internal node to its children by Karras' split search
+    void Link(void);
+
+    //! Relink the treelet under a node into its lowest cost topology
+    void Restructure(u4 index, u4 treelet);
+
+    //! Sort leaf codes (with their triangle indices) by parallel radix sort
+    void Sort(void);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Nodes: leaves - 1 internal nodes, then leaves in sorted code order
+    std::vector<Node> node;
+
+    //! Parent of each node (u4_INVALID for the root)
+    std::vector<u4> parent;
+
+    //! SAH cost of each node's subtree, for treelet restructuring
+    std::vector<f4> cost;
+
+    //! Leaves under each node, for treelet restructuring
+    std::vector<u4> size;
+
+    //! Morton code of each leaf, sorted
+    std::vector<u8> code;
+
+    //! Morton code sort scratch
+    std::vector<u8> codeSwap;
+
+    //! Triangle index of each leaf, in sorted code order
+    std::vector<u4> order;
+
+    //! Triangle index sort scratch
+    std::vector<u4> orderSwap;
+
+    //! Children arrived at each internal node during a climb
+    std::unique_ptr<std::atomic<u4>[]> arrived;
+
+    //! Internal node slots the arrival count array holds
+    u4 capacity;
+
+    //! Triangles in the hierarchy
+    u4 leaves;
+
+    //! Morton code width used by builds
+    Codes codes;
+
+  }; // end LBVH class declaration
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                      Helper Function Declarations                        */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  /** Get average milliseconds per build of a hierarchy over a random mesh
+  \brief
+    - get average milliseconds per build of a hierarchy over a random mesh
+  \details
+    - unit triangles strewn through a wide, flat slab; the first (cold
+    allocation) build is not part of the timing.  Each build step runs over
+    ParallelThreads(), so the time measures the machine's scaling
+  \param triangles
+    - count of triangles in the mesh
+  \param builds
+    - count of timed builds
+  \param cost
+    - SAH cost of the last build (relative to its root's area), if given
+  \return
+    - average wall clock milliseconds spent per build
+  */
+  f8 LBVHBenchmark(u4 triangles = 1000000u, u4 builds = 4u,
+    f8* cost = nullptr);
+
+} // end dp namespace
@@ -0,0 +1,1022 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  MatVec.h
+Purpose:  Compile time sized Vec<N> & column major Mat<R, C> templates
+Details:  vNf / mNf / mNMf are sized at runtime, so even a 3 element vector
+  costs a heap allocation; v2f...v6f & m2f...m4f are fixed, but each size is
+  its own hand written class.  Vec<N> & Mat<R, C> are sized by template
+  argument: cells live in the object itself (no heap traffic), & every loop
+  runs a compile time count the optimizer fully unrolls for small sizes.
+
+  Layout matches the hand written classes: Vec<N> is exactly N f4's, as
+  v2f, v3f, v4f & v6f are, & Mat<R, C> is C column Vec<R>'s, as m2f, m3f &
+  m4f are columns of v2f, v3f & v4f.  Each converts to & from its matching
+  class by plain copy, so code can adopt the templates a piece at a time.
+
+  Square determinants & inverses are written out for N of 2, 3 & 4 (cofactor
+  expansion, no branching but the singular check); larger N use partial
+  pivoted elimination on a local copy.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_MAT300_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// "./src/..."
+#include "m2f.h"        // 2x2 matrices sharing Mat<2, 2>'s layout
+#include "m3f.h"        // 3x3 matrices sharing Mat<3, 3>'s layout
+#include "m4f.h"        // 4x4 matrices sharing Mat<4, 4>'s layout
+#include "TypeErrata.h" // Platform primitive type aliases for easier porting
+#include "v2f.h"        // 2D vectors sharing Vec<2>'s layout
+#include "v3f.h"        // 3D vectors sharing Vec<3>'s layout
+#include "v4f.h"        // 4D vectors sharing Vec<4>'s layout
+#include "v6f.h"        // 6D vectors sharing Vec<6>'s layout
+#include "Value.h"      // Basic numerical operations: abs, sqrt, near
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Layout Mappings                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  //! Stand in for sizes with no hand written class (never constructed)
+  struct FixedNone { };
+
+  //! Hand written vector class sharing Vec<N>'s layout (if any)
+  template <u4 N> struct FixedVec { using type = FixedNone; };
+  template <> struct FixedVec<2u> { using type = v2f; };
+  template <> struct FixedVec<3u> { using type = v3f; };
+  template <> struct FixedVec<4u> { using type = v4f; };
+  template <> struct FixedVec<6u> { using type = v6f; };
+
+  //! Hand written matrix class sharing Mat<R, C>'s layout (if any)
+  template <u4 R, u4 C> struct FixedMat { using type = FixedNone; };
+  template <> struct FixedMat<2u, 2u> { using type = m2f; };
+  template <> struct FixedMat<3u, 3u> { using type = m3f; };
+  template <> struct FixedMat<4u, 4u> { using type = m4f; };
+
+  template <u4 N> struct Square; // Determinant & inverse, per square size
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  template <u4 N>
+  class Vec //! Compile time sized [Vec]tor of N 4-byte floats
+  {
+  public:
+
+    static_assert(0u < N, "Vec must have at least 1 element");
+
+    //! Hand written class of the same layout (FixedNone if there isn't one)
+    using Fixed = typename FixedVec<N>::type;
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create a vector of all 0 elements
+    \brief
+      - create a vector of all 0 elements
+    */
+    constexpr Vec(void) : v{ }
+    { } // end constexpr Vec<N>::Vec(void)                                    */
+
+
+    /** Create a vector with every element set to the same value
+    \brief
+      - create a vector with every element set to the same value
+    \param value
+      - value of every element
+    */
+    constexpr explicit Vec(f4 value) : v{ }
+    {
+      for (u4 i = 0; i < N; ++i) { v[i] = value; }
+
+    } // end constexpr Vec<N>::Vec(f4)                                        */
+
+
+    /** Create a vector from a value per element, in order
+    \brief
+      - create a vector from a value per element, in order
+    \param first
+      - element [0] value
+    \param second
+      - element [1] value
+    \param rest
+      - element [2, N) values: exactly N values must be given
+    */
+    template <typename... F>
+    constexpr Vec(f4 first, f4 second, F... rest)
+      : v{ first, second, static_cast<f4>(rest)... }
+    {
+      static_assert(sizeof...(F) + 2u == N, "Vec needs exactly N values");
+
+    } // end constexpr Vec<N>::Vec(f4, f4, F...)                              */
+
+
+    /** Create a copy of the hand written vector of the same layout
+    \brief
+      - create a copy of the hand written vector of the same layout
+    \param fixed
+      - v2f, v3f, v4f or v6f (for N of 2, 3, 4 or 6) to copy
+    */
+    Vec(const Fixed& fixed)
+    {
+      static_assert(sizeof(Fixed) == sizeof(Vec), "Vec layout mismatch");
+      for (u4 i = 0u; i < N; ++i) { v[i] = fixed[static_cast<s1>(i)]; }
+
+    } // end Vec<N>::Vec(const Fixed&)                                        */
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the dot product of this & another vector
+    \brief
+      - get the dot product of this & another vector
+    \param other
+      - right hand vector
+    \return
+      - sum of products of matching elements
+    */
+    constexpr f4 Dot(const Vec& other) const
+    {
+      f4 sum = 0.0f;
+      for (u4 i = 0; i < N; ++i) { sum += v[i] * other.v[i]; }
+      return sum;
+
+    } // end constexpr f4 Vec<N>::Dot(const Vec&) const                       */
+
+
+    /** Get the length (magnitude) of the vector
+    \brief
+      - get the length (magnitude) of the vector
+    \return
+      - square root of the vector dotted with itself
+    */
+    inline f4 Length(void) const
+    { return SqrtF(Dot(*this)); } // end f4 Vec<N>::Length(void) const        */
+
+
+    /** Get the squared length of the vector (no square root)
+    \brief
+      - get the squared length of the vector (no square root)
+    \return
+      - the vector dotted with itself
+    */
+    constexpr f4 LengthSquared(void) const
+    { return Dot(*this); } // end f4 Vec<N>::LengthSquared(void) const        */
+
+
+    /** Get a copy of the vector scaled to length 1
+    \brief
+      - get a copy of the vector scaled to length 1
+    \return
+      - unit vector in the same direction, or all 0's if the length is 0
+    */
+    inline Vec UnitVec(void) const
+    {
+      f4 length = Length();
+      return NearF(length, 0.0f, _INf) ? Vec() : *this / length;
+
+    } // end Vec Vec<N>::UnitVec(void) const                                  */
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Operator Overloads                            */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get a copy of the hand written vector of the same layout
+    \brief
+      - get a copy of the hand written vector of the same layout
+    \return
+      - v2f, v3f, v4f or v6f (for N of 2, 3, 4 or 6) of the same elements
+    */
+    operator Fixed(void) const
+    {
+      Fixed fixed;
+      for (u4 i = 0u; i < N; ++i) { fixed[static_cast<s1>(i)] = v[i]; }
+      return fixed;
+
+    } // end Vec<N>::operator Fixed(void) const                               */
+
+
+    /** Get the negated vector
+    \brief
+      - get the negated vector
+    \return
+      - copy with each element's sign flipped
+    */
+    constexpr Vec operator-(void) const
+    { return *this * -1.0f; } // end constexpr Vec Vec<N>::operator-(void)    */
+
+
+    /** Get an element's value
+    \brief
+      - get an element's value
+    \param i
+      - element subscript [0, N)
+    \return
+      - value of the element
+    */
+    constexpr f4 operator[](u4 i) const
+    { return v[i]; } // end constexpr f4 Vec<N>::operator[](u4) const         */
+
+
+    /** Get a reference to an element
+    \brief
+      - get a reference to an element
+    \param i
+      - element subscript [0, N)
+    \return
+      - reference to the element
+    */
+    constexpr f4& operator[](u4 i)
+    { return v[i]; } // end constexpr f4& Vec<N>::operator[](u4)              */
+
+
+    /** Get the memberwise sum of this & another vector
+    \brief
+      - get the memberwise sum of this & another vector
+    \param other
+      - right hand vector
+    \return
+      - vector of the sums of matching elements
+    */
+    constexpr Vec operator+(const Vec& other) const
+    { return Vec(*this) += other; } // end constexpr Vec Vec<N>::operator+    */
+
+
+    /** Set this to the memberwise sum of this & another vector
+    \brief
+      - set this to the memberwise sum of this & another vector
+    \param other
+      - right hand vector
+    \return
+      - reference to the modified vector for easier subsequent inline action
+    */
+    constexpr Vec& operator+=(const Vec& other)
+    {
+      for (u4 i = 0; i < N; ++i) { v[i] += other.v[i]; }
+      return *this;
+
+    } // end constexpr Vec& Vec<N>::operator+=(const Vec&)                    */
+
+
+    /** Get the memberwise difference of this & another vector
+    \brief
+      - get the memberwise difference of this & another vector
+    \param other
+      - right hand vector
+    \return
+      - vector of the differences of matching elements
+    */
+    constexpr Vec operator-(const Vec& other) const
+    { return Vec(*this) -= other; } // end constexpr Vec Vec<N>::operator-    */
+
+
+    /** Set this to the memberwise difference of this & another vector
+    \brief
+      - set this to the memberwise difference of this & another vector
+    \param other
+      - right hand vector
+    \return
+      - reference to the modified vector for easier subsequent inline action
+    */
+    constexpr Vec& operator-=(const Vec& other)
+    {
+      for (u4 i = 0; i < N; ++i) { v[i] -= other.v[i]; }
+      return *this;
+
+    } // end constexpr Vec& Vec<N>::operator-=(const Vec&)                    */
+
+
+    /** Get the vector scaled uniformly
+    \brief
+      - get the vector scaled uniformly
+    \param scalar
+      - amount by which to multiply every element
+    \return
+      - scaled copy of the vector
+    */
+    constexpr Vec operator*(f4 scalar) const
+    { return Vec(*this) *= scalar; } // end constexpr Vec Vec<N>::operator*   */
+
+
+    /** Set the vector to be scaled uniformly
+    \brief
+      - set the vector to be scaled uniformly
+    \param scalar
+      - amount by which to multiply every element
+    \return
+      - reference to the modified vector for easier subsequent inline action
+    */
+    constexpr Vec& operator*=(f4 scalar)
+    {
+      for (u4 i = 0; i < N; ++i) { v[i] *= scalar; }
+      return *this;
+
+    } // end constexpr Vec& Vec<N>::operator*=(f4)                            */
+
+
+    /** Get the vector divided uniformly
+    \brief
+      - get the vector divided uniformly
+    \param divisor
+      - amount by which to divide every element (multiplies by 1 / divisor)
+    \return
+      - divided copy of the vector
+    */
+    constexpr Vec operator/(f4 divisor) const
+    { return Vec(*this) *= 1.0f / divisor; } // end constexpr Vec operator/   */
+
+
+    /** Set the vector to be divided uniformly
+    \brief
+      - set the vector to be divided uniformly
+    \param divisor
+      - amount by which to divide every element (multiplies by 1 / divisor)
+    \return
+      - reference to the modified vector for easier subsequent inline action
+    */
+    constexpr Vec& operator/=(f4 divisor)
+    { return *this *= 1.0f / divisor; } // end constexpr Vec& operator/=(f4)  */
+
+
+    /** Check if each element is exactly equal to another vector's
+    \brief
+      - check if each element is exactly equal to another vector's
+    \param other
+      - vector to compare against
+    \return
+      - true if all matching elements are equal, otherwise false
+    */
+    constexpr bool operator==(const Vec& other) const
+    {
+      for (u4 i = 0; i < N; ++i)
+      {
+        if (v[i] != other.v[i]) { return false; }
+      }
+      return true;
+
+    } // end constexpr bool Vec<N>::operator==(const Vec&) const              */
+
+
+    /** Check if any element differs from another vector's
+    \brief
+      - check if any element differs from another vector's
+    \param other
+      - vector to compare against
+    \return
+      - true if any matching elements differ, otherwise false
+    */
+    constexpr bool operator!=(const Vec& other) const
+    { return !(*this == other); } // end constexpr bool Vec<N>::operator!=    */
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Members                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Sequential element values (as the hand written classes' v arrays)
+    f4 v[N];
+
+  }; // end Vec class declaration
+
+
+  template <u4 R, u4 C>
+  class Mat //! Compile time sized, column major [Mat]rix of R x C floats
+  {
+  public:
+
+    static_assert(0u < R && 0u < C, "Mat must have at least 1 cell");
+
+    //! Hand written class of the same layout (FixedNone if there isn't one)
+    using Fixed = typename FixedMat<R, C>::type;
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create a matrix of all 0 cells
+    \brief
+      - create a matrix of all 0 cells
+    */
+    constexpr Mat(void) : col{ }
+    { } // end constexpr Mat<R, C>::Mat(void)                                 */
+
+
+    /** Create a matrix with a value along the trace, 0 elsewhere
+    \brief
+      - create a matrix with a value along the trace, 0 elsewhere
+    \param trace
+      - value of each (i, i) cell (1 for the identity)
+    */
+    constexpr explicit Mat(f4 trace) : col{ }
+    {
+      for (u4 i = 0; i < (R < C ? R : C); ++i) { col[i][i] = trace; }
+
+    } // end constexpr Mat<R, C>::Mat(f4)                                     */
+
+
+    /** Create a matrix from its columns, in order
+    \brief
+      - create a matrix from its columns, in order
+    \param first
+      - column [0]
+    \param rest
+      - columns [1, C): exactly C columns must be given
+    */
+    template <typename... V>
+    constexpr Mat(const Vec<R>& first, const V&... rest)
+      : col{ first, rest... }
+    {
+      static_assert(sizeof...(V) + 1u == C, "Mat needs exactly C columns");
+
+    } // end constexpr Mat<R, C>::Mat(const Vec<R>&, const V&...)             */
+
+
+    /** Create a copy of the hand written matrix of the same layout
+    \brief
+      - create a copy of the hand written matrix of the same layout
+    \param fixed
+      - m2f, m3f or m4f (for 2x2, 3x3 or 4x4) to copy
+    */
+    Mat(const Fixed& fixed)
+    {
+      static_assert(sizeof(Fixed) == sizeof(Mat), "Mat layout mismatch");
+      for (u4 c = 0u; c < C; ++c)
+      {
+        for (u4 r = 0u; r < R; ++r)
+        {
+          col[c][r] = fixed[c][static_cast<s1>(r)];
+        }
+      }
+
+    } // end Mat<R, C>::Mat(const Fixed&)                                     */
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the determinant of a square matrix
+    \brief
+      - get the determinant of a square matrix
+    \return
+      - determinant (cofactor expansion for N <= 4, elimination past that)
+    */
+    inline f4 Det(void) const
+    {
+      static_assert(R == C, "Det requires a square Mat");
+      return Square<R>::Det(*this);
+
+    } // end f4 Mat<R, C>::Det(void) const                                    */
+
+
+    /** Get the inverse of a square matrix
+    \brief
+      - get the inverse of a square matrix
+    \return
+      - inverse matrix, or all 0's if the matrix is singular (determinant ~0)
+    */
+    inline Mat Inverse(void) const
+    {
+      static_assert(R == C, "Inverse requires a square Mat");
+      return Square<R>::Inverse(*this);
+
+    } // end Mat Mat<R, C>::Inverse(void) const                               */
+
+
+    /** Get a row of the matrix as a vector
+    \brief
+      - get a row of the matrix as a vector
+    \param r
+      - row subscript [0, R)
+    \return
+      - the row's C cells
+    */
+    constexpr Vec<C> Row(u4 r) const
+    {
+      Vec<C> row;
+      for (u4 c = 0; c < C; ++c) { row[c] = col[c][r]; }
+      return row;
+
+    } // end constexpr Vec<C> Mat<R, C>::Row(u4) const                        */
+
+
+    /** Get the sum of the cells along the trace
+    \brief
+      - get the sum of the cells along the trace
+    \return
+      - sum of each (i, i) cell
+    */
+    constexpr f4 Trace(void) const
+    {
+      f4 sum = 0.0f;
+      for (u4 i = 0; i < (R < C ? R : C); ++i) { sum += col[i][i]; }
+      return sum;
+
+    } // end constexpr f4 Mat<R, C>::Trace(void) const                        */
+
+
+    /** Get the matrix with rows & columns swapped
+    \brief
+      - get the matrix with rows & columns swapped
+    \return
+      - C x R matrix whose column c is this matrix's row c
+    */
+    constexpr Mat<C, R> Transposed(void) const
+    {
+      Mat<C, R> transpose;
+      for (u4 c = 0; c < C; ++c)
+      {
+        for (u4 r = 0; r < R; ++r) { transpose[r][c] = col[c][r]; }
+      }
+      return transpose;
+
+    } // end constexpr Mat<C, R> Mat<R, C>::Transposed(void) const            */
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Operator Overloads                            */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get a copy of the hand written matrix of the same layout
+    \brief
+      - get a copy of the hand written matrix of the same layout
+    \return
+      - m2f, m3f or m4f (for 2x2, 3x3 or 4x4) of the same cells
+    */
+    operator Fixed(void) const
+    {
+      Fixed fixed;
+      for (u4 c = 0u; c < C; ++c)
+      {
+        for (u4 r = 0u; r < R; ++r)
+        {
+          fixed[c][static_cast<s1>(r)] = col[c][r];
+        }
+      }
+      return fixed;
+
+    } // end Mat<R, C>::operator Fixed(void) const                            */
+
+
+    /** Get a column of the matrix
+    \brief
+      - get a column of the matrix
+    \param c
+      - column subscript [0, C)
+    \return
+      - the column's R cells
+    */
+    constexpr const Vec<R>& operator[](u4 c) const
+    { return col[c]; } // end constexpr const Vec<R>& Mat<R, C>::operator[]   */
+
+
+    /** Get a reference to a column of the matrix
+    \brief
+      - get a reference to a column of the matrix
+    \param c
+      - column subscript [0, C)
+    \return
+      - reference to the column's R cells
+    */
+    constexpr Vec<R>& operator[](u4 c)
+    { return col[c]; } // end constexpr Vec<R>& Mat<R, C>::operator[](u4)     */
+
+
+    /** Get the memberwise sum of this & another matrix
+    \brief
+      - get the memberwise sum of this & another matrix
+    \param other
+      - right hand matrix
+    \return
+      - matrix of the sums of matching cells
+    */
+    constexpr Mat operator+(const Mat& other) const
+    { return Mat(*this) += other; } // end constexpr Mat Mat<R, C>::operator+ */
+
+
+    /** Set this to the memberwise sum of this & another matrix
+    \brief
+      - set this to the memberwise sum of this & another matrix
+    \param other
+      - right hand matrix
+    \return
+      - reference to the modified matrix for easier subsequent inline action
+    */
+    constexpr Mat& operator+=(const Mat& other)
+    {
+      for (u4 c = 0; c < C; ++c) { col[c] += other.col[c]; }
+      return *this;
+
+    } // end constexpr Mat& Mat<R, C>::operator+=(const Mat&)                 */
+
+
+    /** Get the memberwise difference of this & another matrix
+    \brief
+      - get the memberwise difference of this & another matrix
+    \param other
+      - right hand matrix
+    \return
+      - matrix of the differences of matching cells
+    */
+    constexpr Mat operator-(const Mat& other) const
+    { return Mat(*this) -= other; } // end constexpr Mat Mat<R, C>::operator- */
+
+
+    /** Set this to the memberwise difference of this & another matrix
+    \brief
+      - set this to the memberwise difference of this & another matrix
+    \param other
+      - right hand matrix
+    \return
+      - reference to the modified matrix for easier subsequent inline action
+    */
+    constexpr Mat& operator-=(const Mat& other)
+    {
+      for (u4 c = 0; c < C; ++c) { col[c] -= other.col[c]; }
+      return *this;
+
+    } // end constexpr Mat& Mat<R, C>::operator-=(const Mat&)                 */
+
+
+    /** Get the matrix scaled uniformly
+    \brief
+      - get the matrix scaled uniformly
+    \param scalar
+      - amount by which to multiply every cell
+    \return
+      - scaled copy of the matrix
+    */
+    constexpr Mat operator*(f4 scalar) const
+    { return Mat(*this) *= scalar; } // end Mat Mat<R, C>::operator*          */
+
+
+    /** Set the matrix to be scaled uniformly
+    \brief
+      - set the matrix to be scaled uniformly
+    \param scalar
+      - amount by which to multiply every cell
+    \return
+      - reference to the modified matrix for easier subsequent inline action
+    */
+    constexpr Mat& operator*=(f4 scalar)
+    {
+      for (u4 c = 0; c < C; ++c) { col[c] *= scalar; }
+      return *this;
+
+    } // end constexpr Mat& Mat<R, C>::operator*=(f4)                         */
+
+
+    /** Get the product of the matrix * a vector
+    \brief
+      - get the product of the matrix * a vector
+    \details
+      - sums the columns scaled by the vector's elements (column major order)
+    \param vector
+      - right hand vector of C elements
+    \return
+      - product vector of R elements
+    */
+    constexpr Vec<R> operator*(const Vec<C>& vector) const
+    {
+      Vec<R> product;
+      for (u4 c = 0; c < C; ++c) { product += col[c] * vector[c]; }
+      return product;
+
+    } // end constexpr Vec<R> Mat<R, C>::operator*(const Vec<C>&) const       */
+
+
+    /** Get the product of the matrix * another matrix
+    \brief
+      - get the product of the matrix * another matrix
+    \param other
+      - right hand C x K matrix
+    \return
+      - R x K product matrix: column k is this * other's column k
+    */
+    template <u4 K>
+    constexpr Mat<R, K> operator*(const Mat<C, K>& other) const
+    {
+      Mat<R, K> product;
+      for (u4 k = 0; k < K; ++k) { product[k] = *this * other[k]; }
+      return product;
+
+    } // end constexpr Mat<R, K> Mat<R, C>::operator*(const Mat<C, K>&) const */
+
+
+    /** Set this square matrix to itself * another (this * other)
+    \brief
+      - set this square matrix to itself * another (this * other)
+    \param other
+      - right hand matrix
+    \return
+      - reference to the modified matrix for easier subsequent inline action
+    */
+    constexpr Mat& operator*=(const Mat& other)
+    { return *this = *this * other; } // end constexpr Mat& operator*=(Mat)   */
+
+
+    /** Check if each cell is exactly equal to another matrix's
+    \brief
+      - check if each cell is exactly equal to another matrix's
+    \param other
+      - matrix to compare against
+    \return
+      - true if all matching cells are equal, otherwise false
+    */
+    constexpr bool operator==(const Mat& other) const
+    {
+      for (u4 c = 0; c < C; ++c)
+      {
+        if (col[c] != other.col[c]) { return false; }
+      }
+      return true;
+
+    } // end constexpr bool Mat<R, C>::operator==(const Mat&) const           */
+
+
+    /** Check if any cell differs from another matrix's
+    \brief
+      - check if any cell differs from another matrix's
+    \param other
+      - matrix to compare against
+    \return
+      - true if any matching cells differ, otherwise false
+    */
+    constexpr bool operator!=(const Mat& other) const
+    { return !(*this == other); } // end constexpr bool Mat<R, C>::operator!= */
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Members                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Column major cells: col[c][r] is row r of column c (as m4f's col)
+    Vec<R> col[C];
+
+  }; // end Mat class declaration
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                        Square Size Specializations                       */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! Determinant & inverse of N x N: partial pivoted elimination on a copy
+  template <u4 N>
+  struct Square
+  {
+    //! Get the determinant: product of the eliminated trace, signed by swaps
+    static f4 Det(Mat<N, N> m)
+    {
+      f4 det = 1.0f;
+      for (u4 k = 0; k < N; ++k)
+      {
+        u4 p = k;
+        for (u4 r = k + 1u; r < N; ++r)
+        {
+          if (AbsF(m[k][r]) > AbsF(m[k][p])) { p = r; }
+        }
+        if (m[k][p] == 0.0f) { return 0.0f; }
+        if (p != k)
+        {
+          for (u4 c = k; c < N; ++c) { SwapF(m[c][p], m[c][k]); }
+          det = -det;
+        }
+        det *= m[k][k];
+        for (u4 r = k + 1u; r < N; ++r)
+        {
+          f4 scale = m[k][r] / m[k][k];
+          for (u4 c = k + 1u; c < N; ++c) { m[c][r] -= m[c][k] * scale; }
+        }
+      }
+      return det;
+    }
+
+    //! Get the inverse by Gauss-Jordan elimination of [m | I]
+    static Mat<N, N> Inverse(Mat<N, N> m)
+    {
+      Mat<N, N> inverse(1.0f);
+      for (u4 k = 0; k < N; ++k)
+      {
+        u4 p = k;
+        for (u4 r = k + 1u; r < N; ++r)
+        {
+          if (AbsF(m[k][r]) > AbsF(m[k][p])) { p = r; }
+        }
+        if (NearF(m[k][p], 0.0f, _INf)) { return Mat<N, N>(); }
+        if (p != k)
+        {
+          for (u4 c = 0; c < N; ++c)
+          {
+            SwapF(m[c][p], m[c][k]);
+            SwapF(inverse[c][p], inverse[c][k]);
+          }
+        }
+        f4 reciprocal = 1.0f / m[k][k];
+        for (u4 c = 0; c < N; ++c)
+        {
+          m[c][k] *= reciprocal;
+          inverse[c][k] *= reciprocal;
+        }
+        for (u4 r = 0; r < N; ++r)
+        {
+          f4 scale = m[k][r];
+          if (r == k || scale == 0.0f) { continue; }
+          for (u4 c = 0; c < N; ++c)
+          {
+            m[c][r] -= m[c][k] * scale;
+            inverse[c][r] -= inverse[c][k] * scale;
+          }
+        }
+      }
+      return inverse;
+    }
+  };
+
+
+  //! 1x1: the cell itself
+  template <>
+  struct Square<1u>
+  {
+    static f4 Det(const Mat<1u, 1u>& m) { return m[0][0]; }
+
+    static Mat<1u, 1u> Inverse(const Mat<1u, 1u>& m)
+    {
+      if (NearF(m[0][0], 0.0f, _INf)) { return Mat<1u, 1u>(); }
+      return Mat<1u, 1u>(1.0f / m[0][0]);
+    }
+  };
+
+
+  //! 2x2: ad - bc, & the swapped / negated adjugate
+  template <>
+  struct Square<2u>
+  {
+    static f4 Det(const Mat<2u, 2u>& m)
+    { return m[0][0] * m[1][1] - m[1][0] * m[0][1]; }
+
+    static Mat<2u, 2u> Inverse(const Mat<2u, 2u>& m)
+    {
+      f4 det = Det(m);
+      if (NearF(det, 0.0f, _INf)) { return Mat<2u, 2u>(); }
+      f4 s = 1.0f / det;
+      return Mat<2u, 2u>(Vec<2u>(m[1][1] * s, -m[0][1] * s),
+        Vec<2u>(-m[1][0] * s, m[0][0] * s));
+    }
+  };
+
+
+  //! 3x3: columns' cross products are the adjugate's rows
+  template <>
+  struct Square<3u>
+  {
+    //! Cross product of 2 columns
+    static Vec<3u> Cross(const Vec<3u>& a, const Vec<3u>& b)
+    {
+      return Vec<3u>(a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+        a[0] * b[1] - a[1] * b[0]);
+    }
+
+    static f4 Det(const Mat<3u, 3u>& m)
+    { return m[0].Dot(Cross(m[1], m[2])); }
+
+    static Mat<3u, 3u> Inverse(const Mat<3u, 3u>& m)
+    {
+      Vec<3u> r0 = Cross(m[1], m[2]);
+      Vec<3u> r1 = Cross(m[2], m[0]);
+      Vec<3u> r2 = Cross(m[0], m[1]);
+      f4 det = m[0].Dot(r0);
+      if (NearF(det, 0.0f, _INf)) { return Mat<3u, 3u>(); }
+      return Mat<3u, 3u>(r0 / det, r1 / det, r2 / det).Transposed();
+    }
+  };
+
+
+  //! 4x4: 2x2 sub-determinants of the top & bottom row pairs, shared
+  template <>
+  struct Square<4u>
+  {
+    static f4 Det(const Mat<4u, 4u>& m)
+    {
+      // s: top 2 rows' 2x2 minors; t: bottom 2 rows' (by column pair)
+      f4 s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+      f4 s1 = m[0][0] * m[2][1] - m[2][0] * m[0][1];
+      f4 s2 = m[0][0] * m[3][1] - m[3][0] * m[0][1];
+      f4 s3 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
+      f4 s4 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
+      f4 s5 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+      f4 t5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+      f4 t4 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
+      f4 t3 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+      f4 t2 = m[0][2] * m[3][3] - m[3][2] * m[0][3];
+      f4 t1 = m[0][2] * m[2][3] - m[2][2] * m[0][3];
+      f4 t0 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+      return s0 * t5 - s1 * t4 + s2 * t3 + s3 * t2 - s4 * t1 + s5 * t0;
+    }
+
+    static Mat<4u, 4u> Inverse(const Mat<4u, 4u>& m)
+    {
+      f4 s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+      f4 s1 = m[0][0] * m[2][1] - m[2][0] * m[0][1];
+      f4 s2 = m[0][0] * m[3][1] - m[3][0] * m[0][1];
+      f4 s3 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
+      f4 s4 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
+      f4 s5 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+      f4 t5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+      f4 t4 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
+      f4 t3 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+      f4 t2 = m[0][2] * m[3][3] - m[3][2] * m[0][3];
+      f4 t1 = m[0][2] * m[2][3] - m[2][2] * m[0][3];
+      f4 t0 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+      f4 det = s0 * t5 - s1 * t4 + s2 * t3 + s3 * t2 - s4 * t1 + s5 * t0;
+      if (NearF(det, 0.0f, _INf)) { return Mat<4u, 4u>(); }
+      f4 d = 1.0f / det;
+
+      // Adjugate / det, cell [c][r] (column c, row r)
+      Mat<4u, 4u> inv;
+      inv[0][0] = ( m[1][1] * t5 - m[2][1] * t4 + m[3][1] * t3) * d;
+      inv[1][0] = (-m[1][0] * t5 + m[2][0] * t4 - m[3][0] * t3) * d;
+      inv[2][0] = ( m[1][3] * s5 - m[2][3] * s4 + m[3][3] * s3) * d;
+      inv[3][0] = (-m[1][2] * s5 + m[2][2] * s4 - m[3][2] * s3) * d;
+
+      inv[0][1] = (-m[0][1] * t5 + m[2][1] * t2 - m[3][1] * t1) * d;
+      inv[1][1] = ( m[0][0] * t5 - m[2][0] * t2 + m[3][0] * t1) * d;
+      inv[2][1] = (-m[0][3] * s5 + m[2][3] * s2 - m[3][3] * s1) * d;
+      inv[3][1] = ( m[0][2] * s5 - m[2][2] * s2 + m[3][2] * s1) * d;
+
+      inv[0][2] = ( m[0][1] * t4 - m[1][1] * t2 + m[3][1] * t0) * d;
+      inv[1][2] = (-m[0][0] * t4 + m[1][0] * t2 - m[3][0] * t0) * d;
+      inv[2][2] = ( m[0][3] * s4 - m[1][3] * s2 + m[3][3] * s0) * d;
+      inv[3][2] = (-m[0][2] * s4 + m[1][2] * s2 - m[3][2] * s0) * d;
+
+      inv[0][3] = (-m[0][1] * t3 + m[1][1] * t1 - m[2][1] * t0) * d;
+      inv[1][3] = ( m[0][0] * t3 - m[1][0] * t1 + m[2][0] * t0) * d;
+      inv[2][3] = (-m[0][3] * s3 + m[1][3] * s1 - m[2][3] * s0) * d;
+      inv[3][3] = ( m[0][2] * s3 - m[1][2] * s1 + m[2][2] * s0) * d;
+      return inv;
+    }
+  };
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                        Helper Operator Overloads                         */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  /** Left hand scalar multiplication scales each element of rhs uniformly
+  \brief
+    - left hand scalar multiplication scales each element of rhs uniformly
+  \param scalar
+    - amount by which to multiply every element
+  \param rhs
+    - vector to be copied & scaled
+  \return
+    - scaled copy of rhs
+  */
+  template <u4 N>
+  constexpr Vec<N> operator*(f4 scalar, const Vec<N>& rhs)
+  { return rhs * scalar; } // end Vec<N> operator*(f4, const Vec<N>&)         */
+
+
+  /** Left hand scalar multiplication scales each cell of rhs uniformly
+  \brief
+    - left hand scalar multiplication scales each cell of rhs uniformly
+  \param scalar
+    - amount by which to multiply every cell
+  \param rhs
+    - matrix to be copied & scaled
+  \return
+    - scaled copy of rhs
+  */
+  template <u4 R, u4 C>
+  constexpr Mat<R, C> operator*(f4 scalar, const Mat<R, C>& rhs)
+  { return rhs * scalar; } // end Mat<R, C> operator*(f4, Mat<R, C>)          */
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                           Public Class Aliases                           */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  using Vec2 = Vec<2u>;     //! Layout of v2f
+  using Vec3 = Vec<3u>;     //! Layout of v3f
+  using Vec4 = Vec<4u>;     //! Layout of v4f
+  using Vec6 = Vec<6u>;     //! Layout of v6f
+  using Mat2 = Mat<2u, 2u>; //! Layout of m2f
+  using Mat3 = Mat<3u, 3u>; //! Layout of m3f
+  using Mat4 = Mat<4u, 4u>; //! Layout of m4f
+
+  // Ensurance that memory footprint matches the hand written classes
+  static_assert(sizeof(Vec2) == sizeof(v2f), "Vec2 / v2f layout mismatch");
+  static_assert(sizeof(Vec3) == sizeof(v3f), "Vec3 / v3f layout mismatch");
+  static_assert(sizeof(Vec4) == sizeof(v4f), "Vec4 / v4f layout mismatch");
+  static_assert(sizeof(Vec6) == sizeof(v6f), "Vec6 / v6f layout mismatch");
+  static_assert(sizeof(Mat2) == sizeof(m2f), "Mat2 / m2f layout mismatch");
+  static_assert(sizeof(Mat3) == sizeof(m3f), "Mat3 / m3f layout mismatch");
+  static_assert(sizeof(Mat4) == sizeof(m4f), "Mat4 / m4f layout mismatch");
+
+} // end dp namespace
@@ -633,12 +633,13 @@ dp::Mesh dp::Mesh::pSphere(u4 subdivsRadial, u4 subdivsHeight, f4 radius)
   } // end subdiv tables allocation validation
 
   // Populate radial subdivision tables for x & y coordinates
+  std::vector<ang> radial(a1);
   for (size_t i = 0; i < a1; ++i)
   {
     f4 angle = ((static_cast<f4>(i) / static_cast<f4>(a))) * RAD_PER_REV;
-    cosPos[i] = static_cast<f4>(cos(angle));
-    sinPos[i] = static_cast<f4>(sin(angle));
+    radial[i] = ang(angle, arc::radians);
   }
+  SinCosF(radial.data(), static_cast<u4>(a1), sinPos, cosPos);
 
   // Populate mesh buffers' using trig tables: ordering verts bottom to top
   for (size_t i = 0; i < a; ++i) // set up end caps ([0,a]: ie for one rotation)
@@ -22,6 +22,7 @@ written consent of DigiPen Institute of Technology is prohibited.
 #include "Log.h"      // System message management for errors, warnings, etc
 #include "Mesh.h"     // Vertex data scanning to determine extents / orientation
 #include "OBB.h"      // Class interface declaration header
+#include "Stats.h"    // Covariance of placed vertices, accumulated in place
 #include "v2f.h"      // Class interface declaration header
 
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -34,13 +35,32 @@ written consent of DigiPen Institute of Technology is prohibited.
 
 dp::OBB::OBB(const Mesh& mesh, const m4f& place, u4 samples, s2 step, u2 first)
 {
-  // Get list of vertex world coordinates to sample
-  const Mesh::Vertex* v = &mesh.VertexBuffer();
+  // Sampled vertices are placed into world coordinates as they're read
   u4 verts = mesh.VertexCount();
-  std::vector<v3f> wPos(verts);
-  for (u4 i = 0; i < verts; ++i) { wPos[i] = place.PProd(v[i].pos); }
+  if (!verts) // No points to bound: point box at the placed origin
+  {
+    center = place.PProd(nullv3f);
+    ext = nullv3f;
+    radius = 0.0f;
+    surface = volume = -0.0f; // Nothing derived is valid yet
+    SetDirtyScale();
+    Finalize();
+    return;
+  }
+  const Mesh::Vertex* v = &mesh.VertexBuffer();
+  uRng subs(samples, verts, first, step);
+  Covar3 world; // Spread of world coordinates, without a placed copy
+  if (subs.Samples() < subs.Dataset()) // Sampled subset: point by point
+  {
+    while (subs.Scanning())
+    {
+      world.Add(place.PProd(v[subs.Index()].pos));
+      ++subs;
+    }
+  }
+  else { world = Covar3::Gather(place, &v->pos, verts, sizeof(Mesh::Vertex)); }
   // Calculate rotation & spread by sampled statistical analysis
-  basis = PCA3(Covariance3D(&wPos[0], verts, samples, step, first), &ext);
+  basis = PCA3(world.Matrix(), &ext);
   Log::Diag("OBB - Extents?" + ext.String());
   (ext *= AHALF).ToAbs();
   Log::Diag("OBB - Extents?" + ext.String());
@@ -49,28 +69,28 @@ dp::OBB::OBB(const Mesh& mesh, const m4f& place, u4 samples, s2 step, u2 first)
   v2f spread(INf, -INf); // Record of extrema projections of data spread on axis
   f4 t; // Scalar value of projected point primary axis (unit-vec?), of spread
   bool subceded, superceded; // Projected point record of extremal highs / lows
-  u4 min = 0, max = 0; // Indices of points of extremal projection
-  // Project all points on that axis to find extrema
-  for (u4 i = 0; i < wPos.size(); ++i)
+  v3f low = world.Mean(), high = low; // World points of extremal projection
+  // Project all points on that axis to find extrema (placed again: cheaper
+  // than a round trip through a full list of placed copies)
+  for (u4 i = 0; i < verts; ++i)
   {
-    t = basis[m].Dot(wPos[i]);
+    v3f w = place.PProd(v[i].pos);
+    t = basis[m].Dot(w);
     subceded = t < spread.min;
     superceded = spread.max < t;
     SetIfF(spread.min, t, subceded);
     SetIfF(spread.max, t, superceded);
-    SetIfU(min, i, subceded);
-    SetIfU(max, i, superceded);
+    if (subceded) { low = w; }
+    if (superceded) { high = w; }
   }
-  center = (wPos[max] + wPos[min]) * AHALF;
+  center = (high + low) * AHALF;
   ext[m] = (spread.max - spread.min) * AHALF; // use pop. result over samp.
   radius = ext[m];
   Log::Diag("OBB - Extents?" + ext.String());
   // Set initial state for derived data
-  UpdateSurface();
-  UpdateVolume();
-  UpdateVert();
-  UpdateProj();
-  UpdateMatrix();
+  surface = volume = -0.0f; // Nothing derived is valid yet
+  SetDirtyScale();
+  Finalize();
 
 } // end OBB::OBB(const Mesh&, const m4f&, u4, s2, u2)                        */
 
@@ -89,11 +109,9 @@ dp::OBB::OBB(const v3f& pos, const v3f& extents, bool halvedExt,
   // Set initial state for derived data
   ext.ToAbs();
   radius = MaxF(MaxF(ext.x, ext.y), ext.z);
-  UpdateSurface();
-  UpdateVolume();
-  UpdateVert();
-  UpdateProj();
-  UpdateMatrix();
+  surface = volume = -0.0f; // Nothing derived is valid yet
+  SetDirtyScale();
+  Finalize();
 
 } //end OBB::OBB(const v3f&, const v3f&, bool, const v3f&, const v3f&, PLANE) */
 
@@ -101,7 +119,10 @@ dp::OBB::OBB(const OBB& source)
   : wfb(source.wfb), basis(source.basis), prX(source.prX), prY(source.prY),
   prZ(source.prZ), center(source.center), ext(source.ext),
   surface(source.surface), volume(source.volume), radius(source.radius)
-{ } // end OBB::OBB(const OBB& source)                                        */
+{
+  for (u4 i = 0u; i < 8u; ++i) { point[i] = source.point[i]; }
+
+} // end OBB::OBB(const OBB& source)                                          */
 
 
 dp::OBB::OBB(OBB&& result) noexcept
@@ -110,7 +131,10 @@ dp::OBB::OBB(OBB&& result) noexcept
   basis(std::move(result.basis)), center(std::move(result.center)),
   ext(std::move(result.ext)), surface(std::move(result.surface)),
   volume(std::move(result.volume)), radius(std::move(result.radius))
-{ } // end OBB::OBB(OBB&&) noexcept                                           */
+{
+  for (u4 i = 0u; i < 8u; ++i) { point[i] = result.point[i]; }
+
+} // end OBB::OBB(OBB&&) noexcept                                             */
 
 
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -208,6 +208,30 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     { return OBB(*this); } // end OBB OBB::Copy(void) const                   */
 
 
+    /** Bring every lazily derived term up to date, so const queries only read
+    \brief
+      - bring every lazily derived term up to date, so const queries only read
+    \details
+      - matrix, corner spans, self-projections, surface & volume are derived
+      on-demand from const methods (mutable caches flagged dirty by MSBs), so
+      a box shared across threads must be finalized after its last change: a
+      finalized box has every const query (IsIn, Matrix, Projected*, etc.) as
+      a pure read, safe to call concurrently until the box is modified again
+    \return
+      - reference to the finalized OBB for easier subsequent inline action
+    */
+    inline OBB& Finalize(void)
+    {
+      UpdateMatrix();
+      UpdateVert();
+      UpdateProj();
+      UpdateSurface();
+      UpdateVolume();
+      return *this;
+
+    } // end OBB& OBB::Finalize(void)                                         */
+
+
     /** Get bounding box's scalar half-extent spans in <x, y, z> scales
     \brief
       - get bounding box's scalar half-extent spans in <x, y, z> scales
@@ -277,6 +301,20 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     inline bool IsDirtyVolume(void) const
     { return IsNegF(volume); } // end bool OBB::IsDirtyVolume(void) const     */
 
+
+    /** Get whether no derived data is pending a latent (const method) update
+    \brief
+      - get whether no derived data is pending a latent (const method) update
+    \return
+      - true only if const queries can't write caches: safe to share threads
+    */
+    inline bool IsFinal(void) const
+    {
+      return !(IsDirtyMat() || IsDirtyVert() || IsDirtyProj()
+        || IsDirtySurface() || IsDirtyVolume());
+
+    } // end bool OBB::IsFinal(void) const                                    */
+
     /** Get whether another oriented bounding box is inside this box's extents
     \brief
       - get whether another oriented bounding box is inside this box's extents
@@ -534,7 +572,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
       SetDirtyMatrix();
       SetDirtyProj();
       return *this;
-    } // end OBB& OBB::operator+=(const v3f&) const                          */
+    } // end OBB& OBB::operator+=(const v3f&) const                           */
 
 
     /** These bounds grown to the product with a dimensional set of scalars
@@ -565,7 +603,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
       SetDirtyProj();
       return *this;
 
-    } // end OBB& OBB::operator*=(const v3f&) const                          */
+    } // end OBB& OBB::operator*=(const v3f&) const                           */
 
 
     /** Grow bounds using the origin & extents of an AABB as affine scalars
@@ -670,10 +708,10 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
         mid = center.Dot(basis['x']); // Projected center on local-X; parallel
         prX.Set(mid-ext.x, mid+ext.x);  //    => symmetrical midpoint x-offsets
         mid = center.Dot(basis['y']); // Projected center on local-Y; parallel
-        prX.Set(mid-ext.y, mid+ext.y);  //    => symmetrical midpoint y-offsets
+        prY.Set(mid-ext.y, mid+ext.y);  //    => symmetrical midpoint y-offsets
         mid = center.Dot(basis['z']); // Projected center on local-Z; parallel
-        prX.Set(mid-ext.z, mid+ext.z);  //    => symmetrical midpoint z-offsets
-        wfb[2][3] = 0.0f; // reset dirty Z flag
+        prZ.Set(mid-ext.z, mid+ext.z);  //    => symmetrical midpoint z-offsets
+        wfb[1][3] = 0.0f; // Clear the set dirty flag
       }
     } // end void OBB::UpdateProj(void)                                       */
 
@@ -684,7 +722,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     */
     inline const f4& UpdateSurface(void) const
     {
-      if(IsDirtySurface()){volume=(ext.x*ext.y+ext.x*ext.z+ext.y*ext.z)*8.0f;}
+      if(IsDirtySurface()){surface=(ext.x*ext.y+ext.x*ext.z+ext.y*ext.z)*8.0f;}
       return surface;
 
     } // end const f4& OBB::UpdateSurface(void)                               */
@@ -735,9 +773,9 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
         point[4].Set( lAxis['x']-lAxis['y']+lAxis['z']); // Octant 4: + - +
         point[5].Set(-lAxis['x']-lAxis['y']+lAxis['z']); // Octant 5: - - +
         point[6].Set(-lAxis['x']-lAxis['y']-lAxis['z']); // Octant 6: - - -
-        point[7].Set(-lAxis['x']-lAxis['y']-lAxis['z']); // Octant 7: - + -
+        point[7].Set(-lAxis['x']+lAxis['y']-lAxis['z']); // Octant 7: - + -
         point[0].Set(-lAxis['x']+lAxis['y']+lAxis['z']); // Octant 8: - + +
-        wfb[1][3] = 0.0f; // Clear the set dirty flag
+        wfb[2][3] = 0.0f; // Clear the set dirty flag
       }
       return wfb;
     } // end const m4f& OBB::UpdateMatrix(void)                               */
@@ -768,19 +806,19 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     //! World scalars of box's rotated coordinates if linear (coord -= center)
     mutable v3f point[8];
     // Derived matrix's dirty flag in [3][3]MSB: affine [3][3] =: 1.0 -> -1.0
-    // Dirty flag MSBs of projections [2][3] =: 0.0 -> -0.0 (no coeffects)
+    // Dirty flag MSBs of point scales in [2][3] =: 0.0 -> -0.0 (no coeffects)
 
     //! World scale box point projections on this box's local-X basis vector
     mutable v2f prX;
-    // Derived data of projection world scale set's dirty flag on wfb[2][3] MSB
+    // Derived data of projection world scale set's dirty flag on wfb[1][3] MSB
 
     //! World scale box point projections on this box's local-Y basis vector
     mutable v2f prY;
-    // Derived data of projection world scale set's dirty flag on wfb[2][3] MSB
+    // Derived data of projection world scale set's dirty flag on wfb[1][3] MSB
 
     //! World scale box point projections on this box's local-Z basis vector
     mutable v2f prZ;
-    // Derived data of projection world scale set's dirty flag on wfb[2][3] MSB
+    // Derived data of projection world scale set's dirty flag on wfb[1][3] MSB
 
     mutable f4 surface; //! Box's world scale surface area: 2*w*h +2*w*d +2*h*d
     // Derived data's dirty flag on MSB; surface area should never be negative
@@ -800,6 +838,46 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
   /*                       Helper Function Declarations                       */
   /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
+  /** Get the squared distance from a point to a box, in the box's own frame
+  \brief
+    - get the squared distance from a point to a box, in the box's own frame
+  \param local
+    - point relative to the box center, projected on the box's unit axes
+  \param halfExt
+    - box half-extents along each of its axes
+  \return
+    - squared distance to the nearest point of the box (0 if within)
+  */
+  inline f4 BoxDistSq(const v3f& local, const v3f& halfExt)
+  {
+    f4 dx = MaxF(AbsF(local.x) - halfExt.x, 0.0f); // Overshoot per axis
+    f4 dy = MaxF(AbsF(local.y) - halfExt.y, 0.0f);
+    f4 dz = MaxF(AbsF(local.z) - halfExt.z, 0.0f);
+    return dx * dx + dy * dy + dz * dz;
+
+  } // end f4 BoxDistSq(const v3f&, const v3f&)                               */
+
+
+  /** Get the radius of a box's projection on a unit axis (for SAT gaps)
+  \brief
+    - get the radius of a box's projection on a unit axis (for SAT gaps)
+  \param axes
+    - the box's 3 unit axes
+  \param halfExt
+    - box half-extents along each of its axes
+  \param axis
+    - unit axis projected onto
+  \return
+    - half the width of the box's shadow on the axis
+  */
+  inline f4 BoxReach(const v3f* axes, const v3f& halfExt, const v3f& axis)
+  {
+    return halfExt.x * AbsF(axes[0].Dot(axis))
+      + halfExt.y * AbsF(axes[1].Dot(axis))
+      + halfExt.z * AbsF(axes[2].Dot(axis));
+
+  } // end f4 BoxReach(const v3f*, const v3f&, const v3f&)                    */
+
    /*^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
    /*                            Helper Constants                             */
    /*^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -0,0 +1,116 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  Parallel.h
+Purpose:  Fork / join of index range work over the hardware's threads
+Details:  a range is cut into contiguous chunks, at most one per hardware
+  thread and each at least a grain in size (so small ranges stay on the
+  calling thread, spared the cost of starting threads).  The caller runs the
+  first chunk itself, then joins the rest: every write made by a chunk is
+  visible once ParallelFor() returns.  Each chunk is handed its chunk number,
+  so callers can keep per-chunk scratch (counts, output lists) with no locks.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <thread>       // Worker threads for all chunks past the first
+#include <vector>       // Started worker list, to be joined
+
+// "./src/..."
+#include "TypeErrata.h" // Platform primitive type aliases for easier porting
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Public Constants                              */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  //! Default least indices per chunk: below this, threads cost more than work
+  constexpr u4 PARALLEL_GRAIN = 4096u;
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                      Helper Function Declarations                        */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  /** Get the count of threads the hardware runs at once (at least 1)
+  \brief
+    - get the count of threads the hardware runs at once (at least 1)
+  \return
+    - concurrent hardware thread count, or 1 if it can't be told
+  */
+  inline u4 ParallelThreads(void)
+  {
+    static const u4 threads = std::thread::hardware_concurrency();
+    return threads ? threads : 1u;
+
+  } // end u4 ParallelThreads(void)                                           */
+
+
+  /** Get the count of chunks ParallelFor() cuts a range into
+  \brief
+    - get the count of chunks ParallelFor() cuts a range into
+  \details
+    - for sizing per-chunk scratch before the call
+  \param count
+    - size of the index range to be cut
+  \param grain
+    - least indices per chunk
+  \return
+    - [1, ParallelThreads()] chunks the range is to be run in
+  */
+  inline u4 ParallelChunks(u4 count, u4 grain = PARALLEL_GRAIN)
+  {
+    u4 chunks = count / (grain ? grain : 1u);
+    u4 threads = ParallelThreads();
+    return chunks < 1u ? 1u : (threads < chunks ? threads : chunks);
+
+  } // end u4 ParallelChunks(u4, u4)                                          */
+
+
+  /** Run work over an index range, cut into chunks run on separate threads
+  \brief
+    - run work over an index range, cut into chunks run on separate threads
+  \details
+    - body is called as body(first, last, chunk) for indices [first, last);
+    chunks run at once, so they must only write to disjoint data (or atomics)
+  \param count
+    - size of the index range [0, count) to be worked on
+  \param body
+    - work to run on each chunk of the range
+  \param grain
+    - least indices per chunk
+  */
+  template <typename Body>
+  void ParallelFor(u4 count, const Body& body, u4 grain = PARALLEL_GRAIN)
+  {
+    u4 chunks = ParallelChunks(count, grain);
+    if (chunks == 1u)
+    {
+      body(0u, count, 0u);
+      return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(chunks - 1u);
+    for (u4 c = 1u; c < chunks; ++c)
+    {
+      u4 first = static_cast<u4>(static_cast<u8>(count) * c / chunks);
+      u4 last = static_cast<u4>(static_cast<u8>(count) * (c + 1u) / chunks);
+      workers.emplace_back([&body, first, last, c]() { body(first, last, c); });
+    }
+    body(0u, static_cast<u4>(count / chunks), 0u);
+    for (std::thread& worker : workers) { worker.join(); }
+
+  } // end void ParallelFor(u4, const Body&, u4)                              */
+
+} // end dp namespace
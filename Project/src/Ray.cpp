@@ -89,54 +89,26 @@ f4 dp::Ray::Distance(const Plane& plane) const
 
 bool dp::Ray::IsIn(const AABB& box, f4* tDist) const
 {
-  // Check for easy out: ray originates / starts in box
-  if (box.IsIn(orig))
-  { if (tDist) { *tDist = 0.0f; } return true; } // In box => 0 distance
-  // Check if ray dir is parallel with any world axes? (=> INf slope span)
-  if (dir.x == 0.0f || dir.y == 0.0f || dir.z == 0.0f)
+  // Clip t-scalar span [0, INf) to the box's slab on each axis in turn: the
+  // slab's <enter, exit> t-scalars are its extrema's distances from the
+  // origin, scaled by 1 / dir.x|y|z.  A 0 in dir.x|y|z (=> +/-INf scale)
+  // gives a -INf..INf span within the slab, or a same signed INf span
+  // outside it (=> miss), with no early out needed; an origin on the slab
+  // plane gives a NaN end, and that slab is skipped (=> touching)
+  f4 tNear = 0.0f, tFar = INf;
+  for (s1 i = 0; i < 3; ++i)
   {
-    // => Can't travel in dir.x|y|z to reach box (unless starting in box)
-    if (tDist) { *tDist = INf; } // (confirmed not the case above already)
-    return false;
+    f4 t0 = (box.Min()[i] - orig[i]) * _dir[i];
+    f4 t1 = (box.Max()[i] - orig[i]) * _dir[i];
+    if (t1 < t0) { SwapF(t0, t1); } // => (-)desc : (+)asc axis values
+    else if (!(t0 <= t1)) { continue; } // NaN end: parallel, in the slab
+    if (tNear < t0) { tNear = t0; } // Latest entry across axes so far
+    if (t1 < tFar) { tFar = t1; }   // Earliest exit across axes so far
   }
 
-  // Get t-scalars intersecting box-extrema, per axis (from x -> y -> z)
-  v2f t; // t-scalar < min, max > range of intersection for checked axes
-  v2f a; // t-scalar <min,max> range of axis being compared against <t>
-
-  t.Set(box.Min().x, box.Max().x); // Use ray dir.x for extrema order
-  SwapIfF(t.min, t.max, std::signbit(dir.x));// => (-)desc : (+)asc x-values
-  // either - => from right, moving in -x(<) or + => from left, moving in +x(>)
-  
-  t -= orig.x; // set to x-axis world distance to <enter, exit> from ray origin
-  t *= _dir.x; // scale (1 / dir.x) uniformly; solve for t (parallel dist in x)
-
-  // Get comparison with y-axis t-scalars intersecting box
-  a.Set(box.Min().y, box.Max().y); // Use ray dir.y for extrema order
-  SwapIfF(a.min, a.max, std::signbit(dir.y)); // => (-)desc : (+)asc y-values
-  // either (from top, in -y(v), downward : from bottom, in +y(^), upward)
-
-  a -= orig.y; // set to y-axis world distance to <enter, exit> from ray origin
-  a *= _dir.y; // scale (1 / dir.y) uniformly; solve for t (parallel dist in y)
-
-  // If t-scalar of x's entry is beyond y's exit, or y's entry after x's exit
-  if ((t.min > a.max) || (a.min > t.max)) // => t-skew in X:Y; no intersection
-  { if (tDist) { *tDist = INf; } return false; }
-  t.Set(MaxF(a.min, t.min), MinF(t.max, a.max)); // Intersect X : Y t-scalars
-
-  a.Set(box.Min().z, box.Max().z); // Use ray dir.z for extrema order
-  SwapIfF(a.min, a.max, std::signbit(dir.z)); // => (-)desc : (+)asc z-values
-  // either (from front, in -z, backward : from back, in +z, forward)
-
-  a -= orig.z; // set to z-axis world distance to <enter, exit> from ray origin
-  a *= _dir.z; // scale (1 / dir.z) uniformly; solve for t (parallel dist in z)
-
-  // If t-scalar of xy's entry is beyond z's exit, or z's entry after xy's exit
-  if ((t.min > a.max) || (a.min > t.max)) // => t-skew in XY:Z; no intersection
-  { if (tDist) { *tDist = INf; } return false; }
-  t.Set(MaxF(a.min, t.min), MinF(t.max, a.max)); // Intersect XY:Z t-scalars
-
-  if (tDist) { *tDist = t.min; } // Minimal distance must be first intersection
+  // If any axis' entry is beyond another's exit => t-skew; no intersection
+  if (tFar < tNear) { if (tDist) { *tDist = INf; } return false; }
+  if (tDist) { *tDist = tNear; } // First intersection (0 if origin in box)
   return true;
 
 } // end bool Ray::IsIn(const AABB&, f4*) const                               */
@@ -166,7 +138,7 @@ bool dp::Ray::IsIn(const Plane& plane, v3f* intersection) const
   if (intersection) { intersection->Set(dist != -INf ? At(dist) : maxv3f); }
   return 0.0f <= dist;
 
-} // end bool Ray::IsIn(const Plane&) const                                     */
+} // end bool Ray::IsIn(const Plane&) const                                   */
 
 bool dp::Ray::IsParallel(const Plane& plane) const
 {
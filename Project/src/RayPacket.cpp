@@ -0,0 +1,268 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  RayPacket.cpp
+Purpose:  Wide ray / box slab tests for hierarchy traversal (4 / 8 lanes)
+Details:  4 lanes run in SSE; 8 lanes in AVX where the build targets it
+  (/arch:AVX or higher, defining __AVX__), else as 2 SSE halves.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <std>
+#include <xmmintrin.h>  // SSE 4-wide float lanes for slab tests
+#if defined(__AVX__)
+#include <immintrin.h>  // AVX 8-wide float lanes for slab tests
+#endif
+
+// "./src/..."
+#include "Ray.h"        // Ray origin / direction of each slab / lane
+#include "RayPacket.h"  // Class declaration header
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+//! Clip 4 [0, far] spans by 3 slabs each; get lanes left with a span
+//! (a NaN slab end, from an origin on a slab plane, leaves the span alone:
+//! its bits are set in both ends, and SSE min / max return the 2nd operand)
+static inline __m128 Slab(const __m128* low, const __m128* high,
+  const __m128* inv, const __m128* origin, __m128 far, __m128& near)
+{
+  __m128 tNear = _mm_setzero_ps(), tFar = far;
+  for (u4 a = 0u; a < 3u; ++a)
+  {
+    __m128 t0 = _mm_mul_ps(_mm_sub_ps(low[a], origin[a]), inv[a]);
+    __m128 t1 = _mm_mul_ps(_mm_sub_ps(high[a], origin[a]), inv[a]);
+    __m128 skip = _mm_cmpunord_ps(t0, t1);
+    tNear = _mm_max_ps(_mm_or_ps(_mm_min_ps(t0, t1), skip), tNear);
+    tFar = _mm_min_ps(_mm_or_ps(_mm_max_ps(t0, t1), skip), tFar);
+  }
+  near = tNear;
+  return _mm_cmple_ps(tNear, tFar);
+
+} // end __m128 Slab(const __m128*, ..., __m128, __m128&)                     */
+
+
+#if defined(__AVX__)
+//! Clip 8 [0, far] spans by 3 slabs each; get lanes left with a span
+static inline __m256 Slab(const __m256* low, const __m256* high,
+  const __m256* inv, const __m256* origin, __m256 far, __m256& near)
+{
+  __m256 tNear = _mm256_setzero_ps(), tFar = far;
+  for (u4 a = 0u; a < 3u; ++a)
+  {
+    __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(low[a], origin[a]), inv[a]);
+    __m256 t1 = _mm256_mul_ps(_mm256_sub_ps(high[a], origin[a]), inv[a]);
+    __m256 skip = _mm256_cmp_ps(t0, t1, _CMP_UNORD_Q);
+    tNear = _mm256_max_ps(_mm256_or_ps(_mm256_min_ps(t0, t1), skip), tNear);
+    tFar = _mm256_min_ps(_mm256_or_ps(_mm256_max_ps(t0, t1), skip), tFar);
+  }
+  near = tNear;
+  return _mm256_cmp_ps(tNear, tFar, _CMP_LE_OQ);
+
+} // end __m256 Slab(const __m256*, ..., __m256, __m256&)                     */
+#endif
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::RaySlab::RaySlab(const Ray& ray, f4 tMax)
+  : RaySlab(ray.Origin(), ray.Direction(), tMax)
+{ } // end RaySlab::RaySlab(const Ray&, f4)                                   */
+
+
+dp::RaySlab::RaySlab(const v3f& start, const v3f& direction, f4 tMax)
+  : far(tMax)
+{
+  for (s1 a = 0; a < 3; ++a)
+  {
+    inv[a] = InvF(direction[a]);
+    origin[a] = start[a];
+  }
+
+} // end RaySlab::RaySlab(const v3f&, const v3f&, f4)                         */
+
+
+template <u4 LANES>
+dp::RayPacket<LANES>::RayPacket(const Ray* rays, u4 given, f4 tMax)
+  : active(0u), count(given < LANES ? given : LANES), coherent(true)
+{
+  u4 octant = 0u;
+  for (u4 l = 0u; l < LANES; ++l)
+  {
+    if (count <= l) // Unused: spans start empty ([0, -1]), so never hit
+    {
+      for (u4 a = 0u; a < 3u; ++a)
+      {
+        inv[a][l] = origin[a][l] = dir[a][l] = 0.0f;
+      }
+      far[l] = -1.0f;
+      continue;
+    }
+
+    const v3f& o = rays[l].Origin();
+    const v3f& d = rays[l].Direction();
+    u4 signs = 0u;
+    for (s1 a = 0; a < 3; ++a)
+    {
+      inv[a][l] = InvF(d[a]);
+      origin[a][l] = o[a];
+      dir[a][l] = d[a];
+      signs |= (inv[a][l] < 0.0f ? 1u : 0u) << a;
+    }
+    far[l] = tMax;
+    if (!l) { octant = signs; }
+    coherent = coherent && signs == octant;
+  }
+  active = (1u << count) - 1u;
+
+} // end RayPacket<LANES>::RayPacket(const Ray*, u4, f4)                      */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+bool dp::RaySlab::Hit(const v3f& min, const v3f& max, f4* tNear) const
+{
+  // As in Ray::IsIn(const AABB&): a NaN end skips the slab (fits either way)
+  f4 near = 0.0f, tFar = far;
+  for (s1 a = 0; a < 3; ++a)
+  {
+    f4 t0 = (min[a] - origin[a]) * inv[a], t1 = (max[a] - origin[a]) * inv[a];
+    if (t1 < t0) { SwapF(t0, t1); }
+    else if (!(t0 <= t1)) { continue; }
+    if (near < t0) { near = t0; }
+    if (t1 < tFar) { tFar = t1; }
+  }
+  if (tNear) { *tNear = near; }
+  return near <= tFar;
+
+} // end bool RaySlab::Hit(const v3f&, const v3f&, f4*) const                 */
+
+
+u4 dp::RaySlab::Hit(const BoxLanes<4>& boxes, f4* tNear) const
+{
+  __m128 low[3], high[3], in[3], at[3], near;
+  for (u4 a = 0u; a < 3u; ++a)
+  {
+    low[a] = _mm_loadu_ps(boxes.min[a]);
+    high[a] = _mm_loadu_ps(boxes.max[a]);
+    in[a] = _mm_set1_ps(inv[a]);
+    at[a] = _mm_set1_ps(origin[a]);
+  }
+  __m128 hit = Slab(low, high, in, at, _mm_set1_ps(far), near);
+  if (tNear) { _mm_storeu_ps(tNear, near); }
+  return static_cast<u4>(_mm_movemask_ps(hit)) & boxes.used;
+
+} // end u4 RaySlab::Hit(const BoxLanes<4>&, f4*) const                       */
+
+
+u4 dp::RaySlab::Hit(const BoxLanes<8>& boxes, f4* tNear) const
+{
+#if defined(__AVX__)
+  __m256 low[3], high[3], in[3], at[3], near;
+  for (u4 a = 0u; a < 3u; ++a)
+  {
+    low[a] = _mm256_loadu_ps(boxes.min[a]);
+    high[a] = _mm256_loadu_ps(boxes.max[a]);
+    in[a] = _mm256_set1_ps(inv[a]);
+    at[a] = _mm256_set1_ps(origin[a]);
+  }
+  __m256 hit = Slab(low, high, in, at, _mm256_set1_ps(far), near);
+  if (tNear) { _mm256_storeu_ps(tNear, near); }
+  return static_cast<u4>(_mm256_movemask_ps(hit)) & boxes.used;
+#else
+  u4 mask = 0u;
+  __m128 in[3], at[3], tFar = _mm_set1_ps(far);
+  for (u4 a = 0u; a < 3u; ++a)
+  {
+    in[a] = _mm_set1_ps(inv[a]);
+    at[a] = _mm_set1_ps(origin[a]);
+  }
+  for (u4 half = 0u; half < 8u; half += 4u)
+  {
+    __m128 low[3], high[3], near;
+    for (u4 a = 0u; a < 3u; ++a)
+    {
+      low[a] = _mm_loadu_ps(boxes.min[a] + half);
+      high[a] = _mm_loadu_ps(boxes.max[a] + half);
+    }
+    __m128 hit = Slab(low, high, in, at, tFar, near);
+    if (tNear) { _mm_storeu_ps(tNear + half, near); }
+    mask |= static_cast<u4>(_mm_movemask_ps(hit)) << half;
+  }
+  return mask & boxes.used;
+#endif
+
+} // end u4 RaySlab::Hit(const BoxLanes<8>&, f4*) const                       */
+
+
+template <u4 LANES>
+u4 dp::RayPacket<LANES>::Hit(const v3f& min, const v3f& max, u4 lanes,
+  f4* tNear) const
+{
+  __m128 low[3], high[3];
+  for (s1 a = 0; a < 3; ++a)
+  {
+    low[a] = _mm_set1_ps(min[a]);
+    high[a] = _mm_set1_ps(max[a]);
+  }
+
+  u4 mask = 0u;
+  for (u4 quad = 0u; quad < LANES; quad += 4u)
+  {
+    __m128 in[3], at[3], near;
+    for (u4 a = 0u; a < 3u; ++a)
+    {
+      in[a] = _mm_loadu_ps(inv[a] + quad);
+      at[a] = _mm_loadu_ps(origin[a] + quad);
+    }
+    __m128 hit = Slab(low, high, in, at, _mm_loadu_ps(far + quad), near);
+    if (tNear) { _mm_storeu_ps(tNear + quad, near); }
+    mask |= static_cast<u4>(_mm_movemask_ps(hit)) << quad;
+  }
+  return mask & lanes & active;
+
+} // end u4 RayPacket<LANES>::Hit(const v3f&, const v3f&, u4, f4*) const      */
+
+
+#if defined(__AVX__)
+template <>
+u4 dp::RayPacket<8u>::Hit(const v3f& min, const v3f& max, u4 lanes,
+  f4* tNear) const
+{
+  __m256 low[3], high[3], in[3], at[3], near;
+  for (s1 a = 0; a < 3; ++a)
+  {
+    low[a] = _mm256_set1_ps(min[a]);
+    high[a] = _mm256_set1_ps(max[a]);
+    in[a] = _mm256_loadu_ps(inv[a]);
+    at[a] = _mm256_loadu_ps(origin[a]);
+  }
+  __m256 hit = Slab(low, high, in, at, _mm256_loadu_ps(far), near);
+  if (tNear) { _mm256_storeu_ps(tNear, near); }
+  return static_cast<u4>(_mm256_movemask_ps(hit)) & lanes & active;
+
+} // end u4 RayPacket<8>::Hit(const v3f&, const v3f&, u4, f4*) const          */
+#endif
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                          Explicit Instantiations                           */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+template class dp::RayPacket<4u>;
+template class dp::RayPacket<8u>;
@@ -0,0 +1,433 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  RayPacket.h
+Purpose:  Wide ray / box slab tests for hierarchy traversal (4 / 8 lanes)
+Details:  two kernels, for the 2 ways of filling SIMD lanes in a traversal:
+  a RayPacket tests 4 or 8 rays against one node box (coherent primary and
+  shadow rays walk the hierarchy together, narrowing a lane mask), and a
+  RaySlab tests one ray against the 4 or 8 child boxes of a wide node (as in
+  4-wide BVHs, or an octree's 8 octants), gathered into BoxLanes.
+
+  Both are branch free slab tests: each ray keeps its origin and reciprocal
+  direction, so each slab costs a subtract and a multiply per axis and
+  bound.  Reciprocals are left infinite for 0 direction components, as in
+  Ray::IsIn(const AABB&): a parallel ray gets a -INf..INf slab span inside
+  it, or a same signed INf one outside it, and one on a slab plane gets a
+  NaN end, which skips that slab; so no special case is needed.
+  Sides are inclusive, as in Ray::IsIn(const AABB&).
+
+  Neither depends on a hierarchy's layout: traversals just hand in node
+  boxes (see LBVH::Query(const RayPacket&, ...) for a packet walk).
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// "./src/..."
+#include "v3f.h"  // Ray origins / directions, box extrema
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class Ray; // Source of each lane's origin / direction
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! An object reached by a packet, with the lanes of the rays reaching it
+  struct LaneHit
+  {
+    u4 object;  //! Caller's identifier of the object (e.g. a leaf's primitive)
+    u4 lanes;   //! Bit mask of the packet lanes whose rays reach it
+  };
+
+
+  //! Up to LANES boxes (a wide node's children), by axis in SoA lanes;
+  //! loaded unaligned, as C++14 heap storage (e.g. std::vector) may ignore
+  //! the alignas, which only keeps stack & static copies off line splits
+  template <u4 LANES>
+  struct BoxLanes
+  {
+    alignas(32) f4 min[3][LANES]; //! Lowest corner of each box, by axis
+    alignas(32) f4 max[3][LANES]; //! Highest corner of each box, by axis
+    u4 used;                      //! Mask of lanes set (others never hit)
+
+    /** Create a set of boxes with no lanes in use
+    \brief
+      - create a set of boxes with no lanes in use
+    */
+    inline BoxLanes(void) { Clear(); } // end BoxLanes::BoxLanes(void)        */
+
+
+    /** Mark every lane unused (their box values are zeroed)
+    \brief
+      - mark every lane unused (their box values are zeroed)
+    \return
+      - reference to the boxes for easier subsequent inline action
+    */
+    inline BoxLanes& Clear(void)
+    {
+      for (u4 a = 0u; a < 3u; ++a)
+      {
+        for (u4 l = 0u; l < LANES; ++l) { min[a][l] = max[a][l] = 0.0f; }
+      }
+      used = 0u;
+      return *this;
+
+    } // end BoxLanes& BoxLanes::Clear(void)                                  */
+
+
+    /** Set one lane's box, marking it in use
+    \brief
+      - set one lane's box, marking it in use
+    \param lane
+      - lane to be set, in [0, LANES)
+    \param low
+      - lowest corner of the box
+    \param high
+      - highest corner of the box
+    \return
+      - reference to the boxes for easier subsequent inline action
+    */
+    inline BoxLanes& Set(u4 lane, const v3f& low, const v3f& high)
+    {
+      min[0][lane] = low.x; min[1][lane] = low.y; min[2][lane] = low.z;
+      max[0][lane] = high.x; max[1][lane] = high.y; max[2][lane] = high.z;
+      used |= 1u << lane;
+      return *this;
+
+    } // end BoxLanes& BoxLanes::Set(u4, const v3f&, const v3f&)              */
+
+  }; // end BoxLanes struct declaration
+
+
+  //! One ray's slab test terms, for testing many boxes at once
+  class RaySlab
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create the slab test terms of a ray, over [0, tMax] along it
+    \brief
+      - create the slab test terms of a ray, over [0, tMax] along it
+    \param ray
+      - world space ray to be tested
+    \param tMax
+      - farthest distance along the ray to be tested
+    */
+    RaySlab(const Ray& ray, f4 tMax = INf);
+
+
+    /** Create the slab test terms of a ray, over [0, tMax] along it
+    \brief
+      - create the slab test terms of a ray, over [0, tMax] along it
+    \param origin
+      - world space start of the ray
+    \param direction
+      - direction of the ray (distances are in its lengths)
+    \param tMax
+      - farthest distance along the ray to be tested
+    */
+    RaySlab(const v3f& origin, const v3f& direction, f4 tMax = INf);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the farthest distance along the ray tested
+    \brief
+      - get the farthest distance along the ray tested
+    \return
+      - distance boxes must be entered by to be hit
+    */
+    inline f4 Far(void) const
+    { return far; } // end f4 RaySlab::Far(void) const                        */
+
+
+    /** Set the farthest distance along the ray tested (as hits shorten it)
+    \brief
+      - set the farthest distance along the ray tested (as hits shorten it)
+    \param tMax
+      - distance boxes must be entered by to be hit
+    \return
+      - reference to the ray for easier subsequent inline action
+    */
+    inline RaySlab& Far(f4 tMax)
+    { far = tMax; return *this; } // end RaySlab& RaySlab::Far(f4)            */
+
+
+    /** Check if the ray passes through a box
+    \brief
+      - check if the ray passes through a box
+    \param min
+      - lowest corner of the box
+    \param max
+      - highest corner of the box
+    \param tNear
+      - distance the box is entered at (0 if started in), to be set if given
+    \return
+      - true if the ray passes through the box within [0, Far()]
+    */
+    bool Hit(const v3f& min, const v3f& max, f4* tNear = nullptr) const;
+
+
+    /** Check which of 4 boxes the ray passes through
+    \brief
+      - check which of 4 boxes the ray passes through
+    \param boxes
+      - boxes to be tested, as of a 4-wide node's children
+    \param tNear
+      - 4 distances each box is entered at, to be set if given (for ordering)
+    \return
+      - mask of used lanes whose boxes the ray passes through within Far()
+    */
+    u4 Hit(const BoxLanes<4>& boxes, f4* tNear = nullptr) const;
+
+
+    /** Check which of 8 boxes the ray passes through
+    \brief
+      - check which of 8 boxes the ray passes through
+    \param boxes
+      - boxes to be tested, as of an octree node's / 8-wide node's children
+    \param tNear
+      - 8 distances each box is entered at, to be set if given (for ordering)
+    \return
+      - mask of used lanes whose boxes the ray passes through within Far()
+    */
+    u4 Hit(const BoxLanes<8>& boxes, f4* tNear = nullptr) const;
+
+
+    /** Access the ray's reciprocal direction, by axis (for custom kernels)
+    \brief
+      - access the ray's reciprocal direction, by axis (for custom kernels)
+    \return
+      - 3 reciprocal direction components (+/-INf for 0 ones)
+    */
+    inline const f4* Inverses(void) const
+    { return inv; } // end const f4* RaySlab::Inverses(void) const            */
+
+
+    /** Access the ray's origin, by axis (for custom kernels)
+    \brief
+      - access the ray's origin, by axis (for custom kernels)
+    \return
+      - 3 origin components
+    */
+    inline const f4* Origin(void) const
+    { return origin; } // end const f4* RaySlab::Origin(void) const           */
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Reciprocal direction, by axis (+/-INf for 0 components)
+    f4 inv[3];
+
+    //! Origin, by axis
+    f4 origin[3];
+
+    //! Farthest distance along the ray tested
+    f4 far;
+
+  }; // end RaySlab class declaration
+
+
+  //! Up to LANES rays in SoA lanes, tested against boxes together
+  template <u4 LANES>
+  class RayPacket
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create a packet of rays, each tested over [0, tMax] along it
+    \brief
+      - create a packet of rays, each tested over [0, tMax] along it
+    \param rays
+      - world space rays, one per lane
+    \param count
+      - number of rays given, at most LANES (lanes past it are never hit)
+    \param tMax
+      - farthest distance along each ray to be tested
+    */
+    RayPacket(const Ray* rays, u4 count, f4 tMax = INf);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the mask of lanes holding rays still being traced
+    \brief
+      - get the mask of lanes holding rays still being traced
+    \return
+      - lane bit mask
+    */
+    inline u4 Active(void) const
+    { return active; } // end u4 RayPacket::Active(void) const                */
+
+
+    /** Set the mask of lanes holding rays still being traced
+    \brief
+      - set the mask of lanes holding rays still being traced
+    \details
+      - e.g. dropping shadow rays already found occluded
+    \param lanes
+      - lane bit mask (lanes never given rays stay inactive)
+    \return
+      - reference to the packet for easier subsequent inline action
+    */
+    inline RayPacket& Active(u4 lanes)
+    {
+      active = lanes & ((1u << count) - 1u);
+      return *this;
+
+    } // end RayPacket& RayPacket::Active(u4)                                 */
+
+
+    /** Check if every ray heads the same way (by sign) along each axis
+    \brief
+      - check if every ray heads the same way (by sign) along each axis
+    \details
+      - packets of diverging rays visit the union of their rays' nodes, so
+      incoherent rays (e.g. diffuse bounces) are better traced singly
+    \return
+      - true if all rays share their direction's octant
+    */
+    inline bool Coherent(void) const
+    { return coherent; } // end bool RayPacket::Coherent(void) const          */
+
+
+    /** Get the number of lanes given rays
+    \brief
+      - get the number of lanes given rays
+    \return
+      - ray count, in [0, LANES]
+    */
+    inline u4 Count(void) const
+    { return count; } // end u4 RayPacket::Count(void) const                  */
+
+
+    /** Access every lane's direction component along an axis
+    \brief
+      - access every lane's direction component along an axis
+    \param axis
+      - 0, 1 or 2 for x, y or z
+    \return
+      - LANES direction components (0 for lanes past Count())
+    */
+    inline const f4* Directions(u4 axis) const
+    { return dir[axis]; } // end const f4* RayPacket::Directions(u4) const    */
+
+
+    /** Get the farthest distance along a lane's ray tested
+    \brief
+      - get the farthest distance along a lane's ray tested
+    \param lane
+      - lane of the ray, in [0, Count())
+    \return
+      - distance boxes must be entered by to be hit
+    */
+    inline f4 Far(u4 lane) const
+    { return far[lane]; } // end f4 RayPacket::Far(u4) const                  */
+
+
+    /** Set the farthest distance along a lane's ray tested (as hits shorten it)
+    \brief
+      - set the farthest distance along a lane's ray tested (as hits shorten it)
+    \param lane
+      - lane of the ray, in [0, Count())
+    \param tMax
+      - distance boxes must be entered by to be hit
+    \return
+      - reference to the packet for easier subsequent inline action
+    */
+    inline RayPacket& Far(u4 lane, f4 tMax)
+    {
+      far[lane] = tMax;
+      return *this;
+
+    } // end RayPacket& RayPacket::Far(u4, f4)                                */
+
+
+    /** Check which rays of the given lanes pass through a box
+    \brief
+      - check which rays of the given lanes pass through a box
+    \param min
+      - lowest corner of the box
+    \param max
+      - highest corner of the box
+    \param lanes
+      - mask of lanes to be tested (e.g. those reaching the box's parent)
+    \param tNear
+      - LANES distances each ray enters the box at, to be set if given
+    \return
+      - mask of the given active lanes whose rays pass through the box
+    */
+    u4 Hit(const v3f& min, const v3f& max, u4 lanes, f4* tNear = nullptr) const;
+
+
+    /** Access every lane's origin coordinate along an axis
+    \brief
+      - access every lane's origin coordinate along an axis
+    \param axis
+      - 0, 1 or 2 for x, y or z
+    \return
+      - LANES origin coordinates (0 for lanes past Count())
+    */
+    inline const f4* Origins(u4 axis) const
+    { return origin[axis]; } // end const f4* RayPacket::Origins(u4) const    */
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Reciprocal direction of each lane's ray, by axis
+    alignas(32) f4 inv[3][LANES];
+
+    //! Origin of each lane's ray, by axis
+    alignas(32) f4 origin[3][LANES];
+
+    //! Direction of each lane's ray, by axis
+    alignas(32) f4 dir[3][LANES];
+
+    //! Farthest distance along each lane's ray tested
+    alignas(32) f4 far[LANES];
+
+    //! Mask of lanes holding rays still being traced
+    u4 active;
+
+    //! Number of lanes given rays
+    u4 count;
+
+    //! Whether all rays share their direction's octant
+    bool coherent;
+
+  }; // end RayPacket class declaration
+
+  using RayPacket4 = RayPacket<4u>; //! 4 ray packet: 1 SSE register per term
+  using RayPacket8 = RayPacket<8u>; //! 8 ray packet: 1 AVX register per term
+
+} // end dp namespace
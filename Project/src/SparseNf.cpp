@@ -0,0 +1,526 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  SparseNf.cpp
+Purpose:  Compressed sparse row matrices & their preconditioned CG solver
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_MAT300_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <algorithm>  // Sorting cells into rows, binary search within rows
+#include <chrono>     // Wall clock timing of benchmark solves
+#include <cmath>      // Double precision square roots of residual norms
+// "./src/..."
+#include "FactorNf.h" // Dense LU solves, for benchmark comparison
+#include "Log.h"      // Not positive definite warnings
+#include "Mesh.h"     // Vertex adjacency, by tri & edge subscripts
+#include "mNf.h"      // Dense copies of benchmark matrices
+#include "Parallel.h" // Rows & elements split over the hardware's threads
+#include "SparseNf.h" // Class declaration header
+#include "Value.h"    // Basic numerical operations: abs, sqrt, min
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace
+{
+  //! Get a vector's elements as exactly count values (0 extended / truncated)
+  std::vector<f4> Fit(const dp::vNf& b, u4 count)
+  {
+    std::vector<f4> values(count, 0.0f);
+    u4 shorter = MinU(count, b.Dimens());
+    for (u4 i = 0; i < shorter; ++i) { values[i] = b[i]; }
+    return values;
+  }
+
+  //! Get the sum of body(first, last) over chunks of [0, count), in parallel
+  template <typename Body>
+  f8 Sum(u4 count, const Body& body)
+  {
+    std::vector<f8> part(dp::ParallelChunks(count), 0.0);
+    dp::ParallelFor(count, [&](u4 first, u4 last, u4 chunk)
+    {
+      part[chunk] = body(first, last);
+    });
+    f8 sum = 0.0;
+    for (f8 chunkSum : part) { sum += chunkSum; }
+    return sum;
+  }
+
+  //! Get the sorted, unique <row << 32 | column> pairs of joined vertices
+  std::vector<u8> Joined(const dp::Mesh& mesh, bool trace)
+  {
+    u4 verts = mesh.VertexCount();
+    u4 tris = mesh.TriCount(), edges = mesh.EdgeCount();
+    std::vector<u8> pairs;
+    pairs.reserve(6u * tris + 2u * edges + (trace ? verts : 0u));
+    auto join = [&](u4 a, u4 b)
+    {
+      if (a == b || verts <= a || verts <= b) { return; }
+      pairs.push_back(static_cast<u8>(a) << 32u | b);
+      pairs.push_back(static_cast<u8>(b) << 32u | a);
+    };
+
+    const dp::Mesh::Tri* tri = tris ? &mesh.TriBuffer() : nullptr;
+    for (u4 t = 0; t < tris; ++t)
+    {
+      join(tri[t].i, tri[t].c);
+      join(tri[t].c, tri[t].t);
+      join(tri[t].t, tri[t].i);
+    }
+    const dp::Mesh::Edge* edge = edges ? &mesh.EdgeBuffer() : nullptr;
+    for (u4 e = 0; e < edges; ++e) { join(edge[e].i, edge[e].t); }
+    if (trace)
+    {
+      for (u4 v = 0; v < verts; ++v)
+      {
+        pairs.push_back(static_cast<u8>(v) << 32u | v);
+      }
+    }
+
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+    return pairs;
+  }
+
+} // end anonymous namespace
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::SparseNf::SparseNf(u4 rows, u4 cols) : start(rows + 1u, 0u), cols(cols)
+{
+
+} // end SparseNf::SparseNf(u4, u4)                                           */
+
+
+dp::SparseNf::SparseNf(u4 rows, u4 cols, const std::vector<Entry>& entries)
+  : start(rows + 1u, 0u), cols(cols)
+{
+  // Sort in-range entries by row, then column
+  std::vector<Entry> sorted;
+  sorted.reserve(entries.size());
+  for (const Entry& entry : entries)
+  {
+    if (entry.row < rows && entry.col < cols) { sorted.push_back(entry); }
+  }
+  std::sort(sorted.begin(), sorted.end(), [](const Entry& a, const Entry& b)
+  {
+    return a.row != b.row ? a.row < b.row : a.col < b.col;
+  });
+
+  // Store each cell once, summing entries of the same cell
+  column.reserve(sorted.size());
+  value.reserve(sorted.size());
+  for (u4 e = 0; e < sorted.size(); ++e)
+  {
+    const Entry& entry = sorted[e];
+    if (e && entry.row == sorted[e - 1u].row && entry.col == sorted[e - 1u].col)
+    {
+      value.back() += entry.value;
+      continue;
+    }
+    column.push_back(entry.col);
+    value.push_back(entry.value);
+    ++start[entry.row + 1u];
+  }
+  for (u4 r = 0; r < rows; ++r) { start[r + 1u] += start[r]; }
+
+} // end SparseNf::SparseNf(u4, u4, const std::vector<Entry>&)                */
+
+
+dp::ConjugateNf::ConjugateNf(const SparseNf& matrix, Precondition mode)
+  : matrix(&matrix), mode(mode), iterations(0u), residual(0.0f)
+{
+  if (mode == Precondition::Jacobi)
+  {
+    u4 n = matrix.Rows();
+    inverse.resize(n);
+    for (u4 r = 0; r < n; ++r)
+    {
+      f4 trace = matrix.Get(r, r);
+      inverse[r] = trace != 0.0f ? 1.0f / trace : 1.0f;
+    }
+  }
+  else if (mode == Precondition::IC0) { Factor(); }
+
+} // end ConjugateNf::ConjugateNf(const SparseNf&, Precondition)              */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Static Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::SparseNf dp::SparseNf::Adjacency(const Mesh& mesh)
+{
+  u4 verts = mesh.VertexCount();
+  SparseNf adjacency(verts, verts);
+  std::vector<u8> pairs = Joined(mesh, false);
+  adjacency.column.reserve(pairs.size());
+  for (u8 pair : pairs)
+  {
+    ++adjacency.start[(pair >> 32u) + 1u];
+    adjacency.column.push_back(static_cast<u4>(pair));
+  }
+  for (u4 r = 0; r < verts; ++r)
+  {
+    adjacency.start[r + 1u] += adjacency.start[r];
+  }
+  adjacency.value.assign(pairs.size(), 1.0f);
+  return adjacency;
+
+} // end SparseNf SparseNf::Adjacency(const Mesh&)                            */
+
+
+dp::SparseNf dp::SparseNf::Laplacian(const Mesh& mesh, f4 shift)
+{
+  u4 verts = mesh.VertexCount();
+  SparseNf laplacian(verts, verts);
+  std::vector<u8> pairs = Joined(mesh, true);
+  laplacian.column.reserve(pairs.size());
+  for (u8 pair : pairs)
+  {
+    ++laplacian.start[(pair >> 32u) + 1u];
+    laplacian.column.push_back(static_cast<u4>(pair));
+  }
+  for (u4 r = 0; r < verts; ++r)
+  {
+    laplacian.start[r + 1u] += laplacian.start[r];
+  }
+
+  // -1 per neighbor, & the neighbor count (row size less the trace) + shift
+  laplacian.value.assign(pairs.size(), -1.0f);
+  for (u4 r = 0; r < verts; ++r)
+  {
+    u4 first = laplacian.start[r], last = laplacian.start[r + 1u];
+    for (u4 p = first; p < last; ++p)
+    {
+      if (laplacian.column[p] != r) { continue; }
+      laplacian.value[p] = static_cast<f4>(last - first - 1u) + shift;
+      break;
+    }
+  }
+  return laplacian;
+
+} // end SparseNf SparseNf::Laplacian(const Mesh&, f4)                        */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::vNf dp::SparseNf::Diagonal(void) const
+{
+  u4 n = MinU(Rows(), cols);
+  vNf trace(n);
+  for (u4 r = 0; r < n; ++r) { trace.elem[r] = Get(r, r); }
+  return trace;
+
+} // end vNf SparseNf::Diagonal(void) const                                   */
+
+
+f4 dp::SparseNf::Get(u4 row, u4 col) const
+{
+  if (Rows() <= row) { return 0.0f; }
+  const u4* first = column.data() + start[row];
+  const u4* last = column.data() + start[row + 1u];
+  const u4* found = std::lower_bound(first, last, col);
+  if (found == last || *found != col) { return 0.0f; }
+  return value[found - column.data()];
+
+} // end f4 SparseNf::Get(u4, u4) const                                       */
+
+
+bool dp::ConjugateNf::Solve(const vNf& b, vNf& x, f4 tolerance, u4 limit)
+{
+  u4 n = matrix->Rows();
+  iterations = 0u;
+  residual = 0.0f;
+  if (x.Dimens() != n) { x = vNf(n); }
+  if (!n) { return true; }
+  if (!limit) { limit = n; }
+
+  std::vector<f4> given = Fit(b, n), r(n), z(n), p(n), q(n);
+  f4* xs = x.elem;
+  const SparseNf& a = *matrix;
+
+  // r = b - A x, from the first guess
+  f8 bb = Sum(n, [&](u4 first, u4 last)
+  {
+    f8 sum = 0.0;
+    for (u4 i = first; i < last; ++i)
+    {
+      r[i] = given[i] - a.RowDot(i, xs);
+      sum += static_cast<f8>(given[i]) * given[i];
+    }
+    return sum;
+  });
+  if (bb == 0.0)
+  {
+    for (u4 i = 0; i < n; ++i) { xs[i] = 0.0f; }
+    return true;
+  }
+  f8 norm = std::sqrt(bb);
+  f8 rr = Sum(n, [&](u4 first, u4 last)
+  {
+    f8 sum = 0.0;
+    for (u4 i = first; i < last; ++i) { sum += static_cast<f8>(r[i]) * r[i]; }
+    return sum;
+  });
+  residual = static_cast<f4>(std::sqrt(rr) / norm);
+  if (residual <= tolerance) { return true; }
+
+  f8 rz = Apply(r.data(), z.data());
+  p = z;
+  while (iterations < limit)
+  {
+    // q = A p, fused with p . q
+    f8 pq = Sum(n, [&](u4 first, u4 last)
+    {
+      f8 sum = 0.0;
+      for (u4 i = first; i < last; ++i)
+      {
+        q[i] = a.RowDot(i, p.data());
+        sum += static_cast<f8>(p[i]) * q[i];
+      }
+      return sum;
+    });
+    if (pq <= 0.0)
+    {
+      Log::Warn("ConjugateNf - matrix is not positive definite");
+      return false;
+    }
+
+    // Step along p: x += alpha p, r -= alpha q, fused with r . r
+    f4 alpha = static_cast<f4>(rz / pq);
+    rr = Sum(n, [&](u4 first, u4 last)
+    {
+      f8 sum = 0.0;
+      for (u4 i = first; i < last; ++i)
+      {
+        xs[i] += alpha * p[i];
+        r[i] -= alpha * q[i];
+        sum += static_cast<f8>(r[i]) * r[i];
+      }
+      return sum;
+    });
+    ++iterations;
+    residual = static_cast<f4>(std::sqrt(rr) / norm);
+    if (residual <= tolerance) { return true; }
+
+    // Next direction: conjugate to the last, from the preconditioned residual
+    f8 next = Apply(r.data(), z.data());
+    f4 beta = static_cast<f4>(next / rz);
+    rz = next;
+    ParallelFor(n, [&](u4 first, u4 last, u4)
+    {
+      for (u4 i = first; i < last; ++i) { p[i] = z[i] + beta * p[i]; }
+    });
+  }
+  return false;
+
+} // end bool ConjugateNf::Solve(const vNf&, vNf&, f4, u4)                    */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Operator Overloads                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::vNf dp::SparseNf::operator*(const vNf& vector) const
+{
+  std::vector<f4> given = Fit(vector, cols);
+  vNf product(Rows());
+  f4* out = product.elem;
+  ParallelFor(Rows(), [&](u4 first, u4 last, u4)
+  {
+    for (u4 r = first; r < last; ++r) { out[r] = RowDot(r, given.data()); }
+  });
+  return product;
+
+} // end vNf SparseNf::operator*(const vNf&) const                            */
+
+
+dp::SparseNf& dp::SparseNf::operator*=(f4 scalar)
+{
+  for (f4& cell : value) { cell *= scalar; }
+  return *this;
+
+} // end SparseNf& SparseNf::operator*=(f4)                                   */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+f8 dp::ConjugateNf::Apply(const f4* r, f4* z) const
+{
+  u4 n = matrix->Rows();
+  if (mode == Precondition::IC0)
+  {
+    // Forward substitution: L y = r (row by row, each row ending on L's trace)
+    for (u4 i = 0; i < n; ++i)
+    {
+      u4 trace = start[i + 1u] - 1u;
+      f4 sum = r[i];
+      for (u4 p = start[i]; p < trace; ++p) { sum -= lower[p] * z[column[p]]; }
+      z[i] = sum / lower[trace];
+    }
+    // Back substitution: L^T z = y (row i of L is column i of L^T)
+    for (u4 i = n; i-- > 0u;)
+    {
+      u4 trace = start[i + 1u] - 1u;
+      f4 zi = (z[i] /= lower[trace]);
+      for (u4 p = start[i]; p < trace; ++p) { z[column[p]] -= lower[p] * zi; }
+    }
+  }
+
+  // Jacobi & none are elementwise: fused with r . z
+  return Sum(n, [&](u4 first, u4 last)
+  {
+    f8 sum = 0.0;
+    for (u4 i = first; i < last; ++i)
+    {
+      if (mode == Precondition::Jacobi) { z[i] = r[i] * inverse[i]; }
+      else if (mode == Precondition::None) { z[i] = r[i]; }
+      sum += static_cast<f8>(r[i]) * z[i];
+    }
+    return sum;
+  });
+
+} // end f8 ConjugateNf::Apply(const f4*, f4*) const                          */
+
+
+void dp::ConjugateNf::Factor(void)
+{
+  const SparseNf& a = *matrix;
+  u4 n = a.Rows();
+
+  // Pattern: each row's cells left of the trace, then its trace cell
+  start.assign(1u, 0u);
+  start.reserve(n + 1u);
+  for (u4 r = 0; r < n; ++r)
+  {
+    f4 trace = 0.0f;
+    for (u4 p = a.start[r]; p < a.start[r + 1u]; ++p)
+    {
+      if (r <= a.column[p])
+      {
+        if (a.column[p] == r) { trace = a.value[p]; }
+        break;
+      }
+      column.push_back(a.column[p]);
+      lower.push_back(a.value[p]);
+    }
+    column.push_back(r);
+    lower.push_back(trace);
+    start.push_back(static_cast<u4>(lower.size()));
+  }
+
+  // Row by row: cells left of the trace, then the trace, dropping any fill
+  bool shifted = false;
+  for (u4 r = 0; r < n; ++r)
+  {
+    u4 first = start[r], trace = start[r + 1u] - 1u;
+    for (u4 p = first; p < trace; ++p)
+    {
+      // Dot of row r & row k left of column k, where both hold a cell
+      u4 k = column[p];
+      u4 i = first, j = start[k], end = start[k + 1u] - 1u;
+      f8 dot = 0.0;
+      while (i < p && j < end)
+      {
+        if (column[i] < column[j]) { ++i; }
+        else if (column[j] < column[i]) { ++j; }
+        else { dot += static_cast<f8>(lower[i++]) * lower[j++]; }
+      }
+      lower[p] = static_cast<f4>((lower[p] - dot) / lower[end]);
+    }
+
+    f8 pivot = lower[trace];
+    for (u4 p = first; p < trace; ++p)
+    {
+      pivot -= static_cast<f8>(lower[p]) * lower[p];
+    }
+    if (pivot <= 0.0)
+    {
+      shifted = true;
+      f4 cell = AbsF(lower[trace]);
+      pivot = cell > 0.0f ? cell : 1.0f;
+    }
+    lower[trace] = static_cast<f4>(std::sqrt(pivot));
+  }
+  if (shifted)
+  {
+    Log::Warn("ConjugateNf - IC(0) pivot not positive: replaced by trace");
+  }
+
+} // end void ConjugateNf::Factor(void)                                       */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Helper Functions                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+f8 dp::SparseNfBenchmark(u4 side, f8* dense, u4* iterations)
+{
+  // Fixed seed linear congruential generator: repeatable runs to compare
+  u4 seed = 0x2545F491u;
+  auto random = [&seed](void)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    return static_cast<f4>(seed >> 8) * (1.0f / 16777216.0f) - 0.5f;
+  };
+
+  // Grid Laplacian (4 neighbors per inner vertex) + 0.1 I, as a mesh's
+  // implicit smoothing step would give: symmetric positive definite
+  u4 n = side * side;
+  std::vector<SparseNf::Entry> entries;
+  entries.reserve(5u * n);
+  for (u4 r = 0; r < n; ++r)
+  {
+    u4 x = r % side, y = r / side, joined = 0u;
+    if (0u < x) { entries.push_back({ r, r - 1u, -1.0f }); ++joined; }
+    if (x + 1u < side) { entries.push_back({ r, r + 1u, -1.0f }); ++joined; }
+    if (0u < y) { entries.push_back({ r, r - side, -1.0f }); ++joined; }
+    if (y + 1u < side) { entries.push_back({ r, r + side, -1.0f }); ++joined; }
+    entries.push_back({ r, r, static_cast<f4>(joined) + 0.1f });
+  }
+  SparseNf sparse(n, n, entries);
+  vNf b(n);
+  for (u4 i = 0; i < n; ++i) { b[i] = random(); }
+
+  // Sparse: IC(0) preconditioner build & solve from a 0 first guess
+  auto start = std::chrono::steady_clock::now();
+  ConjugateNf solver(sparse);
+  vNf x(n);
+  solver.Solve(b, x);
+  auto end = std::chrono::steady_clock::now();
+  if (iterations) { *iterations = solver.Iterations(); }
+
+  // Dense: the same cells, LU factored & solved (O(N^3): only if asked)
+  if (dense)
+  {
+    mNf full(n, 0.0f);
+    for (const SparseNf::Entry& e : entries) { full[e.col][e.row] = e.value; }
+    auto denseStart = std::chrono::steady_clock::now();
+    vNf y = LUNf(full).Solve(b);
+    auto denseEnd = std::chrono::steady_clock::now();
+    *dense = std::chrono::duration<f8, std::milli>(denseEnd - denseStart)
+      .count();
+  }
+  return std::chrono::duration<f8, std::milli>(end - start).count();
+
+} // end f8 SparseNfBenchmark(u4, f8*, u4*)                                   */
@@ -0,0 +1,417 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  SparseNf.h
+Purpose:  Compressed sparse row matrices & their preconditioned CG solver
+Details:  Mesh systems (Laplacian smoothing, parameterization, cloth) have a
+  row per vertex, but only a handful of cells per row: the vertex & its
+  neighbors.  Dense mNf storage & O(N^3) factoring can't reach hundreds of
+  thousands of unknowns; storing only the non-zero cells can.
+
+  - SparseNf: compressed sparse row (CSR) cells.  Each row's cells are held
+    together, sorted by column, so a matrix * vector product reads each cell
+    once in order, & rows split across the hardware's threads with no sharing
+  - ConjugateNf: conjugate gradient solver of a symmetric positive definite
+    SparseNf, preconditioned by its trace (Jacobi) or by an incomplete
+    Cholesky factor kept to the matrix's own pattern (IC(0)).  The
+    preconditioner is built once, then reused by each solve
+
+  Both interoperate with vNf: products & solutions are vNf's, & a solve's
+  x vector is taken as its first guess (warm starting frame to frame).
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_MAT300_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <vector>       // Row starts, column subscripts & cell values
+// "./src/..."
+#include "TypeErrata.h" // Platform primitive type aliases for easier porting
+#include "vNf.h"        // Product, right hand side & solution vectors
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class Mesh; // Vertex adjacency to build matrix patterns from
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  class SparseNf //! Compressed row [Sparse] matrix of a[N]y 4-byte [f]loats
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Internal Classes                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! A single <row, column, value> cell, for building a matrix in any order
+    struct Entry
+    {
+      u4 row;   //! Row subscript [0, Rows())
+      u4 col;   //! Column subscript [0, Cols())
+      f4 value; //! Cell value (summed with any other entry of the same cell)
+    };
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create an all 0 matrix (no cells stored) of the given size
+    \brief
+      - create an all 0 matrix (no cells stored) of the given size
+    \param rows
+      - number of rows
+    \param cols
+      - number of columns
+    */
+    SparseNf(u4 rows = 0u, u4 cols = 0u);
+
+
+    /** Create a matrix from a list of cells, in any order
+    \brief
+      - create a matrix from a list of cells, in any order
+    \details
+      - entries of the same cell are summed (as in finite element assembly);
+      entries outside rows x cols are skipped
+    \param rows
+      - number of rows
+    \param cols
+      - number of columns
+    \param entries
+      - <row, column, value> cells to store
+    */
+    SparseNf(u4 rows, u4 cols, const std::vector<Entry>& entries);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Static Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create a mesh's vertex adjacency matrix: 1 where vertices are joined
+    \brief
+      - create a mesh's vertex adjacency matrix: 1 where vertices are joined
+    \details
+      - vertices are joined by a shared tri side or edge; the trace is empty
+    \param mesh
+      - mesh whose VertexCount() sets the square size
+    \return
+      - symmetric matrix with a 1 per joined (row, column) vertex pair
+    */
+    static SparseNf Adjacency(const Mesh& mesh);
+
+
+    /** Create a mesh's (uniform) graph Laplacian, plus shift on the trace
+    \brief
+      - create a mesh's (uniform) graph Laplacian, plus shift on the trace
+    \details
+      - each row holds the vertex's neighbor count (+ shift) on the trace, &
+      -1 per neighbor.  The Laplacian is positive semi-definite; any shift
+      above 0 makes it positive definite (as implicit smoothing's I + t L,
+      scaled by 1 / t, is)
+    \param mesh
+      - mesh whose VertexCount() sets the square size
+    \param shift
+      - value added to every trace cell
+    \return
+      - symmetric matrix of degree - adjacency + shift * identity
+    */
+    static SparseNf Laplacian(const Mesh& mesh, f4 shift = 0.0f);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the number of columns
+    \brief
+      - get the number of columns
+    \return
+      - element count of vectors the matrix multiplies
+    */
+    inline u4 Cols(void) const
+    { return cols; } // end u4 SparseNf::Cols(void) const                     */
+
+
+    /** Get the trace cells as a vector
+    \brief
+      - get the trace cells as a vector
+    \return
+      - min(Rows(), Cols()) elements: each (i, i) cell (0 where not stored)
+    */
+    vNf Diagonal(void) const;
+
+
+    /** Get the value of a cell (binary search of its row)
+    \brief
+      - get the value of a cell (binary search of its row)
+    \param row
+      - row subscript [0, Rows())
+    \param col
+      - column subscript [0, Cols())
+    \return
+      - cell value, or 0 if the cell isn't stored
+    */
+    f4 Get(u4 row, u4 col) const;
+
+
+    /** Get the number of stored cells
+    \brief
+      - get the number of stored cells
+    \return
+      - count of cells held (all others are 0)
+    */
+    inline u4 NonZeros(void) const
+    { return static_cast<u4>(value.size()); } // end u4 SparseNf::NonZeros    */
+
+
+    /** Get the number of rows
+    \brief
+      - get the number of rows
+    \return
+      - element count of products of the matrix
+    */
+    inline u4 Rows(void) const
+    { return static_cast<u4>(start.size() - 1u); } // end u4 SparseNf::Rows   */
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Operator Overloads                            */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the product of the matrix * a vector (rows split across threads)
+    \brief
+      - get the product of the matrix * a vector (rows split across threads)
+    \param vector
+      - right hand vector (shorter is 0 extended, longer is truncated)
+    \return
+      - product vector of Rows() elements
+    */
+    vNf operator*(const vNf& vector) const;
+
+
+    /** Set the matrix to be scaled uniformly (pattern is kept)
+    \brief
+      - set the matrix to be scaled uniformly (pattern is kept)
+    \param scalar
+      - amount by which to multiply every stored cell
+    \return
+      - reference to the modified matrix for easier subsequent inline action
+    */
+    SparseNf& operator*=(f4 scalar);
+
+  private:
+
+    //! The solver runs rows over its own working arrays, & reads the trace
+    friend class ConjugateNf;
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                           Private Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the dot product of a row's cells with a vector's raw elements
+    \brief
+      - get the dot product of a row's cells with a vector's raw elements
+    \param row
+      - row subscript [0, Rows())
+    \param vector
+      - Cols() right hand elements
+    \return
+      - element row of the matrix * vector product
+    */
+    inline f4 RowDot(u4 row, const f4* vector) const
+    {
+      f4 sum = 0.0f;
+      for (u4 p = start[row]; p < start[row + 1u]; ++p)
+      {
+        sum += value[p] * vector[column[p]];
+      }
+      return sum;
+
+    } // end f4 SparseNf::RowDot(u4, const f4*) const
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Rows() + 1 offsets: row r's cells are [start[r], start[r + 1])
+    std::vector<u4> start;
+
+    //! Column subscript of each cell, ascending within each row
+    std::vector<u4> column;
+
+    //! Value of each cell, in the same order as column
+    std::vector<f4> value;
+
+    //! Number of columns
+    u4 cols;
+
+  }; // end SparseNf class declaration
+
+
+  class ConjugateNf //! Preconditioned [Conjugate] gradient a[N]y [f]loat solve
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Public Constants                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Approximate inverse applied to each residual, to cut iteration counts
+    enum class Precondition
+    {
+      None,   //! Plain conjugate gradient
+      Jacobi, //! Divide by the trace: cheap, & each element in parallel
+      IC0     //! Incomplete Cholesky on the matrix's own pattern: fewer steps
+    };
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create a solver of a symmetric positive definite matrix
+    \brief
+      - create a solver of a symmetric positive definite matrix
+    \details
+      - the preconditioner is built here, once, for every later Solve().  An
+      IC(0) pivot that isn't positive is replaced by the trace cell's root
+      (with a warning), keeping the preconditioner usable
+    \param matrix
+      - square, symmetric positive definite matrix; must outlive the solver
+    \param mode
+      - preconditioner to build & apply
+    */
+    ConjugateNf(const SparseNf& matrix,
+      Precondition mode = Precondition::IC0);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the number of iterations the last Solve() ran
+    \brief
+      - get the number of iterations the last Solve() ran
+    \return
+      - iterations run (0 if the first guess already met the tolerance)
+    */
+    inline u4 Iterations(void) const
+    { return iterations; } // end u4 ConjugateNf::Iterations(void) const      */
+
+
+    /** Get the relative residual |b - A x| / |b| the last Solve() reached
+    \brief
+      - get the relative residual |b - A x| / |b| the last Solve() reached
+    \return
+      - relative residual of the last solution
+    */
+    inline f4 Residual(void) const
+    { return residual; } // end f4 ConjugateNf::Residual(void) const          */
+
+
+    /** Solve (matrix) * x = b for x, iterating from x's current value
+    \brief
+      - solve (matrix) * x = b for x, iterating from x's current value
+    \param b
+      - right hand side vector (shorter is 0 extended, longer is truncated)
+    \param x
+      - first guess (0 if not of Rows() elements), set to the solution
+    \param tolerance
+      - relative residual |b - A x| / |b| at which to stop
+    \param limit
+      - most iterations to run (0 for Rows(): exact in exact arithmetic)
+    \return
+      - true if the tolerance was met, false if the limit was hit first
+    */
+    bool Solve(const vNf& b, vNf& x, f4 tolerance = 0.00001f,
+      u4 limit = 0u);
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                           Private Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Set z = (preconditioner) * r, & get r . z
+    \brief
+      - set z = (preconditioner) * r, & get r . z
+    \param r
+      - residual to precondition
+    \param z
+      - Rows() elements to be set (must not overlap r)
+    \return
+      - dot product of r & the preconditioned z
+    */
+    f8 Apply(const f4* r, f4* z) const;
+
+
+    /** Build IC(0): L with the matrix's lower triangle pattern, L L^T ~ A
+    \brief
+      - build IC(0): L with the matrix's lower triangle pattern, L L^T ~ A
+    */
+    void Factor(void);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Matrix being solved (not owned)
+    const SparseNf* matrix;
+
+    //! Preconditioner applied to each residual
+    Precondition mode;
+
+    //! Jacobi: reciprocal of each trace cell (1 where the trace is 0)
+    std::vector<f4> inverse;
+
+    //! IC(0): Rows() + 1 offsets into lower, each row ending on its trace
+    std::vector<u4> start;
+
+    //! IC(0): column subscript of each factor cell, ascending within rows
+    std::vector<u4> column;
+
+    //! IC(0): lower triangle factor cells, in the same order as column
+    std::vector<f4> lower;
+
+    //! Iterations the last Solve() ran
+    u4 iterations;
+
+    //! Relative residual the last Solve() reached
+    f4 residual;
+
+  }; // end ConjugateNf class declaration
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                      Helper Function Declarations                        */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  /** Get milliseconds to solve a grid Laplacian system by CSR & IC(0) CG
+  \brief
+    - get milliseconds to solve a grid Laplacian system by CSR & IC(0) CG
+  \details
+    - a side x side vertex grid's Laplacian + 0.1 I, with a fixed seed right
+    hand side; the time includes the preconditioner's build.  The same
+    system stored densely & solved by LUNf is timed too, if asked for
+  \param side
+    - vertices along each edge of the grid (side^2 unknowns)
+  \param dense
+    - wall clock milliseconds of the dense LU factor & solve, to be set if
+    given (O(side^6) time & O(side^4) memory: keep side small)
+  \param iterations
+    - conjugate gradient iterations run, to be set if given
+  \return
+    - wall clock milliseconds of the sparse build & solve
+  */
+  f8 SparseNfBenchmark(u4 side = 32u, f8* dense = nullptr,
+    u4* iterations = nullptr);
+
+} // end dp namespace
@@ -0,0 +1,286 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  SpatialHash.cpp
+Purpose:  Hashed uniform grid broadphase for many similar sized BSpheres
+Details:  cell keys pack 21 bits per (biased) cell coordinate, under a set top
+  bit so no occupied key is ever 0 (the empty slot marker).  The table keeps
+  at least twice the slots of spheres, so probe runs stay short.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <cmath>  // Cell quantization (floor) / neighbourhood reach (ceil)
+
+// "./src/..."
+#include "BSphere.h"      // Sphere centers / radii to be binned
+#include "Parallel.h"     // Fork / join over sphere index ranges
+#include "SpatialHash.h"  // Class declaration header
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+//! Cell coordinate bias: cell <BIAS, BIAS, BIAS> holds the world origin
+static const s4 CELL_BIAS = 1 << 20;
+
+//! Cell coordinates span [0, CELL_SPAN) per axis, 21 bits each
+static const s4 CELL_SPAN = 1 << 21;
+
+//! Least indices per chunk for the per sphere passes
+static const u4 GRAIN = 2048u;
+
+
+//! Pack biased cell coordinates into a (non-zero) table key
+static inline u8 PackCell(u4 a, u4 b, u4 c)
+{
+  return (1ull << 63) | (static_cast<u8>(a) << 42)
+    | (static_cast<u8>(b) << 21) | static_cast<u8>(c);
+
+} // end u8 PackCell(u4, u4, u4)                                              */
+
+
+//! Get a key's first table slot to probe (Fibonacci hashing)
+static inline u4 HashCell(u8 key, u4 mask)
+{
+  return static_cast<u4>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+
+} // end u4 HashCell(u8, u4)                                                  */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::SpatialHash::SpatialHash(f4 cellSize) : mask(0u), cells(0u), reach(0u),
+  widest(0.0f), cell(0.0f < cellSize ? cellSize : 1.0f), size(cellSize)
+{ } // end SpatialHash::SpatialHash(f4)                                       */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::SpatialHash& dp::SpatialHash::Build(const BSphere* spheres, u4 n)
+{
+  // Size cells by the widest sphere, then how far out touching ones may be
+  widest = 0.0f;
+  for (u4 i = 0; i < n; ++i) { widest = MaxF(widest, spheres[i].Radius()); }
+  cell = (0.0f < size) ? size : ((0.0f < widest) ? 2.0f * widest : 1.0f);
+  reach = static_cast<u4>(std::ceil(2.0f * widest / cell));
+
+  // Keep at least twice the slots of spheres (a power of 2, for masking)
+  u4 capacity = 16u;
+  while (capacity < 2u * n) { capacity <<= 1; }
+  if (capacity != mask + 1u || !key)
+  {
+    key.reset(new std::atomic<u8>[capacity]);
+    start.reset(new std::atomic<u4>[capacity]);
+    count.resize(capacity);
+    mask = capacity - 1u;
+  }
+  ParallelFor(capacity, [this](u4 first, u4 last, u4)
+  {
+    for (u4 s = first; s < last; ++s)
+    {
+      key[s].store(0u, std::memory_order_relaxed);
+      start[s].store(0u, std::memory_order_relaxed);
+    }
+  }, 4u * GRAIN);
+
+  // Claim each sphere's cell slot, and draw its rank within the cell
+  slot.resize(n);
+  rank.resize(n);
+  ParallelFor(n, [this, spheres](u4 first, u4 last, u4)
+  {
+    for (u4 i = first; i < last; ++i)
+    {
+      v3u at = Cell(spheres[i].Center());
+      u8 k = PackCell(at.a, at.b, at.c);
+      u4 s = HashCell(k, mask);
+      for (;; s = (s + 1u) & mask)
+      {
+        u8 held = key[s].load(std::memory_order_relaxed);
+        if (held == k) { break; }
+        if (held == 0u && (key[s].compare_exchange_strong(held, k,
+          std::memory_order_relaxed) || held == k)) { break; }
+      }
+      slot[i] = s;
+      rank[i] = start[s].fetch_add(1u, std::memory_order_relaxed);
+    }
+  }, GRAIN);
+
+  // Prefix sum of cell counts: each cell's run start in sorted order
+  u4 run = 0u;
+  cells = 0u;
+  for (u4 s = 0; s < capacity; ++s)
+  {
+    u4 c = start[s].load(std::memory_order_relaxed);
+    count[s] = c;
+    start[s].store(run, std::memory_order_relaxed);
+    run += c;
+    cells += (c != 0u);
+  }
+
+  // Scatter spheres into their cell's run, by the rank each drew
+  center.resize(n);
+  radius.resize(n);
+  index.resize(n);
+  ParallelFor(n, [this, spheres](u4 first, u4 last, u4)
+  {
+    for (u4 i = first; i < last; ++i)
+    {
+      u4 p = start[slot[i]].load(std::memory_order_relaxed) + rank[i];
+      center[p] = spheres[i].Center();
+      radius[p] = spheres[i].Radius();
+      index[p] = i;
+    }
+  }, GRAIN);
+  return *this;
+
+} // end SpatialHash& SpatialHash::Build(const BSphere*, u4)                  */
+
+
+dp::SpatialHash& dp::SpatialHash::Build(const std::vector<BSphere>& spheres)
+{
+  return Build(spheres.data(), static_cast<u4>(spheres.size()));
+
+} // end SpatialHash& SpatialHash::Build(const vector<BSphere>&)              */
+
+
+dp::v3u dp::SpatialHash::Cell(const v3f& point) const
+{
+  f4 inv = 1.0f / cell;
+  s4 q[3];
+  for (s1 i = 0; i < 3; ++i)
+  {
+    q[i] = static_cast<s4>(std::floor(point[i] * inv)) + CELL_BIAS;
+    q[i] = (q[i] < 0) ? 0 : ((CELL_SPAN <= q[i]) ? CELL_SPAN - 1 : q[i]);
+  }
+  return v3u(static_cast<u4>(q[0]), static_cast<u4>(q[1]),
+    static_cast<u4>(q[2]));
+
+} // end v3u SpatialHash::Cell(const v3f&) const                              */
+
+
+u4 dp::SpatialHash::Pairs(std::vector<Pair>& pairs) const
+{
+  // Each chunk lists its own pairs: no locks, joined once all are done
+  u4 n = Count();
+  std::vector<std::vector<Pair>> found(ParallelChunks(n, GRAIN));
+  ParallelFor(n, [this, &found](u4 first, u4 last, u4 chunk)
+  {
+    std::vector<Pair>& out = found[chunk];
+    for (u4 p = first; p < last; ++p)
+    {
+      const v3f& c = center[p];
+      const f4 r = radius[p];
+      Scan(Cell(c), reach, true, [&](u4 run, u4 end)
+      {
+        // Own cell: only later spheres, so each pair is listed once
+        for (u4 k = (run <= p && p < end) ? p + 1u : run; k < end; ++k)
+        {
+          f4 sum = r + radius[k];
+          if (DistSq(c, center[k]) <= sum * sum)
+          {
+            u4 i = index[p], j = index[k];
+            out.push_back((i < j) ? Pair{ i, j } : Pair{ j, i });
+          }
+        }
+      });
+    }
+  }, GRAIN);
+
+  size_t total = 0u;
+  for (const std::vector<Pair>& list : found) { total += list.size(); }
+  pairs.clear();
+  pairs.reserve(total);
+  for (const std::vector<Pair>& list : found)
+  {
+    pairs.insert(pairs.end(), list.begin(), list.end());
+  }
+  return static_cast<u4>(total);
+
+} // end u4 SpatialHash::Pairs(vector<Pair>&) const                           */
+
+
+u4 dp::SpatialHash::Query(const v3f& at, f4 r, std::vector<u4>& found) const
+{
+  found.clear();
+  u4 out = static_cast<u4>(std::ceil((r + widest) / cell));
+  Scan(Cell(at), out, false, [&](u4 run, u4 end)
+  {
+    for (u4 k = run; k < end; ++k)
+    {
+      f4 sum = r + radius[k];
+      if (DistSq(at, center[k]) <= sum * sum) { found.push_back(index[k]); }
+    }
+  });
+  return static_cast<u4>(found.size());
+
+} // end u4 SpatialHash::Query(const v3f&, f4, vector<u4>&) const             */
+
+
+u4 dp::SpatialHash::Query(const BSphere& sphere, std::vector<u4>& found) const
+{
+  return Query(sphere.Center(), sphere.Radius(), found);
+
+} // end u4 SpatialHash::Query(const BSphere&, vector<u4>&) const             */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+u4 dp::SpatialHash::Find(u8 k) const
+{
+  if (!key) { return u4_INVALID; }
+  for (u4 s = HashCell(k, mask);; s = (s + 1u) & mask)
+  {
+    u8 held = key[s].load(std::memory_order_relaxed);
+    if (held == k) { return s; }
+    if (held == 0u) { return u4_INVALID; }
+  }
+
+} // end u4 SpatialHash::Find(u8) const                                       */
+
+
+template <typename Visit>
+void dp::SpatialHash::Scan(const v3u& at, u4 out, bool half,
+  const Visit& visit) const
+{
+  // Half: only cells at or after this one (by x, then y, then z offset), so
+  // of any 2 cells, just one scans the other
+  s4 o = static_cast<s4>(out);
+  for (s4 x = half ? 0 : -o; x <= o; ++x)
+  {
+    s4 a = static_cast<s4>(at.a) + x;
+    if (a < 0 || CELL_SPAN <= a) { continue; }
+    for (s4 y = (half && x == 0) ? 0 : -o; y <= o; ++y)
+    {
+      s4 b = static_cast<s4>(at.b) + y;
+      if (b < 0 || CELL_SPAN <= b) { continue; }
+      for (s4 z = (half && x == 0 && y == 0) ? 0 : -o; z <= o; ++z)
+      {
+        s4 c = static_cast<s4>(at.c) + z;
+        if (c < 0 || CELL_SPAN <= c) { continue; }
+        u4 s = Find(PackCell(static_cast<u4>(a), static_cast<u4>(b),
+          static_cast<u4>(c)));
+        if (s == u4_INVALID) { continue; }
+        u4 run = start[s].load(std::memory_order_relaxed);
+        visit(run, run + count[s]);
+      }
+    }
+  }
+
+} // end void SpatialHash::Scan(const v3u&, u4, bool, const Visit&) const
@@ -0,0 +1,248 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  SpatialHash.h
+Purpose:  Hashed uniform grid broadphase for many similar sized BSpheres
+Details:  each sphere is binned into the one grid cell holding its center, so
+  with cells at least the widest sphere's diameter across, any 2 touching
+  spheres sit in the same or neighbouring cells.  Only occupied cells are
+  stored, in an open addressing (linear probing) table keyed by the packed
+  v3u cell coordinate: memory follows the sphere count, not the world size.
+
+  The grid is rebuilt from scratch each frame as a parallel counting sort:
+  cells are claimed (atomic compare & swap) and counted per sphere at once,
+  a prefix sum of the counts places each cell's run, and spheres are copied
+  into their cell's run, each by the rank it drew when counted.  Spheres of
+  one cell then lie side by side, so a neighbourhood scan reads contiguous
+  centers and radii rather than chasing lists.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <atomic>   // Cell claims / counts made by all build threads at once
+#include <memory>   // Owned arrays of atomics (not copyable into a vector)
+#include <vector>   // Sorted sphere / per-sphere build lists
+
+// "./src/..."
+#include "v3f.h"  // Sphere centers, in cell order
+#include "v3u.h"  // Grid cell coordinates
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class BSphere; // Objects binned by center, with radius sizing the cells
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! Hashed uniform grid of BSpheres, rebuilt per frame, for pairs / queries
+  class SpatialHash
+  {
+  public:
+
+    //! Two sphere indices (lower first) whose spheres overlap
+    struct Pair
+    {
+      u4 a; //! Lower sphere index of the pair
+      u4 b; //! Higher sphere index of the pair
+    };
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create an empty grid of the given cell size
+    \brief
+      - create an empty grid of the given cell size
+    \param cellSize
+      - world width of each cubic cell; if not positive, each Build() picks
+      the widest sphere's diameter (the smallest size needing only the 3x3x3
+      neighbourhood scanned for pairs)
+    */
+    SpatialHash(f4 cellSize = 0.0f);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Rebuild the grid over a set of spheres (in parallel for large sets)
+    \brief
+      - rebuild the grid over a set of spheres (in parallel for large sets)
+    \param spheres
+      - world space spheres, by index as named in pairs / query results
+    \param count
+      - number of spheres in the set
+    \return
+      - reference to the grid for easier subsequent inline action
+    */
+    SpatialHash& Build(const BSphere* spheres, u4 count);
+
+
+    /** Rebuild the grid over a list of spheres (in parallel for large sets)
+    \brief
+      - rebuild the grid over a list of spheres (in parallel for large sets)
+    \param spheres
+      - world space spheres, by index as named in pairs / query results
+    \return
+      - reference to the grid for easier subsequent inline action
+    */
+    SpatialHash& Build(const std::vector<BSphere>& spheres);
+
+
+    /** Get the grid cell holding a world space point
+    \brief
+      - get the grid cell holding a world space point
+    \param point
+      - world space coordinate to be quantized
+    \return
+      - cell coordinate, biased so the origin cell is <2^20, 2^20, 2^20>
+    */
+    v3u Cell(const v3f& point) const;
+
+
+    /** Get the world width of each cubic cell, as used by the last Build()
+    \brief
+      - get the world width of each cubic cell, as used by the last Build()
+    \return
+      - cell width
+    */
+    inline f4 CellSize(void) const
+    { return cell; } // end f4 SpatialHash::CellSize(void) const              */
+
+
+    /** Get the number of occupied cells, as of the last Build()
+    \brief
+      - get the number of occupied cells, as of the last Build()
+    \return
+      - count of cells holding at least one sphere center
+    */
+    inline u4 Cells(void) const
+    { return cells; } // end u4 SpatialHash::Cells(void) const                */
+
+
+    /** Get the number of spheres in the grid, as of the last Build()
+    \brief
+      - get the number of spheres in the grid, as of the last Build()
+    \return
+      - count of binned spheres
+    */
+    inline u4 Count(void) const
+    { return static_cast<u4>(index.size()); } // end u4 SpatialHash::Count()  */
+
+
+    /** Get every overlapping pair of spheres (in parallel for large sets)
+    \brief
+      - get every overlapping pair of spheres (in parallel for large sets)
+    \param pairs
+      - list to be filled (after being cleared) with each overlapping pair
+    \return
+      - count of overlapping pairs found
+    */
+    u4 Pairs(std::vector<Pair>& pairs) const;
+
+
+    /** Get every sphere overlapping a query sphere
+    \brief
+      - get every sphere overlapping a query sphere
+    \param center
+      - world space center of the query sphere
+    \param radius
+      - radius of the query sphere (0 for a point)
+    \param found
+      - list to be filled (after being cleared) with overlapping indices
+    \return
+      - count of overlapping spheres found
+    */
+    u4 Query(const v3f& center, f4 radius, std::vector<u4>& found) const;
+
+
+    /** Get every sphere overlapping a query sphere
+    \brief
+      - get every sphere overlapping a query sphere
+    \param sphere
+      - world space query sphere
+    \param found
+      - list to be filled (after being cleared) with overlapping indices
+    \return
+      - count of overlapping spheres found
+    */
+    u4 Query(const BSphere& sphere, std::vector<u4>& found) const;
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                           Private Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Get the table slot of a packed cell key, or u4_INVALID if not occupied
+    u4 Find(u8 key) const;
+
+    //! Scan the cells within reach of a cell (or just the forward half of
+    //! them), calling visit(first, last) on each occupied cell's sphere run
+    template <typename Visit>
+    void Scan(const v3u& at, u4 out, bool half, const Visit& visit) const;
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Packed cell key of each table slot (0 if empty)
+    std::unique_ptr<std::atomic<u8>[]> key;
+
+    //! Sphere count of each table slot's cell, then its run's first index
+    std::unique_ptr<std::atomic<u4>[]> start;
+
+    //! Sphere count of each table slot's cell
+    std::vector<u4> count;
+
+    //! Sphere centers, in cell order
+    std::vector<v3f> center;
+
+    //! Sphere radii, in cell order
+    std::vector<f4> radius;
+
+    //! Input index of each sphere, in cell order
+    std::vector<u4> index;
+
+    //! Table slot of each input sphere, as a build step
+    std::vector<u4> slot;
+
+    //! Rank of each input sphere within its cell, as a build step
+    std::vector<u4> rank;
+
+    //! Table slot count (power of 2), less 1: slot subscript mask
+    u4 mask;
+
+    //! Occupied table slot count
+    u4 cells;
+
+    //! Cells to scan out from a sphere's own for any touching sphere
+    u4 reach;
+
+    //! Widest radius of any binned sphere
+    f4 widest;
+
+    //! World width of each cubic cell, as used by the last build
+    f4 cell;
+
+    //! World width of each cubic cell as requested (if not positive: auto)
+    f4 size;
+
+  }; // end SpatialHash class declaration
+
+} // end dp namespace
@@ -16,10 +16,35 @@ written consent of DigiPen Institute of Technology is prohibited.
 /*                                  Includes                                  */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
+// <stl>
+#include <vector>       // Per thread partial accumulators to be merged
+// "./src/..."
 #include "Log.h"        // System message management for errors, warnings, etc
+#include "m3f.h"        // Covariance matrix result
+#include "m4f.h"        // Placing points into the space to accumulate in
+#include "Parallel.h"   // Splitting point lists over worker threads
 #include "Stats.h"      // Function declaration header file
 #include "Value.h"      // Standardized generic primitive manip. operations
 
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace
+{
+  //! Points per block: placed into a buffer that stays in L1, 2 passes each
+  constexpr u4 BLOCK = 64u;
+
+  //! Get the point a given number of strides past the first
+  inline const dp::v3f& Strided(const dp::v3f* first, u4 index, u4 stride)
+  {
+    return *reinterpret_cast<const dp::v3f*>(
+      reinterpret_cast<const u1*>(first) + static_cast<um>(index) * stride);
+
+  } // end const v3f& Strided(const v3f*, u4, u4)                             */
+
+} // end anonymous namespace
+
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 /*                               Constructors                                 */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -29,6 +54,35 @@ dp::uRng::uRng(u4 samples, u4 size, u2 first, s2 steps)
 { SetMax(size, samples); } // end uRng(u4, u4, s2, u2)                        */
 
 
+dp::Covar3::Covar3(void) : count(0u), mean{0.0, 0.0, 0.0},
+  co{0.0, 0.0, 0.0, 0.0, 0.0, 0.0}
+{
+  static_assert(sizeof(v3f) == POINT_STRIDE, "Covar3 - v3f isn't 3 f4's");
+
+} // end Covar3(void)                                                         */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Static Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::Covar3 dp::Covar3::Gather(const m4f& place, const v3f* points, u4 size,
+  u4 stride)
+{
+  Covar3 all;
+  if (!points || !size) { return all; }
+  std::vector<Covar3> part(ParallelChunks(size));
+  ParallelFor(size, [&](u4 first, u4 last, u4 chunk)
+  {
+    part[chunk].Add(place, &Strided(points, first, stride), last - first,
+      stride);
+  });
+  for (const Covar3& each : part) { all.Merge(each); }
+  return all;
+
+} // end Covar3 Covar3::Gather(const m4f&, const v3f*, u4, u4)                */
+
+
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 /*                        Public Function Definitions                         */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -72,6 +126,110 @@ dp::uRng& dp::uRng::SetStep(s2 increment)
 } // end Smpl& Smpl::SetStep(s2)                                              */
 
 
+dp::Covar3& dp::Covar3::Add(const v3f& point)
+{
+  // Welford: move the mean by the new point's share of its difference, then
+  // add the product of differences from the old & new means
+  f8 inv = 1.0 / static_cast<f8>(++count);
+  f8 d0 = point.x - mean[0], d1 = point.y - mean[1], d2 = point.z - mean[2];
+  mean[0] += d0 * inv;
+  mean[1] += d1 * inv;
+  mean[2] += d2 * inv;
+  f8 e0 = point.x - mean[0], e1 = point.y - mean[1], e2 = point.z - mean[2];
+  co[0] += d0 * e0;
+  co[1] += d1 * e1;
+  co[2] += d2 * e2;
+  co[3] += d0 * e1;
+  co[4] += d0 * e2;
+  co[5] += d1 * e2;
+  return *this;
+
+} // end Covar3& Covar3::Add(const v3f&)                                      */
+
+
+dp::Covar3& dp::Covar3::Add(const v3f* points, u4 size, u4 stride)
+{
+  if (!points) { return *this; }
+  for (u4 first = 0u; first < size; first += BLOCK)
+  {
+    AddBlock(&Strided(points, first, stride), MinU(BLOCK, size - first),
+      stride);
+  }
+  return *this;
+
+} // end Covar3& Covar3::Add(const v3f*, u4, u4)                              */
+
+
+dp::Covar3& dp::Covar3::Add(const m4f& place, const v3f* points, u4 size,
+  u4 stride)
+{
+  if (!points) { return *this; }
+  v3f placed[BLOCK]; // Only a block is ever placed at once
+  for (u4 first = 0u; first < size; first += BLOCK)
+  {
+    u4 n = MinU(BLOCK, size - first);
+    for (u4 i = 0u; i < n; ++i)
+    {
+      placed[i] = place.PProd(Strided(points, first + i, stride));
+    }
+    AddBlock(placed, n, POINT_STRIDE);
+  }
+  return *this;
+
+} // end Covar3& Covar3::Add(const m4f&, const v3f*, u4, u4)                  */
+
+
+dp::m3f dp::Covar3::Matrix(void) const
+{
+  if (count < 2u) { return m3f(); } // As Covariance3D: no spread => I3
+  f8 inv = 1.0 / static_cast<f8>(count);
+  f4 xx = static_cast<f4>(co[0] * inv), yy = static_cast<f4>(co[1] * inv);
+  f4 zz = static_cast<f4>(co[2] * inv), xy = static_cast<f4>(co[3] * inv);
+  f4 xz = static_cast<f4>(co[4] * inv), yz = static_cast<f4>(co[5] * inv);
+  return m3f(xx, xy, xz, xy, yy, yz, xz, yz, zz);
+
+} // end m3f Covar3::Matrix(void) const                                       */
+
+
+dp::v3f dp::Covar3::Mean(void) const
+{
+  return v3f(static_cast<f4>(mean[0]), static_cast<f4>(mean[1]),
+    static_cast<f4>(mean[2]));
+
+} // end v3f Covar3::Mean(void) const                                         */
+
+
+dp::Covar3& dp::Covar3::Merge(const Covar3& other)
+{
+  if (!other.count) { return *this; }
+  if (!count) { return *this = other; }
+  // Chan: pool the means by weight, & add the spread between the 2 means
+  f8 a = static_cast<f8>(count), b = static_cast<f8>(other.count);
+  f8 inv = 1.0 / (a + b), w = a * b * inv;
+  f8 d0 = other.mean[0] - mean[0], d1 = other.mean[1] - mean[1];
+  f8 d2 = other.mean[2] - mean[2];
+  co[0] += other.co[0] + d0 * d0 * w;
+  co[1] += other.co[1] + d1 * d1 * w;
+  co[2] += other.co[2] + d2 * d2 * w;
+  co[3] += other.co[3] + d0 * d1 * w;
+  co[4] += other.co[4] + d0 * d2 * w;
+  co[5] += other.co[5] + d1 * d2 * w;
+  mean[0] += d0 * b * inv;
+  mean[1] += d1 * b * inv;
+  mean[2] += d2 * b * inv;
+  count += other.count;
+  return *this;
+
+} // end Covar3& Covar3::Merge(const Covar3&)                                 */
+
+
+dp::Covar3& dp::Covar3::Reset(void)
+{
+  return *this = Covar3();
+
+} // end Covar3& Covar3::Reset(void)                                          */
+
+
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 /*                        Operator Overload Definitions                       */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -95,3 +253,43 @@ dp::uRng& dp::uRng::operator=(const uRng& other)
   return *this;
 
 } // end u4 Smpl::operator-(const Smpl&)                                      */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                          Private Method Definitions                        */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::Covar3& dp::Covar3::AddBlock(const v3f* points, u4 size, u4 stride)
+{
+  if (!size) { return *this; }
+  // 1st pass: block mean
+  f8 s0 = 0.0, s1 = 0.0, s2 = 0.0;
+  for (u4 i = 0u; i < size; ++i)
+  {
+    const v3f& p = Strided(points, i, stride);
+    s0 += p.x;
+    s1 += p.y;
+    s2 += p.z;
+  }
+  Covar3 block;
+  f8 inv = 1.0 / static_cast<f8>(size);
+  block.count = size;
+  block.mean[0] = s0 * inv;
+  block.mean[1] = s1 * inv;
+  block.mean[2] = s2 * inv;
+  // 2nd pass: products of differences from the block mean
+  for (u4 i = 0u; i < size; ++i)
+  {
+    const v3f& p = Strided(points, i, stride);
+    f8 d0 = p.x - block.mean[0], d1 = p.y - block.mean[1];
+    f8 d2 = p.z - block.mean[2];
+    block.co[0] += d0 * d0;
+    block.co[1] += d1 * d1;
+    block.co[2] += d2 * d2;
+    block.co[3] += d0 * d1;
+    block.co[4] += d0 * d2;
+    block.co[5] += d1 * d2;
+  }
+  return Merge(block);
+
+} // end Covar3& Covar3::AddBlock(const v3f*, u4, u4)                         */
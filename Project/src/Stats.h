@@ -29,6 +29,9 @@ written consent of DigiPen Institute of Technology is prohibited.
 namespace dp
 {
   union v2f; // probable for min/max definition
+  union v3f; // Point to accumulate into covariance / mean result
+  class m3f; // Covariance matrix result
+  class m4f; // Placement of points accumulated straight from model space
 }
 
 
@@ -244,6 +247,182 @@ namespace dp
 
   };
 
+  //! Mergeable running mean & covariance of 3D points (Welford / Chan)
+  class Covar3
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Consts                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    static const u4 POINT_STRIDE = 12u; //! Bytes per tightly packed v3f
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Constructors                                */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create an accumulator of no points
+    \brief
+      - create an accumulator of no points
+    */
+    Covar3(void);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                           Static Methods                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Accumulate placed points over worker threads, merging their results
+    \brief
+      - accumulate placed points over worker threads, merging their results
+    \details
+      - each thread transforms & accumulates its own range, block by block,
+      so no placed copy of the point list is ever made
+    \param place
+      - transform of the points into the space to accumulate in
+    \param points
+      - first point (i.e. &vertices[0].pos)
+    \param size
+      - number of points
+    \param stride
+      - bytes from 1 point to the next (i.e. sizeof(Mesh::Vertex))
+    \return
+      - accumulator of all size placed points
+    */
+    static Covar3 Gather(const m4f& place, const v3f* points, u4 size,
+      u4 stride = POINT_STRIDE);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Accumulate 1 point (Welford's update)
+    \brief
+      - accumulate 1 point (Welford's update)
+    \param point
+      - point to be accounted for
+    \return
+      - reference to this accumulator for easier subsequent inline action
+    */
+    Covar3& Add(const v3f& point);
+
+
+    /** Accumulate a list of points, a block at a time
+    \brief
+      - accumulate a list of points, a block at a time
+    \param points
+      - first point
+    \param size
+      - number of points
+    \param stride
+      - bytes from 1 point to the next (i.e. sizeof(Mesh::Vertex))
+    \return
+      - reference to this accumulator for easier subsequent inline action
+    */
+    Covar3& Add(const v3f* points, u4 size, u4 stride = POINT_STRIDE);
+
+
+    /** Accumulate a list of points as placed by a transform, a block at a time
+    \brief
+      - accumulate a list of points as placed by a transform, a block at a time
+    \details
+      - blocks are transformed into a small local buffer, then accumulated: the
+      placed points are never written out as a full list
+    \param place
+      - transform of the points into the space to accumulate in
+    \param points
+      - first point (i.e. &vertices[0].pos)
+    \param size
+      - number of points
+    \param stride
+      - bytes from 1 point to the next (i.e. sizeof(Mesh::Vertex))
+    \return
+      - reference to this accumulator for easier subsequent inline action
+    */
+    Covar3& Add(const m4f& place, const v3f* points, u4 size,
+      u4 stride = POINT_STRIDE);
+
+
+    /** Get the number of points accumulated
+    \brief
+      - get the number of points accumulated
+    \return
+      - points accounted for
+    */
+    inline u4 Count(void) const
+    { return count; } // end u4 Covar3::Count(void) const                     */
+
+
+    /** Get the (population) covariance matrix of the points accumulated
+    \brief
+      - get the (population) covariance matrix of the points accumulated
+    \return
+      - symmetric covariance, as Covariance3D (identity if under 2 points)
+    */
+    m3f Matrix(void) const;
+
+
+    /** Get the mean of the points accumulated
+    \brief
+      - get the mean of the points accumulated
+    \return
+      - centroid of the points (origin if none)
+    */
+    v3f Mean(void) const;
+
+
+    /** Combine another accumulator's points into this one (Chan's update)
+    \brief
+      - combine another accumulator's points into this one (Chan's update)
+    \details
+      - points may be split between accumulators in any way (i.e. per thread)
+      and merged in any order for the same result (up to rounding)
+    \param other
+      - accumulator of other points
+    \return
+      - reference to this accumulator for easier subsequent inline action
+    */
+    Covar3& Merge(const Covar3& other);
+
+
+    /** Clear all accumulated points
+    \brief
+      - clear all accumulated points
+    \return
+      - reference to this accumulator for easier subsequent inline action
+    */
+    Covar3& Reset(void);
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                           Private Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Accumulate a block of points: 2 passes over the block, then 1 merge
+    \brief
+      - accumulate a block of points: 2 passes over the block, then 1 merge
+    \param points
+      - first point of the block
+    \param size
+      - number of points in the block
+    \param stride
+      - bytes from 1 point to the next
+    \return
+      - reference to this accumulator for easier subsequent inline action
+    */
+    Covar3& AddBlock(const v3f* points, u4 size, u4 stride);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    u4 count;   //! Points accumulated
+    f8 mean[3]; //! Running mean: <x, y, z>
+    f8 co[6];   //! Summed mean difference products: xx, yy, zz, xy, xz, yz
+
+  };
+
   /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
   /*                        Public Static Variables                           */
   /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -265,7 +444,7 @@ namespace dp
   - output value
 */
 /*inline s4 Out(s4 value)
-{ return value; } // end s4 Out(s4)                                         */
+{ return value; } // end s4 Out(s4)                                           */
 
 }
 
@@ -0,0 +1,485 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  SweepPrune.cpp
+Purpose:  Sort and sweep broadphase: overlapping pairs of many moving AABBs
+Details:  see header for the approach; pair keys pack the lower handle into
+  the high 32 bits, so keys order / compare the same as their pairs.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <algorithm>  // Full sort of endpoint lists on rebuild, table fills
+#include <chrono>     // Wall clock timing of benchmark frames
+#include <cmath>      // Cube root sizing of the benchmark region
+#include <utility>    // Moving pair table slots out to rehash them
+
+// "./src/..."
+#include "AABB.h"       // World space bounds of each object by Min() / Max()
+#include "SweepPrune.h" // Class declaration header
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+//! Pack a pair of handles into one key, lower handle in the high bits
+static inline u8 PairKey(u4 a, u4 b)
+{
+  return (a < b) ? ((static_cast<u8>(a) << 32) | b)
+                 : ((static_cast<u8>(b) << 32) | a);
+
+} // end u8 PairKey(u4, u4)                                                   */
+
+
+//! Get a pair key's first table slot to probe (Fibonacci hashing)
+static inline u4 HashPair(u8 key, u4 mask)
+{
+  return static_cast<u4>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+
+} // end u4 HashPair(u8, u4)                                                  */
+
+
+//! Check if endpoint e sorts before f (touching mins sort before maxes)
+template <typename Endpoint>
+static inline bool Before(const Endpoint& e, const Endpoint& f)
+{
+  return e.value < f.value
+    || (e.value == f.value && !(e.id & 1u) && (f.id & 1u));
+
+} // end bool Before(const Endpoint&, const Endpoint&)                        */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::SweepPrune::SweepPrune(Axes sweep, u4 capacity)
+  : added(0u), live(0u), axes(sweep)
+{
+  proxy.reserve(capacity);
+  for (u1 k = 0; k < (axes == Axes::XYZ ? 3u : 1u); ++k)
+  {
+    list[k].reserve(2u * capacity);
+  }
+
+} // end SweepPrune::SweepPrune(Axes, u4)                                     */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+u4 dp::SweepPrune::Add(const AABB& box)
+{
+  u4 handle = static_cast<u4>(proxy.size());
+  if (freed.empty()) { proxy.push_back(Proxy{ nullv3f, nullv3f, true }); }
+  else
+  {
+    handle = freed.back();
+    freed.pop_back();
+    proxy[handle].alive = true;
+  }
+  Move(handle, box.Min(), box.Max()); // Ordered extrema, even if inverted
+
+  // Appended past every other endpoint: the list order starts it overlapping
+  // nothing, consistent with the pair set, and sorting swaps it into place
+  for (u1 k = 0; k < (axes == Axes::XYZ ? 3u : 1u); ++k)
+  {
+    list[k].push_back(Endpoint{ 0.0f, handle << 1 });
+    list[k].push_back(Endpoint{ 0.0f, (handle << 1) | 1u });
+  }
+  ++added;
+  ++live;
+  return handle;
+
+} // end u4 SweepPrune::Add(const AABB&)                                      */
+
+
+bool dp::SweepPrune::IsIn(u4 a, u4 b) const
+{
+  u4 s = pairs.Find(PairKey(a, b));
+  return s != u4_INVALID && pairs.in[s];
+
+} // end bool SweepPrune::IsIn(u4, u4) const                                  */
+
+
+dp::SweepPrune& dp::SweepPrune::Move(u4 handle, const AABB& box)
+{
+  return Move(handle, box.Min(), box.Max());
+
+} // end SweepPrune& SweepPrune::Move(u4, const AABB&)                        */
+
+
+dp::SweepPrune& dp::SweepPrune::Move(u4 handle, const v3f& min, const v3f& max)
+{
+  if (proxy.size() <= handle || !proxy[handle].alive) { return *this; }
+
+  // An inverted box would close before it opens in a sweep: order each axis
+  proxy[handle].min.Set(MinF(min.x, max.x), MinF(min.y, max.y),
+    MinF(min.z, max.z));
+  proxy[handle].max.Set(MaxF(min.x, max.x), MaxF(min.y, max.y),
+    MaxF(min.z, max.z));
+  return *this;
+
+} // end SweepPrune& SweepPrune::Move(u4, const v3f&, const v3f&)             */
+
+
+std::vector<dp::SweepPrune::Pair> dp::SweepPrune::Pairs(void) const
+{
+  std::vector<Pair> result;
+  result.reserve(pairs.count);
+  for (u4 s = 0; s < pairs.Slots(); ++s)
+  {
+    u8 key = pairs.key[s];
+    if (key && pairs.in[s])
+    {
+      result.push_back(Pair{ static_cast<u4>(key >> 32),
+        static_cast<u4>(key) });
+    }
+  }
+  return result;
+
+} // end vector<Pair> SweepPrune::Pairs(void) const                           */
+
+
+dp::SweepPrune& dp::SweepPrune::Remove(u4 handle)
+{
+  if (proxy.size() <= handle || !proxy[handle].alive) { return *this; }
+
+  // Endpoints & pairs are dropped by the next update, in 1 pass for all
+  // proxies removed since (rather than a pass over every pair per removal)
+  proxy[handle].alive = false;
+  removed.push_back(handle);
+  --live;
+  return *this;
+
+} // end SweepPrune& SweepPrune::Remove(u4)                                   */
+
+
+dp::SweepPrune& dp::SweepPrune::Update(void)
+{
+  u1 lists = (axes == Axes::XYZ) ? 3u : 1u;
+  events.clear();
+
+  // Drop endpoints & pairs of removed proxies, then free their handles
+  if (!removed.empty())
+  {
+    for (u1 k = 0; k < lists; ++k)
+    {
+      list[k].erase(std::remove_if(list[k].begin(), list[k].end(),
+        [this](const Endpoint& e) { return !proxy[e.id >> 1].alive; }),
+        list[k].end());
+    }
+    for (u4 s = 0; s < pairs.Slots();)
+    {
+      u8 key = pairs.key[s];
+      if (!key || (proxy[static_cast<u4>(key >> 32)].alive
+        && proxy[static_cast<u4>(key)].alive)) { ++s; continue; }
+      Touch(key, pairs.in[s] != 0u);
+      pairs.Erase(s); // A later key may move into s: check s again
+    }
+    freed.insert(freed.end(), removed.begin(), removed.end());
+    removed.clear();
+  }
+
+  // Refresh endpoint values from (possibly moved) proxy bounds
+  for (u1 k = 0; k < lists; ++k)
+  {
+    s1 axis = static_cast<s1>(axes == Axes::XYZ ? k : static_cast<u1>(axes));
+    for (Endpoint& e : list[k])
+    {
+      const Proxy& p = proxy[e.id >> 1];
+      e.value = (e.id & 1u) ? p.max[axis] : p.min[axis];
+    }
+  }
+
+  // Each new proxy costs an insertion pass over the whole list: past a few,
+  // a full sort is cheaper than walking each one into place
+  bool rebuild = 16u * added > live;
+  for (u1 k = 0; k < lists; ++k)
+  {
+    if (!rebuild) { Sort(list[k], axes == Axes::XYZ); }
+    else { std::sort(list[k].begin(), list[k].end(), Before<Endpoint>); }
+  }
+  if (rebuild || axes != Axes::XYZ) { Sweep(); }
+  added = 0u;
+
+  // Report only pairs whose end state differs from the prior update's
+  for (u4 t = 0; t < touched.Slots(); ++t)
+  {
+    u8 key = touched.key[t];
+    if (!key) { continue; }
+    u4 s = pairs.Find(key);
+    bool now = s != u4_INVALID && pairs.in[s];
+    if (now != (touched.in[t] != 0u))
+    {
+      events.push_back(Event{ Pair{ static_cast<u4>(key >> 32),
+        static_cast<u4>(key) }, now });
+    }
+  }
+  touched.Clear();
+  return *this;
+
+} // end SweepPrune& SweepPrune::Update(void)                                 */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+void dp::SweepPrune::Begin(u4 a, u4 b)
+{
+  // A pair only starts overlapping through a swap on some axis, so testing
+  // the full boxes here catches every start exactly (box test first: most
+  // swaps are of pairs still apart on another axis, saving a table probe)
+  if (!Overlap(a, b)) { return; }
+  u8 key = PairKey(a, b);
+  if (pairs.Insert(key, true)) { Touch(key, false); }
+
+} // end void SweepPrune::Begin(u4, u4)                                       */
+
+
+void dp::SweepPrune::End(u4 a, u4 b)
+{
+  u4 s = pairs.Find(PairKey(a, b));
+  if (s == u4_INVALID) { return; }
+
+  Touch(pairs.key[s], pairs.in[s] != 0u);
+  pairs.Erase(s);
+
+} // end void SweepPrune::End(u4, u4)                                         */
+
+
+bool dp::SweepPrune::Overlap(u4 a, u4 b) const
+{
+  const Proxy& p = proxy[a];
+  const Proxy& q = proxy[b];
+  return p.min.x <= q.max.x && q.min.x <= p.max.x
+    && p.min.y <= q.max.y && q.min.y <= p.max.y
+    && p.min.z <= q.max.z && q.min.z <= p.max.z;
+
+} // end bool SweepPrune::Overlap(u4, u4) const                               */
+
+
+void dp::SweepPrune::PairTable::Clear(void)
+{
+  std::fill(key.begin(), key.end(), 0ull);
+  count = 0u;
+
+} // end void SweepPrune::PairTable::Clear(void)                              */
+
+
+void dp::SweepPrune::PairTable::Erase(u4 slot)
+{
+  // Backward shift (no tombstones): each later key of the probe run moves
+  // into the hole, unless its home slot lies after the hole (cyclically)
+  u4 hole = slot;
+  for (u4 s = (slot + 1u) & mask; key[s]; s = (s + 1u) & mask)
+  {
+    u4 home = HashPair(key[s], mask);
+    if (((s - hole) & mask) <= ((s - home) & mask))
+    {
+      key[hole] = key[s];
+      in[hole] = in[s];
+      hole = s;
+    }
+  }
+  key[hole] = 0ull;
+  --count;
+
+} // end void SweepPrune::PairTable::Erase(u4)                                */
+
+
+u4 dp::SweepPrune::PairTable::Find(u8 pair) const
+{
+  if (key.empty()) { return u4_INVALID; }
+  for (u4 s = HashPair(pair, mask);; s = (s + 1u) & mask)
+  {
+    if (key[s] == pair) { return s; }
+    if (!key[s]) { return u4_INVALID; }
+  }
+
+} // end u4 SweepPrune::PairTable::Find(u8) const                             */
+
+
+bool dp::SweepPrune::PairTable::Insert(u8 pair, bool overlap, u4* slot)
+{
+  // Keep at least twice the slots of keys (a power of 2, for masking), so
+  // probe runs stay short; growing rehashes into a table twice the size
+  if (key.size() < 2u * (count + 1u))
+  {
+    std::vector<u8> oldKey(std::move(key));
+    std::vector<u1> oldIn(std::move(in));
+    u4 slots = oldKey.empty() ? 64u : 2u * static_cast<u4>(oldKey.size());
+    key.assign(slots, 0ull);
+    in.assign(slots, 0u);
+    mask = slots - 1u;
+    count = 0u;
+    for (u4 s = 0; s < oldKey.size(); ++s)
+    {
+      if (oldKey[s]) { Insert(oldKey[s], oldIn[s] != 0u); }
+    }
+  }
+
+  u4 s = HashPair(pair, mask);
+  for (; key[s]; s = (s + 1u) & mask)
+  {
+    if (key[s] == pair) { if (slot) { *slot = s; } return false; }
+  }
+  key[s] = pair;
+  in[s] = overlap ? 1u : 0u;
+  ++count;
+  if (slot) { *slot = s; }
+  return true;
+
+} // end bool SweepPrune::PairTable::Insert(u8, bool, u4*)                    */
+
+
+void dp::SweepPrune::Sort(std::vector<Endpoint>& endpoints, bool swaps)
+{
+  size_t count = endpoints.size();
+  for (size_t i = 1; i < count; ++i)
+  {
+    Endpoint e = endpoints[i];
+    size_t j = i;
+
+    // Walk e left past every greater endpoint: a min passing a max starts
+    // that pair overlapping on this axis; a max passing a min ends it
+    while (0 < j && Before(e, endpoints[j - 1]))
+    {
+      const Endpoint& f = endpoints[j - 1];
+      if (swaps && ((e.id ^ f.id) & 1u))
+      {
+        if (e.id & 1u) { End(e.id >> 1, f.id >> 1); }
+        else { Begin(e.id >> 1, f.id >> 1); }
+      }
+      endpoints[j] = f;
+      --j;
+    }
+    endpoints[j] = e;
+  }
+
+} // end void SweepPrune::Sort(vector<Endpoint>&, bool)                       */
+
+
+void dp::SweepPrune::Sweep(void)
+{
+  std::fill(pairs.in.begin(), pairs.in.end(), 0u); // Unseen until swept
+
+  // Pair each min with every box still open on the first list's axis: the
+  // open boxes are kept in step in SoA lanes, to be tested 4 / 8 at a time
+  open.clear();
+  openBox.Clear();
+  slot.resize(proxy.size());
+  for (const Endpoint& e : list[0])
+  {
+    u4 handle = e.id >> 1;
+    if (e.id & 1u) // Close: swap the last open proxy into its place
+    {
+      u4 last = open.back();
+      open[slot[handle]] = last;
+      openBox.Remove(slot[handle]); // Moves the last box over alike
+      slot[last] = slot[handle];
+      open.pop_back();
+      continue;
+    }
+    AABBCompact box(proxy[handle].min, proxy[handle].max);
+    openBox.Overlaps(box, found);
+    for (u4 i : found)
+    {
+      u4 other = open[i];
+      u8 key = PairKey(handle, other);
+      u4 s;
+      if (pairs.Insert(key, true, &s)) { Touch(key, false); }
+      else { pairs.in[s] = 1u; }
+    }
+    slot[handle] = static_cast<u4>(open.size());
+    open.push_back(handle);
+    openBox.Add(box);
+  }
+
+  // Pairs not seen in the sweep no longer overlap
+  for (u4 s = 0; s < pairs.Slots();)
+  {
+    if (!pairs.key[s] || pairs.in[s]) { ++s; continue; }
+    Touch(pairs.key[s], true);
+    pairs.Erase(s); // A later key may move into s: check s again
+  }
+
+} // end void SweepPrune::Sweep(void)                                         */
+
+
+void dp::SweepPrune::Touch(u8 key, bool wasIn)
+{
+  touched.Insert(key, wasIn); // Keeps the first (pre-update) state noted
+
+} // end void SweepPrune::Touch(u8, bool)                                     */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Helper Functions                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+f8 dp::SweepPruneBenchmark(u4 objects, u4 frames, SweepPrune::Axes axes,
+  f8* pairs)
+{
+  // Fixed seed linear congruential generator: repeatable runs to compare
+  u4 seed = 0x2545F491u;
+  auto random = [&seed](void)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    return static_cast<f4>(seed >> 8) * (1.0f / 16777216.0f);
+  };
+
+  // Unit boxes in a cube of 8 cubic units per box: a few neighbours apiece
+  const f4 side = std::cbrt(8.0f * static_cast<f4>(objects));
+  const v3f half(AHALF, AHALF, AHALF);
+  std::vector<v3f> pos(objects);
+  std::vector<v3f> vel(objects);
+  SweepPrune sap(axes, objects);
+  for (u4 i = 0; i < objects; ++i)
+  {
+    pos[i] = v3f(random(), random(), random()) * side;
+    vel[i] = v3f(random() - AHALF, random() - AHALF, random() - AHALF) * 0.1f;
+    sap.Add(AABB(pos[i] - half, pos[i] + half));
+  }
+  sap.Update();
+
+  s8 count = static_cast<s8>(sap.Pairs().size());
+  f8 pairSum = 0.0;
+  auto start = std::chrono::steady_clock::now();
+  for (u4 f = 0; f < frames; ++f)
+  {
+    for (u4 i = 0; i < objects; ++i)
+    {
+      pos[i] += vel[i];
+      for (s1 k = 0; k < 3; ++k)
+      {
+        if (pos[i][k] < 0.0f || side < pos[i][k]) { vel[i][k] = -vel[i][k]; }
+      }
+      sap.Move(i, pos[i] - half, pos[i] + half);
+    }
+    sap.Update();
+    for (const SweepPrune::Event& e : sap.Events())
+    {
+      count += e.added ? 1 : -1;
+    }
+    pairSum += static_cast<f8>(count);
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  if (pairs) { *pairs = frames ? pairSum / frames : static_cast<f8>(count); }
+  if (!frames) { return 0.0; }
+  return std::chrono::duration<f8, std::milli>(end - start).count() / frames;
+
+} // end f8 SweepPruneBenchmark(u4, u4, SweepPrune::Axes, f8*)                */
@@ -0,0 +1,366 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  SweepPrune.h
+Purpose:  Sort and sweep broadphase: overlapping pairs of many moving AABBs
+Details:  every box is kept as its [Min(), Max()] endpoints in a sorted list
+  per swept axis.  Objects move little from frame to frame, so the lists are
+  re-sorted by insertion sort, which is near linear on almost sorted data,
+  and only pairs overlapping on a sorted axis are ever box tested, never all
+  N^2 of them; each swap of a min past a max (or the reverse) is exactly
+  where a pair starts (or stops) overlapping on that axis.
+
+  Sweeping a single axis sorts just the one list, then sweeps it each update,
+  box testing only pairs overlapping on that axis: cheapest when objects
+  spread out along it.  Sweeping all 3 axes sorts 3 lists but never sweeps:
+  a pair can only start overlapping through a swap on some axis, so swaps
+  alone keep the pair set exact, which pays off as objects crowd any one
+  axis (as in a uniform cube of them).  Either way, the pairs that began or
+  ended overlapping since the prior update are listed as add / remove events.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <vector>  // Proxy / endpoint / event list & pair table members
+
+// "./src/..."
+#include "AABBCompact.h" // SoA lanes of the boxes open in a sweep
+#include "v3f.h"         // Box extrema members, read from AABB::Min() / Max()
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class AABB; // World space bounds of each object, as sorted by its extrema
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! Sort and sweep broadphase: persistent overlapping pairs of moving AABBs
+  class SweepPrune
+  {
+  public:
+
+    //! Axes to keep sorted endpoint lists of
+    enum class Axes : u1
+    {
+      X,    //! Sort & sweep x only; box test each pair overlapping on x
+      Y,    //! Sort & sweep y only; box test each pair overlapping on y
+      Z,    //! Sort & sweep z only; box test each pair overlapping on z
+      XYZ   //! Sort all 3; pair set kept by swaps alone (multi-axis variant)
+    };
+
+    //! Two proxy handles (lower first) whose boxes overlap
+    struct Pair
+    {
+      u4 a; //! Lower proxy handle of the pair
+      u4 b; //! Higher proxy handle of the pair
+    };
+
+    //! Change to the overlapping pair set made over the last Update()
+    struct Event
+    {
+      Pair pair;  //! Proxies which began / ended overlapping
+      bool added; //! True if the pair began overlapping, false if it ended
+    };
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create an empty broadphase, sweeping the given axes
+    \brief
+      - create an empty broadphase, sweeping the given axes
+    \param axes
+      - single axis to sweep (best along the widest spread of objects), or all
+    \param capacity
+      - expected proxy count, to reserve list storage for up front
+    */
+    SweepPrune(Axes axes = Axes::X, u4 capacity = 0u);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Add a box to the broadphase, to be sorted in by the next Update()
+    \brief
+      - add a box to the broadphase, to be sorted in by the next Update()
+    \param box
+      - world space bounds of the new object
+    \return
+      - handle of the new proxy, naming it in pairs / Move() / Remove()
+    */
+    u4 Add(const AABB& box);
+
+
+    /** Get the axes swept by this broadphase
+    \brief
+      - get the axes swept by this broadphase
+    \return
+      - single swept axis, or all 3
+    */
+    inline Axes Axis(void) const
+    { return axes; } // end Axes SweepPrune::Axis(void) const                 */
+
+
+    /** Get the count of live proxies in the broadphase
+    \brief
+      - get the count of live proxies in the broadphase
+    \return
+      - number of boxes added and not yet removed
+    */
+    inline u4 Count(void) const
+    { return live; } // end u4 SweepPrune::Count(void) const                  */
+
+
+    /** Get the pair set changes made by the last Update()
+    \brief
+      - get the pair set changes made by the last Update()
+    \details
+      - a pair both added and removed between updates has no event; pairs of
+      a removed proxy are reported as removed events
+    \return
+      - list of pairs which began / ended overlapping since the prior update
+    */
+    inline const std::vector<Event>& Events(void) const
+    { return events; } // end const vector<Event>& SweepPrune::Events() const */
+
+
+    /** Check if 2 proxies' boxes were overlapping as of the last Update()
+    \brief
+      - check if 2 proxies' boxes were overlapping as of the last Update()
+    \param a
+      - handle of either proxy of the pair
+    \param b
+      - handle of the other proxy of the pair
+    \return
+      - true if the pair is in the overlapping pair set
+    */
+    bool IsIn(u4 a, u4 b) const;
+
+
+    /** Set the bounds of a proxy, to be sorted into place by the next Update()
+    \brief
+      - set the bounds of a proxy, to be sorted into place by the next Update()
+    \param handle
+      - proxy to be moved, as returned by Add()
+    \param box
+      - new world space bounds of the object (ignored if the handle is not
+      live)
+    \return
+      - reference to the broadphase for easier subsequent inline action
+    */
+    SweepPrune& Move(u4 handle, const AABB& box);
+
+
+    /** Set the extrema of a proxy, to be sorted into place by the next Update()
+    \brief
+      - set the extrema of a proxy, to be sorted into place by the next Update()
+    \details
+      - for callers already holding raw extrema, saving an AABB construction;
+      extrema given inverted on any axis are swapped, and a handle not live
+      (never added, or removed) is ignored
+    \param handle
+      - proxy to be moved, as returned by Add()
+    \param min
+      - new lowest corner of the object's world space bounds
+    \param max
+      - new highest corner of the object's world space bounds
+    \return
+      - reference to the broadphase for easier subsequent inline action
+    */
+    SweepPrune& Move(u4 handle, const v3f& min, const v3f& max);
+
+
+    /** Get the list of all overlapping pairs as of the last Update()
+    \brief
+      - get the list of all overlapping pairs as of the last Update()
+    \return
+      - every pair (lower handle first) whose boxes overlap
+    */
+    std::vector<Pair> Pairs(void) const;
+
+
+    /** Remove a proxy, reporting its pairs as removed by the next Update()
+    \brief
+      - remove a proxy, reporting its pairs as removed by the next Update()
+    \details
+      - the handle is not reused until after the next Update(), which drops
+      its pairs (until then, IsIn() / Pairs() still list them)
+    \param handle
+      - proxy to be removed, as returned by Add()
+    \return
+      - reference to the broadphase for easier subsequent inline action
+    */
+    SweepPrune& Remove(u4 handle);
+
+
+    /** Re-sort moved / added / removed proxies and update the pair set
+    \brief
+      - re-sort moved / added / removed proxies and update the pair set
+    \details
+      - insertion sort for small frame to frame motion; a large batch of new
+      proxies (such as the first update) is sorted and swept from scratch
+    \return
+      - reference to the broadphase for easier subsequent inline action
+    */
+    SweepPrune& Update(void);
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                           Private Classes                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Box bounds of one object, by handle
+    struct Proxy
+    {
+      v3f min;    //! Lowest corner of the box
+      v3f max;    //! Highest corner of the box
+      bool alive; //! False once removed, until its handle is reused
+    };
+
+    //! One box extremum on a swept axis: 8 bytes, for cache friendly sorting
+    struct Endpoint
+    {
+      f4 value; //! Axis coordinate of the extremum
+      u4 id;    //! Proxy handle << 1, | 1 for a max (0 for a min)
+    };
+
+    //! Open addressing (linear probing) table of packed pair keys, each with
+    //! an overlap flag: swaps insert & erase pairs without allocating
+    struct PairTable
+    {
+      std::vector<u8> key; //! Packed pair key of each slot (0 if empty)
+      std::vector<u1> in;  //! Overlap flag of each slot's pair
+      u4 mask;             //! Slot count (power of 2) less 1: subscript mask
+      u4 count;            //! Occupied slot count
+
+      //! Create a table with no slots (the first insert allocates them)
+      inline PairTable(void) : mask(0u), count(0u) { }
+
+      //! Empty every slot, keeping the slot count
+      void Clear(void);
+
+      //! Empty a slot, pulling later keys of its probe run back into place
+      //! (so a forward scan erasing as it goes must recheck the same slot)
+      void Erase(u4 slot);
+
+      //! Get a key's slot, or u4_INVALID if it is not in the table
+      u4 Find(u8 pair) const;
+
+      //! Add a key with its flag, if new (else keep its flag); its slot is
+      //! set if asked for.  Returns true if the key was added
+      bool Insert(u8 pair, bool overlap, u4* slot = nullptr);
+
+      //! Get the slot count, to scan every slot
+      inline u4 Slots(void) const { return static_cast<u4>(key.size()); }
+    };
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                           Private Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Record a pair begun overlapping on a swept axis (all 3 swept)
+    void Begin(u4 a, u4 b);
+
+    //! Record a pair ended overlapping on a swept axis (all 3 swept)
+    void End(u4 a, u4 b);
+
+    //! Check if 2 proxies' boxes overlap on all 3 axes
+    bool Overlap(u4 a, u4 b) const;
+
+    //! Insertion sort one swept list, recording pairs swapped in / out
+    void Sort(std::vector<Endpoint>& list, bool swaps);
+
+    //! Sweep the first sorted list for the overlapping pair set, from scratch
+    void Sweep(void);
+
+    //! Note a pair's overlap state before its first change since last update
+    void Touch(u8 key, bool wasIn);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Bounds of every object, by handle (removed ones marked not alive)
+    std::vector<Proxy> proxy;
+
+    //! Sorted endpoints of every proxy, per swept axis
+    std::vector<Endpoint> list[3];
+
+    //! Overlapping pairs by packed handles (false only mid-sweep: unseen yet)
+    PairTable pairs;
+
+    //! Overlap state of each pair changed since the last update, before then
+    PairTable touched;
+
+    //! Pair set changes made by the last update
+    std::vector<Event> events;
+
+    //! Handles removed since the last update, to be reused after it
+    std::vector<u4> removed;
+
+    //! Handles free to be reused by Add()
+    std::vector<u4> freed;
+
+    //! Proxies open in a sweep, and each open proxy's place in that list
+    std::vector<u4> open, slot;
+
+    //! Bounds of each proxy open in a sweep, in the same order
+    AABBSoA openBox;
+
+    //! Open proxies' places in that list overlapping the box being opened
+    std::vector<u4> found;
+
+    //! Proxies added since the last update, to choose sort vs. rebuild
+    u4 added;
+
+    //! Live proxy count
+    u4 live;
+
+    //! Axes swept (one sorted list, or all 3)
+    Axes axes;
+
+  }; // end SweepPrune class declaration
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                      Helper Function Declarations                        */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  /** Get average milliseconds per frame of moving and updating a broadphase
+  \brief
+    - get average milliseconds per frame of moving and updating a broadphase
+  \details
+    - boxes of unit size drift about a cube sized to keep a few neighbours
+    per box, bouncing off its walls; the first (from scratch) update is not
+    part of the timing
+  \param objects
+    - count of boxes to add
+  \param frames
+    - count of timed move & update frames
+  \param axes
+    - axes for the broadphase to sweep
+  \param pairs
+    - average overlapping pair count per frame, to be set if given
+  \return
+    - average wall clock milliseconds spent per frame moving & updating
+  */
+  f8 SweepPruneBenchmark(u4 objects = 10000u, u4 frames = 100u,
+    SweepPrune::Axes axes = SweepPrune::Axes::X, f8* pairs = nullptr);
+
+} // end dp namespace
@@ -16,13 +16,9 @@ written consent of DigiPen Institute of Technology is prohibited.
 /*                                  Includes                                  */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
-// stl
-#include <cmath>
 // "./src/..."
-#include "m3f.h"        // Homogeneous affine transform linear m3f extractions
 #include "Log.h"        // Output error / warning message / logging
 #include "Transform.h"  // Associated class declaration header
-#include "v2f.h"        // Euler angle planar intersections
 
 
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -33,9 +29,12 @@ written consent of DigiPen Institute of Technology is prohibited.
 dp::Transform::Transform(const v3f& position, const v3f& dimensions,
   const v3f& anchor, const v3f& orientationRads)
   : translation(position), scale(dimensions), offset(anchor),
-  orientRad(orientationRads), dirty(true), dirtyPos(true),
-  dirtyRot(true), dirtyLocals(true), dirtyAnchor(true), dirtyScale(true)
-{ } // end Transform(const v43&, const v3f&, const v3f&, const v3f&)
+  orient(ang(orientationRads.z, arc::rad), ang(orientationRads.y, arc::rad),
+    ang(orientationRads.x, arc::rad)), dirty(true), dirtyPos(true),
+  dirtyRot(true), dirtyAnchor(true), dirtyScale(true)
+{
+  RecalculateBasis();
+} // end Transform(const v43&, const v3f&, const v3f&, const v3f&)
 
 
 // Create a Transform from v3f / ang descriptors for 2.5D placement data      */
@@ -160,24 +159,17 @@ const dp::m4f& dp::Transform::NormalMatrix(void)
 
 
 // Get euler angles of cartesian rotation per local axis                      */
-const dp::v3f& dp::Transform::Orientation(void) const
+dp::v3f dp::Transform::Orientation(void) const
 {
-  return orientRad;
-} // end const v3f& Orientation(void) const
+  return orient.Eulers();
+} // end v3f Orientation(void) const
 
 
 // Set euler angle of cartesian rotation per local axis in <z, y, x> order    */
 dp::Transform& dp::Transform::Orientation(const ang& z_rot,
   const ang& y_rot, const ang& x_rot)
 {
-  if (orientRad != v3f(x_rot.r(), y_rot.r(), z_rot.r()))
-  {
-    orientRad.X(x_rot.r()).Y(y_rot.r()).Z(z_rot.r());
-    dirtyLocals = true;
-    dirtyRot = true;
-    dirty = true;
-  }
-  return *this;
+  return Rotation(q4f(z_rot, y_rot, x_rot));
 } // end Transform& Orientation(const ang&, const ang&, const ang&)
 
 
@@ -195,51 +187,15 @@ dp::Transform& dp::Transform::Pan(f4 rightDistance)
 // Rotate the local orientation along the vertical axis (+up / -down)         */
 dp::Transform& dp::Transform::Pitch(ang pitchChange, bool relative)
 {
-  ang newPitch = ang(orientRad.X(), arc::rad);
-  m4f pitch;
-  bool changed = false;
-
-  // Setup value changes per mode
   if (relative)
   {
-    if (pitchChange != nullang)
-    {
-      newPitch += pitchChange;
-      orientRad.X(newPitch.r());
-      pitch = RotateRodriguesAffine(pitchChange, localX);
-      localY = (pitch * localY.XYZW(Of)).XYZ();
-      localZ = (pitch * localZ.XYZW(Of)).XYZ();
-      dirtyRot = true;
-      dirty = true;
-    }
+    if (pitchChange != nullang) { Turn(q4f(pitchChange, X_HAT)); }
+    return *this;
   }
-  else
-  {
-    if (pitchChange.radRef() != orientRad.X())
-    {
-      newPitch = pitchChange - newPitch;
-      orientRad.X(pitchChange.r());
-      pitch = RotateRodriguesAffine(newPitch, localX);
-      localY = (pitch * localY.XYZW(Of)).XYZ();
-      localZ = (pitch * localZ.XYZW(Of)).XYZ();
-      dirtyRot = true;
-      dirty = true;
-    }
-  }
-
-  // Perpetuate mode adapted value changes
-  if (changed)
-  {
-    // Update local unit vectors
-    localY = (pitch * localY.XYZW(Of)).XYZ();
-    localZ = (pitch * localZ.XYZW(Of)).XYZ();
-    RecalculateEulers();
-
-    // Update state change flags
-    dirtyRot = true;
-    dirty = true;
-  }
-  return *this;
+  v3f eulers = orient.Eulers();
+  if (pitchChange.radRef() == eulers.x) { return *this; }
+  return Orientation(ang(eulers.z, arc::rad), ang(eulers.y, arc::rad),
+    pitchChange);
 
 } // end Transform& Transform::Pitch(ang, bool)
 
@@ -271,54 +227,46 @@ dp::Transform& dp::Transform::Position(const v3f& coords,
 // Rotate the local orientation about the view normal (+clockwise / -ccw)     */
 dp::Transform& dp::Transform::Roll(ang rollChange, bool relative)
 {
-  ang newRoll = ang(orientRad.Z(), arc::rad);
-  m4f roll;
-  bool changed = false;
-
-  // Setup value changes per mode
   if (relative)
   {
-    if (rollChange != nullang)
-    {
-      newRoll += rollChange;
-      orientRad.Z(newRoll.r());
-      roll = RotateRodriguesAffine(rollChange, localZ);
-      changed = true;
-    }
-  }
-  else
-  {
-    if (rollChange.radRef() != orientRad.Z())
-    {
-      newRoll = rollChange - newRoll;
-      orientRad.Z(rollChange.r());
-      roll = RotateRodriguesAffine(newRoll, localZ);
-      changed = true;
-    }
+    if (rollChange != nullang) { Turn(q4f(rollChange, Z_HAT)); }
+    return *this;
   }
+  v3f eulers = orient.Eulers();
+  if (rollChange.radRef() == eulers.z) { return *this; }
+  return Orientation(rollChange, ang(eulers.y, arc::rad),
+    ang(eulers.x, arc::rad));
+
+} // end Transform& Transform::Roll(ang, bool)
 
-  // Perpetuate mode adapted value changes
-  if (changed)
-  {
-    // Update local unit vectors
-    localX = (roll * localX.XYZW(Of)).XYZ();
-    localY = (roll * localY.XYZW(Of)).XYZ();
-    RecalculateEulers();
 
-    // Update state change flags
+// Get the orientation as a unit quaternion (ie for interpolation)            */
+const dp::q4f& dp::Transform::Rotation(void) const
+{
+  return orient;
+} // end const q4f& Rotation(void) const
+
+
+// Set the orientation from a quaternion (ie a Slerp / Nlerp result)          */
+dp::Transform& dp::Transform::Rotation(const q4f& orientation)
+{
+  q4f unit = q4f(orientation).Normalize();
+  if (unit != orient)
+  {
+    orient = unit;
+    RecalculateBasis();
     dirtyRot = true;
     dirty = true;
   }
   return *this;
-
-} // end Transform& Transform::Roll(ang, bool)
+} // end Transform& Rotation(const q4f&)
 
 
 // Get 2D rotation of the object, presuming no other axial rotation values    */
-const f4& dp::Transform::RotateZRad(void) const
+f4 dp::Transform::RotateZRad(void) const
 {
-  return orientRad.z;
-} // end const f4& RotateZRad(void) const
+  return orient.Eulers().z;
+} // end f4 RotateZRad(void) const
 
 
 // Get the size (unitless) of object to be displayed, per local axis          */
@@ -356,44 +304,15 @@ dp::Transform& dp::Transform::Tilt(f4 upwardDistance)
 // Rotate the local orientation along the horizontal axis (+right / -left)    */
 dp::Transform& dp::Transform::Yaw(ang yawChange, bool relative)
 {
-  ang newYaw = ang(orientRad.Y(), arc::rad);
-  m4f yaw;
-  bool changed = false;
-
-  // Setup value changes per mode
   if (relative)
   {
-    if (yawChange != nullang)
-    {
-      newYaw += yawChange;
-      orientRad.Y(newYaw.r());
-      yaw = RotateRodriguesAffine(yawChange, localY);
-      changed = true;
-    }
-  }
-  else
-  {
-    if (yawChange.radRef() != orientRad.Y())
-    {
-      newYaw = yawChange - newYaw;
-      yaw = RotateRodriguesAffine(newYaw, localY);
-      changed = true;
-    }
-  }
-
-  // Perpetuate mode adapted value changes
-  if (changed)
-  {
-    // Update local unit vectors
-    localX = (yaw * localX.XYZW(Of)).XYZ();
-    localZ = (yaw * localZ.XYZW(Of)).XYZ();
-    RecalculateEulers();
-
-    // Update state change flags
-    dirtyRot = true;
-    dirty = true;
+    if (yawChange != nullang) { Turn(q4f(yawChange, Y_HAT)); }
+    return *this;
   }
-  return *this;
+  v3f eulers = orient.Eulers();
+  if (yawChange.radRef() == eulers.y) { return *this; }
+  return Orientation(ang(eulers.z, arc::rad), yawChange,
+    ang(eulers.x, arc::rad));
 
 } // end Transform& Transform::Yaw(ang, bool)
 
@@ -405,70 +324,11 @@ dp::Transform& dp::Transform::Yaw(ang yawChange, bool relative)
 // Set internal local axis unit vectors to reflect changes in orientation     */
 void dp::Transform::RecalculateBasis(void)
 {
-  localX = X_HAT;
-  localY = Y_HAT;
-  localZ = Z_HAT;
-  m4f roll = RotateRodriguesAffine(ang(orientRad.z, arc::rad), localZ);
-  localX = (roll * localX.XYZW(Of)).XYZ();
-  localY = (roll * localY.XYZW(Of)).XYZ();
-  m4f yaw = RotateRodriguesAffine(ang(orientRad.y, arc::rad), localY);
-  localX = (yaw * localX.XYZW(Of)).XYZ();
-  localZ = (yaw * localZ.XYZW(Of)).XYZ();
-  m4f pitch = RotateRodriguesAffine(ang(orientRad.x, arc::rad), localX);
-  localY = (pitch * localY.XYZW(Of)).XYZ();
-  localZ = (pitch * localZ.XYZW(Of)).XYZ();
+  orient.Basis(localX, localY, localZ);
 
 } // end void Transform::RecalculateBasis(void)
 
 
-
-// Update euler orientation values to be reflective of local basis vectors    */
-void dp::Transform::RecalculateEulers(void)
-{
-  // TODO: only works over theta (y), when in [0,pi]...? not [-pi,pi]...?
-  /* at least according to docs, but by that logic the separating case should
-  jump out for one versus the other being in use as to when a transition into
-  recalculation from these values occurs: if it's from values calculated in
-  one branch, a jump in orientation will generally occur when switching into
-  using those values, while the other branch definitely will not (whichever is
-  correct). This does not appear to be strongly corellated in the present
-  results, and jumps occur from values calculated from either branch...
-  as such, theta values > 0 don't appear to be the delineation of errors in
-  boundaries of mapping accuracy.
-  */
-  
-  f4 sy = SqrtF(localX.x * localX.x + localX.y * localX.y);
-
-  bool singular = sy < 1e-6;
-  
-  if (!singular)
-  {
-    f4 yVal = atan2(-localX.z, sy);
-    if (yVal > 0)
-    {
-      //Log::N("Y");
-      orientRad.x = atan2(localZ.y, localZ.z);
-      orientRad.y = yVal;
-      orientRad.z = atan2(localX.y, localX.x);
-    }
-    else
-    {
-      //Log::N("N");
-      orientRad.x = atan2(localZ.x, localZ.y);
-      orientRad.y = acos(localZ.z);
-      orientRad.z = atan2(localZ.x, localZ.y);
-    }
-  }
-  else
-  {
-    orientRad.x = atan2(-localZ.y, localY.y);
-    orientRad.y = atan2(-localX.z, sy);
-    orientRad.z = 0;
-  }
-
-} // end void Transform::RecalculateEulers(void)
-
-
 // Set internal concat m4f to represent current summary transformations      */
 void dp::Transform::RecalculateMatrix(void)
 {
@@ -484,16 +344,9 @@ void dp::Transform::RecalculateMatrix(void)
     anchorMat = TranslateAffine(pivot);
     dirtyAnchor = false;
   }
-  if (dirtyLocals)
-  {
-    RecalculateBasis();
-    dirtyLocals = false;
-  }
   if (dirtyRot)
   {
-    rotMat = m4f(localX.x, localY.x, localZ.x,
-                  localX.y, localY.y, localZ.y,
-                  localX.z, localY.z, localZ.z);
+    rotMat = orient.Matrix();
     dirtyRot = false;
   }
   if (dirtyPos)
@@ -505,3 +358,14 @@ void dp::Transform::RecalculateMatrix(void)
   norm = concat.Linear().Inverse().Transpose();
   dirty = false;
 } // end void RecalculateMatrix(void)
+
+
+// Compose a rotation about local axes into the orientation                   */
+void dp::Transform::Turn(const q4f& turn)
+{
+  orient = (orient * turn).Normalize();
+  RecalculateBasis();
+  dirtyRot = true;
+  dirty = true;
+
+} // end void Transform::Turn(const q4f&)
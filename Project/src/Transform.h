@@ -20,6 +20,7 @@ written consent of DigiPen Institute of Technology is prohibited.
 #include "v3f.h"  // Constant definitions for initialization
 #include "v4f.h"  // Constant definitions for initialization
 #include "m4f.h"  // Output (T)SRT concatenated placement / transform matrix
+#include "q4f.h"  // Orientation storage: composition without euler trig
 
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 /*                             Forward References                             */
@@ -200,10 +201,12 @@ namespace dp //! Contents for use within class assignments
     /** Get euler angles of cartesian rotation per local axis
     \brief
       - get euler angles of cartesian rotation per local axis
+    \details
+      - computed on demand from the orientation quaternion
     \return
-      - reference to the contained orientation vector of radian euler angles
+      - orientation vector of radian euler angles <x, y, z>
     */
-    const v3f& Orientation(void) const;
+    v3f Orientation(void) const;
 
 
     /** Set euler angle of cartesian rotation per local axis in <z, y, x> order
@@ -296,13 +299,33 @@ namespace dp //! Contents for use within class assignments
     Transform& Roll(ang rollChange, bool relative = true);
 
 
+    /** Get the orientation as a unit quaternion (ie for interpolation)
+    \brief
+      - get the orientation as a unit quaternion (ie for interpolation)
+    \return
+      - reference to the contained orientation quaternion
+    */
+    const q4f& Rotation(void) const;
+
+
+    /** Set the orientation from a quaternion (ie a Slerp / Nlerp result)
+    \brief
+      - set the orientation from a quaternion (ie a Slerp / Nlerp result)
+    \param orientation
+      - rotation from world axes to local axes (normalized when stored)
+    \return
+      - reference to the modified Transform for easier subsequent inline action
+    */
+    Transform& Rotation(const q4f& orientation);
+
+
     /** Get 2D rotation of the object, presuming no other axial rotation values
     \brief
       - get 2D rotation of the object, presuming no other axial rotation values
     \return
-      - reference to the contained Z value of the orientation v3f of radians
+      - Z value of the orientation's euler angles, in radians
     */
-    const f4& RotateZRad(void) const;
+    f4 RotateZRad(void) const;
 
 
     /** Get the size (unitless) of object to be displayed, per local axis
@@ -368,6 +391,9 @@ namespace dp //! Contents for use within class assignments
     //! Local unit vector for the current orientation's z-axis (n|roll vector)
     v3f localZ;
 
+    //! Unit quaternion of the current orientation: source of locals & rotMat
+    q4f orient;
+
     //! Flag tracks if any settings changed; matrix/norm needs recalculation
     bool dirty;
 
@@ -377,9 +403,6 @@ namespace dp //! Contents for use within class assignments
     //! Flag tracks if rotation changed; rotMat needs recalculation
     bool dirtyRot;
 
-    //! Flag tracks if orientation was set; local vectors need recalculation
-    bool dirtyLocals;
-
 
   private:
 
@@ -389,15 +412,21 @@ namespace dp //! Contents for use within class assignments
 
     /** Set internal local unit vectors to reflect current orientation
     \brief
-      - set internal concat m4f to represent current summary transformations
+      - set internal local unit vectors to reflect current orientation
+    \details
+      - read straight from the quaternion: no trig or matrix products
     */
     void RecalculateBasis(void);
 
-    /** Update euler orientation values to be reflective of local basis vectors
+    /** Compose a rotation about local axes into the orientation
     \brief
-      - update euler orientation values to be reflective of local basis vectors
+      - compose a rotation about local axes into the orientation
+    \details
+      - re-normalizes the quaternion so repeated turns don't drift
+    \param turn
+      - rotation relative to the current local axes
     */
-    void RecalculateEulers(void);
+    void Turn(const q4f& turn);
 
     /** Set internal concat m4f to represent current summary transformations
     \brief
@@ -433,10 +462,6 @@ namespace dp //! Contents for use within class assignments
     //! Affine anchor vector: relative offset for scale / rotation center point
     v3f offset;
 
-    //! Euler angle of rotation in radians about z, y, x ordering
-    v3f orientRad;
-    // TODO: refactor v3f -> gimbal of ang members after gimbal class is made
-
     //! Inverse scale setting to restore normalized dimensions (for anchor)
     v3f rescale;
 
@@ -452,8 +477,8 @@ namespace dp //! Contents for use within class assignments
 
   }; // end Transform class
 
-  // 4^3 per m4f, 3*4 per v3f, 6 bools w/2 trailing, +2 padding on 4-byte bounds
-  static_assert(sizeof(Transform) == 120*4 + 6+2, "Transform not packed");
+  // 4^3 per m4f, 3*4 per v3f, 4*4 per q4f, 5 bools w/3 padding on 4-byte bounds
+  static_assert(sizeof(Transform) == 121*4 + 5+3, "Transform not packed");
   // TODO: norm => m3f, bools to bitfield 486-(7+5) = 473, %4=1 => +3 padding...
 
 } // end dp namespace
@@ -0,0 +1,354 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  TransformSystem.cpp
+Purpose:  Batch placement of many objects: SoA inputs, dirty bits, matrices
+Details:  a group of 4 objects is rebuilt with each matrix element as one
+  SSE register (its 4 objects' values), then each column is transposed into
+  the 4 objects' own m4f columns.  Only lanes whose dirty bit is set are
+  stored, so clean neighbours of a dirty object are left as they were.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <std>
+#include <xmmintrin.h>  // SSE 4-wide float lanes & 4x4 transpose
+
+// "./src/..."
+#include "Parallel.h"         // ParallelFor() over dirty bitset words
+#include "Transform.h"        // Single object placement to copy in
+#include "TransformSystem.h"  // Class declaration header
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace
+{
+  //! Least bitset words per chunk: as many objects as ParallelFor()'s grain
+  constexpr u4 WORD_GRAIN = dp::PARALLEL_GRAIN / dp::TransformSystem::WORD;
+
+  //! Mask of the dirty bits of one group of lanes
+  constexpr u8 LANE_MASK = (1ull << dp::TransformSystem::LANES) - 1ull;
+
+
+  /** Store one column of 4 objects' matrices, from its 4 element registers
+  \brief
+    - store one column of 4 objects' matrices, from its 4 element registers
+  \param x, y, z, w
+    - column elements, each holding the 4 objects' values in lane order
+  \param column
+    - matrix column to be stored
+  \param lanes
+    - dirty bits of the 4 objects: only these lanes are stored
+  \param out
+    - matrices of the 4 objects
+  */
+  inline void StoreColumn(__m128 x, __m128 y, __m128 z, __m128 w, u4 column,
+    u4 lanes, dp::m4f* out)
+  {
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+    if (lanes & 1u) { _mm_storeu_ps(&out[0][column][0], x); }
+    if (lanes & 2u) { _mm_storeu_ps(&out[1][column][0], y); }
+    if (lanes & 4u) { _mm_storeu_ps(&out[2][column][0], z); }
+    if (lanes & 8u) { _mm_storeu_ps(&out[3][column][0], w); }
+
+  } // end void StoreColumn(__m128, __m128, __m128, __m128, u4, u4, m4f*)     */
+
+} // end anonymous namespace
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::TransformSystem::TransformSystem(u4 capacity) : count(0u)
+{
+  u4 padded = (capacity + WORD - 1u) / WORD * WORD;
+  for (std::vector<f4>& p : position) { p.reserve(padded); }
+  for (std::vector<f4>& r : rotation) { r.reserve(padded); }
+  for (std::vector<f4>& s : scale) { s.reserve(padded); }
+  for (std::vector<f4>& a : anchor) { a.reserve(padded); }
+  dirty.reserve(padded / WORD);
+  world.reserve(capacity);
+  normal.reserve(capacity);
+
+} // end TransformSystem::TransformSystem(u4)                                 */
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+u4 dp::TransformSystem::Add(const v3f& at, const q4f& orientation,
+  const v3f& size, const v3f& offset)
+{
+  // Grow by a whole word of identity placements, so lane loads stay in range
+  if (count % WORD == 0u)
+  {
+    for (std::vector<f4>& p : position) { p.resize(count + WORD, 0.0f); }
+    for (u4 i = 0u; i < 4u; ++i)
+    {
+      rotation[i].resize(count + WORD, i == 3u ? 1.0f : 0.0f);
+    }
+    for (std::vector<f4>& s : scale) { s.resize(count + WORD, 1.0f); }
+    for (std::vector<f4>& a : anchor) { a.resize(count + WORD, 0.0f); }
+    dirty.push_back(0ull);
+  }
+  world.push_back(m4f());
+  normal.push_back(m4f());
+  u4 index = count++;
+  Position(index, at).Rotation(index, orientation);
+  Scale(index, size).Anchor(index, offset);
+  return index;
+
+} // end u4 TransformSystem::Add(const v3f&, const q4f&, const v3f&, ...)     */
+
+
+u4 dp::TransformSystem::Add(const Transform& source)
+{
+  return Add(source.Position(), source.Rotation(), source.Scale(),
+    source.Anchor());
+
+} // end u4 TransformSystem::Add(const Transform&)                            */
+
+
+dp::v3f dp::TransformSystem::Anchor(u4 index) const
+{
+  return v3f(anchor[0][index], anchor[1][index], anchor[2][index]);
+
+} // end v3f TransformSystem::Anchor(u4) const                                */
+
+
+dp::TransformSystem& dp::TransformSystem::Anchor(u4 index, const v3f& offset)
+{
+  if (index >= count) { return *this; }
+  anchor[0][index] = offset.x;
+  anchor[1][index] = offset.y;
+  anchor[2][index] = offset.z;
+  Mark(index);
+  return *this;
+
+} // end TransformSystem& TransformSystem::Anchor(u4, const v3f&)             */
+
+
+dp::TransformSystem& dp::TransformSystem::Clear(void)
+{
+  for (std::vector<f4>& p : position) { p.clear(); }
+  for (std::vector<f4>& r : rotation) { r.clear(); }
+  for (std::vector<f4>& s : scale) { s.clear(); }
+  for (std::vector<f4>& a : anchor) { a.clear(); }
+  dirty.clear();
+  world.clear();
+  normal.clear();
+  count = 0u;
+  return *this;
+
+} // end TransformSystem& TransformSystem::Clear(void)                        */
+
+
+u4 dp::TransformSystem::Count(void) const
+{ return count; } // end u4 TransformSystem::Count(void) const                */
+
+
+bool dp::TransformSystem::Dirty(u4 index) const
+{
+  return index < count && ((dirty[index / WORD] >> (index % WORD)) & 1ull);
+
+} // end bool TransformSystem::Dirty(u4) const                                */
+
+
+const dp::m4f* dp::TransformSystem::Matrices(void) const
+{ return world.data(); } // end const m4f* TransformSystem::Matrices(void) const
+
+
+const dp::m4f& dp::TransformSystem::Matrix(u4 index) const
+{ return world[index]; } // end const m4f& TransformSystem::Matrix(u4) const  */
+
+
+dp::TransformSystem& dp::TransformSystem::MoveBy(u4 index,
+  const v3f& displacement)
+{
+  if (index >= count || displacement == nullv3f) { return *this; }
+  return Position(index, Position(index) + displacement);
+
+} // end TransformSystem& TransformSystem::MoveBy(u4, const v3f&)             */
+
+
+const dp::m4f* dp::TransformSystem::Normals(void) const
+{ return normal.data(); } // end const m4f* TransformSystem::Normals(void) const
+
+
+dp::v3f dp::TransformSystem::Position(u4 index) const
+{
+  return v3f(position[0][index], position[1][index], position[2][index]);
+
+} // end v3f TransformSystem::Position(u4) const                              */
+
+
+dp::TransformSystem& dp::TransformSystem::Position(u4 index, const v3f& at)
+{
+  if (index >= count) { return *this; }
+  position[0][index] = at.x;
+  position[1][index] = at.y;
+  position[2][index] = at.z;
+  Mark(index);
+  return *this;
+
+} // end TransformSystem& TransformSystem::Position(u4, const v3f&)           */
+
+
+dp::q4f dp::TransformSystem::Rotation(u4 index) const
+{
+  return q4f(rotation[0][index], rotation[1][index], rotation[2][index],
+    rotation[3][index]);
+
+} // end q4f TransformSystem::Rotation(u4) const                              */
+
+
+dp::TransformSystem& dp::TransformSystem::Rotation(u4 index,
+  const q4f& orientation)
+{
+  if (index >= count) { return *this; }
+  q4f unit = q4f(orientation).Normalize();
+  rotation[0][index] = unit.x;
+  rotation[1][index] = unit.y;
+  rotation[2][index] = unit.z;
+  rotation[3][index] = unit.w;
+  Mark(index);
+  return *this;
+
+} // end TransformSystem& TransformSystem::Rotation(u4, const q4f&)           */
+
+
+dp::v3f dp::TransformSystem::Scale(u4 index) const
+{
+  return v3f(scale[0][index], scale[1][index], scale[2][index]);
+
+} // end v3f TransformSystem::Scale(u4) const                                 */
+
+
+dp::TransformSystem& dp::TransformSystem::Scale(u4 index, const v3f& size)
+{
+  if (index >= count) { return *this; }
+  scale[0][index] = size.x;
+  scale[1][index] = size.y;
+  scale[2][index] = size.z;
+  Mark(index);
+  return *this;
+
+} // end TransformSystem& TransformSystem::Scale(u4, const v3f&)              */
+
+
+dp::TransformSystem& dp::TransformSystem::Turn(u4 index, const q4f& turn)
+{
+  if (index >= count) { return *this; }
+  return Rotation(index, Rotation(index) * turn);
+
+} // end TransformSystem& TransformSystem::Turn(u4, const q4f&)               */
+
+
+u4 dp::TransformSystem::Update(void)
+{
+  u4 words = static_cast<u4>(dirty.size());
+  std::vector<u4> rebuilt(ParallelChunks(words, WORD_GRAIN), 0u);
+  ParallelFor(words, [&](u4 first, u4 last, u4 chunk)
+  {
+    const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+    for (u4 word = first; word < last; ++word)
+    {
+      u8 bits = dirty[word];
+      if (!bits) { continue; }
+      dirty[word] = 0ull;
+      for (u8 b = bits; b; b &= b - 1ull) { ++rebuilt[chunk]; }
+
+      for (u4 group = 0u; group < WORD; group += LANES)
+      {
+        u4 lanes = static_cast<u4>((bits >> group) & LANE_MASK);
+        if (!lanes) { continue; }
+        u4 at = word * WORD + group;
+
+        // Basis of each unit quaternion: as q4f::Basis(), 4 at once
+        __m128 x = _mm_loadu_ps(&rotation[0][at]);
+        __m128 y = _mm_loadu_ps(&rotation[1][at]);
+        __m128 z = _mm_loadu_ps(&rotation[2][at]);
+        __m128 w = _mm_loadu_ps(&rotation[3][at]);
+        __m128 x2 = _mm_add_ps(x, x), y2 = _mm_add_ps(y, y);
+        __m128 z2 = _mm_add_ps(z, z);
+        __m128 xx = _mm_mul_ps(x, x2), yy = _mm_mul_ps(y, y2);
+        __m128 zz = _mm_mul_ps(z, z2), xy = _mm_mul_ps(x, y2);
+        __m128 xz = _mm_mul_ps(x, z2), yz = _mm_mul_ps(y, z2);
+        __m128 wx = _mm_mul_ps(w, x2), wy = _mm_mul_ps(w, y2);
+        __m128 wz = _mm_mul_ps(w, z2);
+        __m128 ux = _mm_sub_ps(_mm_sub_ps(one, yy), zz);
+        __m128 uy = _mm_add_ps(xy, wz), uz = _mm_sub_ps(xz, wy);
+        __m128 vx = _mm_sub_ps(xy, wz);
+        __m128 vy = _mm_sub_ps(_mm_sub_ps(one, xx), zz);
+        __m128 vz = _mm_add_ps(yz, wx);
+        __m128 nx = _mm_add_ps(xz, wy), ny = _mm_sub_ps(yz, wx);
+        __m128 nz = _mm_sub_ps(_mm_sub_ps(one, xx), yy);
+
+        // Translation less the rotated anchor: T * R * S * T(-anchor / S)
+        __m128 ox = _mm_loadu_ps(&anchor[0][at]);
+        __m128 oy = _mm_loadu_ps(&anchor[1][at]);
+        __m128 oz = _mm_loadu_ps(&anchor[2][at]);
+        __m128 tx = _mm_sub_ps(_mm_loadu_ps(&position[0][at]), _mm_add_ps(
+          _mm_add_ps(_mm_mul_ps(ux, ox), _mm_mul_ps(vx, oy)),
+          _mm_mul_ps(nx, oz)));
+        __m128 ty = _mm_sub_ps(_mm_loadu_ps(&position[1][at]), _mm_add_ps(
+          _mm_add_ps(_mm_mul_ps(uy, ox), _mm_mul_ps(vy, oy)),
+          _mm_mul_ps(ny, oz)));
+        __m128 tz = _mm_sub_ps(_mm_loadu_ps(&position[2][at]), _mm_add_ps(
+          _mm_add_ps(_mm_mul_ps(uz, ox), _mm_mul_ps(vz, oy)),
+          _mm_mul_ps(nz, oz)));
+
+        // World: basis columns scaled; normal: divided (R * S^-1)
+        __m128 sx = _mm_loadu_ps(&scale[0][at]);
+        __m128 sy = _mm_loadu_ps(&scale[1][at]);
+        __m128 sz = _mm_loadu_ps(&scale[2][at]);
+        m4f* out = &world[at];
+        StoreColumn(_mm_mul_ps(ux, sx), _mm_mul_ps(uy, sx),
+          _mm_mul_ps(uz, sx), zero, 0u, lanes, out);
+        StoreColumn(_mm_mul_ps(vx, sy), _mm_mul_ps(vy, sy),
+          _mm_mul_ps(vz, sy), zero, 1u, lanes, out);
+        StoreColumn(_mm_mul_ps(nx, sz), _mm_mul_ps(ny, sz),
+          _mm_mul_ps(nz, sz), zero, 2u, lanes, out);
+        StoreColumn(tx, ty, tz, one, 3u, lanes, out);
+
+        sx = _mm_div_ps(one, sx);
+        sy = _mm_div_ps(one, sy);
+        sz = _mm_div_ps(one, sz);
+        out = &normal[at];
+        StoreColumn(_mm_mul_ps(ux, sx), _mm_mul_ps(uy, sx),
+          _mm_mul_ps(uz, sx), zero, 0u, lanes, out);
+        StoreColumn(_mm_mul_ps(vx, sy), _mm_mul_ps(vy, sy),
+          _mm_mul_ps(vz, sy), zero, 1u, lanes, out);
+        StoreColumn(_mm_mul_ps(nx, sz), _mm_mul_ps(ny, sz),
+          _mm_mul_ps(nz, sz), zero, 2u, lanes, out);
+        StoreColumn(zero, zero, zero, one, 3u, lanes, out);
+      }
+    }
+  }, WORD_GRAIN);
+
+  u4 total = 0u;
+  for (u4 n : rebuilt) { total += n; }
+  return total;
+
+} // end u4 TransformSystem::Update(void)                                     */
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+void dp::TransformSystem::Mark(u4 index)
+{
+  dirty[index / WORD] |= (1ull << (index % WORD));
+
+} // end void TransformSystem::Mark(u4)                                       */
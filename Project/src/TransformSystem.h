@@ -0,0 +1,342 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  TransformSystem.h
+Purpose:  Batch placement of many objects: SoA inputs, dirty bits, matrices
+Details:  each placed object is an index into component arrays (position,
+  orientation, scale and anchor, one array per float), so a batch of 4
+  neighbours loads straight into SSE lanes.  Setters only store and mark the
+  index in a dirty bitset; Update() then walks the bitset's 64 bit words in
+  parallel, rebuilding the world (& normal) matrices of each dirty group of 4
+  at once, into contiguous m4f arrays ready to be uploaded as they are.
+
+  Matrices match a Transform's concat / norm for the same inputs: scale
+  about the anchor, then rotate, then translate.  Orientations are kept as
+  unit quaternions, so no trig is done per update.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <vector>       // Component arrays, dirty bits & matrix outputs
+
+// "./src/..."
+#include "m4f.h"        // World / normal matrix outputs
+#include "q4f.h"        // Orientation input / output
+#include "v3f.h"        // Position / scale / anchor input / output
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class Transform;  // Single object placement, copied in by Add()
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! Placements of many objects in SoA arrays, updated in parallel batches
+  class TransformSystem
+  {
+  public:
+
+    //! Objects updated at once: the SSE lane count
+    static const u4 LANES = 4u;
+
+    //! Objects per dirty bitset word (arrays are padded to a multiple)
+    static const u4 WORD = 64u;
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create an empty system, with room for a number of objects
+    \brief
+      - create an empty system, with room for a number of objects
+    \param capacity
+      - objects to reserve room for, before any reallocation
+    */
+    TransformSystem(u4 capacity = 0u);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Add an object's placement, to be rebuilt by the next Update()
+    \brief
+      - add an object's placement, to be rebuilt by the next Update()
+    \param position
+      - world coordinates the object is moved to (Transform translation)
+    \param orientation
+      - rotation from world axes to local axes (normalized when stored)
+    \param scale
+      - size (unitless) of the object, per local axis
+    \param anchor
+      - offset of the scale / rotation center point from the object center
+    \return
+      - index of the added object, for all other calls
+    */
+    u4 Add(const v3f& position = nullv3f, const q4f& orientation = identq4f,
+      const v3f& scale = v3f(1.0f, 1.0f, 1.0f),
+      const v3f& anchor = nullv3f);
+
+
+    /** Add a copy of a Transform's placement, to be rebuilt by Update()
+    \brief
+      - add a copy of a Transform's placement, to be rebuilt by Update()
+    \param source
+      - object placement to be copied (later changes to it are not seen)
+    \return
+      - index of the added object, for all other calls
+    */
+    u4 Add(const Transform& source);
+
+
+    /** Get the anchor offset of an object
+    \brief
+      - get the anchor offset of an object
+    \param index
+      - object index returned by Add()
+    \return
+      - offset of the scale / rotation center point from the object center
+    */
+    v3f Anchor(u4 index) const;
+
+
+    /** Set the anchor offset of an object
+    \brief
+      - set the anchor offset of an object
+    \param index
+      - object index returned by Add() (others are ignored)
+    \param anchor
+      - offset of the scale / rotation center point from the object center
+    \return
+      - reference to the modified system for easier subsequent inline action
+    */
+    TransformSystem& Anchor(u4 index, const v3f& anchor);
+
+
+    /** Remove every object (keeping reserved room)
+    \brief
+      - remove every object (keeping reserved room)
+    \return
+      - reference to the modified system for easier subsequent inline action
+    */
+    TransformSystem& Clear(void);
+
+
+    /** Get the count of objects added
+    \brief
+      - get the count of objects added
+    \return
+      - number of objects, and of matrices in Matrices() / Normals()
+    */
+    u4 Count(void) const;
+
+
+    /** Check if an object changed since the last Update()
+    \brief
+      - check if an object changed since the last Update()
+    \param index
+      - object index returned by Add()
+    \return
+      - true if the object's matrices are out of date
+    */
+    bool Dirty(u4 index) const;
+
+
+    /** Get the world matrices of every object, in index order (for upload)
+    \brief
+      - get the world matrices of every object, in index order (for upload)
+    \return
+      - Count() contiguous matrices, as of the last Update()
+    */
+    const m4f* Matrices(void) const;
+
+
+    /** Get the world matrix of an object
+    \brief
+      - get the world matrix of an object
+    \param index
+      - object index returned by Add()
+    \return
+      - reference to the object's world matrix, as of the last Update()
+    */
+    const m4f& Matrix(u4 index) const;
+
+
+    /** Move an object by the given displacement from its current position
+    \brief
+      - move an object by the given displacement from its current position
+    \param index
+      - object index returned by Add() (others are ignored)
+    \param displacement
+      - world space change in position
+    \return
+      - reference to the modified system for easier subsequent inline action
+    */
+    TransformSystem& MoveBy(u4 index, const v3f& displacement);
+
+
+    /** Get the normal matrices (linear inverse transpose) of every object
+    \brief
+      - get the normal matrices (linear inverse transpose) of every object
+    \return
+      - Count() contiguous matrices, as of the last Update()
+    */
+    const m4f* Normals(void) const;
+
+
+    /** Get the position of an object
+    \brief
+      - get the position of an object
+    \param index
+      - object index returned by Add()
+    \return
+      - world coordinates the object is moved to
+    */
+    v3f Position(u4 index) const;
+
+
+    /** Set the position of an object
+    \brief
+      - set the position of an object
+    \param index
+      - object index returned by Add() (others are ignored)
+    \param position
+      - world coordinates the object is moved to
+    \return
+      - reference to the modified system for easier subsequent inline action
+    */
+    TransformSystem& Position(u4 index, const v3f& position);
+
+
+    /** Get the orientation of an object
+    \brief
+      - get the orientation of an object
+    \param index
+      - object index returned by Add()
+    \return
+      - unit quaternion rotating world axes to the object's local axes
+    */
+    q4f Rotation(u4 index) const;
+
+
+    /** Set the orientation of an object (ie a Slerp / Nlerp result)
+    \brief
+      - set the orientation of an object (ie a Slerp / Nlerp result)
+    \param index
+      - object index returned by Add() (others are ignored)
+    \param orientation
+      - rotation from world axes to local axes (normalized when stored)
+    \return
+      - reference to the modified system for easier subsequent inline action
+    */
+    TransformSystem& Rotation(u4 index, const q4f& orientation);
+
+
+    /** Get the scale of an object
+    \brief
+      - get the scale of an object
+    \param index
+      - object index returned by Add()
+    \return
+      - size (unitless) of the object, per local axis
+    */
+    v3f Scale(u4 index) const;
+
+
+    /** Set the scale of an object
+    \brief
+      - set the scale of an object
+    \param index
+      - object index returned by Add() (others are ignored)
+    \param scale
+      - size (unitless) of the object, per local axis
+    \return
+      - reference to the modified system for easier subsequent inline action
+    */
+    TransformSystem& Scale(u4 index, const v3f& scale);
+
+
+    /** Compose a rotation about an object's local axes into its orientation
+    \brief
+      - compose a rotation about an object's local axes into its orientation
+    \param index
+      - object index returned by Add() (others are ignored)
+    \param turn
+      - rotation relative to the current orientation
+    \return
+      - reference to the modified system for easier subsequent inline action
+    */
+    TransformSystem& Turn(u4 index, const q4f& turn);
+
+
+    /** Rebuild the matrices of every object changed since the last Update()
+    \brief
+      - rebuild the matrices of every object changed since the last Update()
+    \details
+      - dirty words are split over ParallelFor(); each group of 4 holding a
+      dirty object is rebuilt in SSE lanes, and only its dirty lanes stored
+    \return
+      - number of objects whose matrices were rebuilt
+    */
+    u4 Update(void);
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Private Methods                             */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Set an object's dirty bit, for its matrices to be rebuilt
+    \brief
+      - set an object's dirty bit, for its matrices to be rebuilt
+    \param index
+      - object index returned by Add()
+    */
+    void Mark(u4 index);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! World coordinates by axis <x, y, z>, then object (padded: 0)
+    std::vector<f4> position[3];
+
+    //! Unit quaternions by component <x, y, z, w>, then object (padded: 1)
+    std::vector<f4> rotation[4];
+
+    //! Size per local axis <x, y, z>, then object (padded: 1)
+    std::vector<f4> scale[3];
+
+    //! Scale / rotation center offsets by axis <x, y, z>, then object
+    std::vector<f4> anchor[3];
+
+    //! Out of date objects: bit (index % 64) of word (index / 64)
+    std::vector<u8> dirty;
+
+    //! World matrices by object, as of the last Update()
+    std::vector<m4f> world;
+
+    //! Normal matrices (linear inverse transpose) by object
+    std::vector<m4f> normal;
+
+    //! Number of objects added
+    u4 count;
+
+  }; // end TransformSystem class declaration
+
+} // end dp namespace
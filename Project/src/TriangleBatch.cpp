@@ -0,0 +1,463 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  TriangleBatch.cpp
+Purpose:  Batch ray / triangle intersection over SoA triangle blocks
+Details:  the Moller-Trumbore test is written once, over a lane type giving
+  its few float operations in SSE (4 wide) or AVX (8 wide).  A parallel ray
+  or degenerate (padding) triangle gives a 0 determinant, so NaN / INf
+  barycentrics, failing every ordered compare: no lane needs a special case.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <std>
+#include <emmintrin.h>  // SSE(2) 4-wide float / int lanes
+#if defined(__AVX__)
+#include <immintrin.h>  // AVX 8-wide float lanes
+#endif
+
+// "./src/..."
+#include "Ray.h"              // Ray origin / direction
+#include "RayPacket.h"        // Per lane ray origins / directions / spans
+#include "Triangle.h"         // Source triangle points
+#include "TriangleCompact.h"  // Source triangle points, packed
+#include "TriangleBatch.h"    // Class declaration header
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Consts                                */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace
+{
+  //! Floats per block: 9 components (A, AB, AC by axis) of 8 triangles
+  constexpr u4 BLOCK_FLOATS = 9u * dp::TriangleBatch::BLOCK;
+
+  //! SSE lane operations: 4 floats at once
+  struct Lanes4
+  {
+    typedef __m128 V;
+    static const u4 WIDTH = 4u;
+    static inline V Add(V a, V b) { return _mm_add_ps(a, b); }
+    static inline V And(V a, V b) { return _mm_and_ps(a, b); }
+    static inline V Div(V a, V b) { return _mm_div_ps(a, b); }
+    static inline V Index(u4 i)
+    { return _mm_castsi128_ps(_mm_set1_epi32(static_cast<s4>(i))); }
+    static inline V Le(V a, V b) { return _mm_cmple_ps(a, b); }
+    static inline V Load(const f4* at) { return _mm_loadu_ps(at); }
+    static inline V LoadIndex(const u4* at)
+    { return _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)at)); }
+    static inline V Lt(V a, V b) { return _mm_cmplt_ps(a, b); }
+    static inline u4 Mask(V a) { return static_cast<u4>(_mm_movemask_ps(a)); }
+    static inline V Mul(V a, V b) { return _mm_mul_ps(a, b); }
+    static inline V Select(V m, V a, V b)
+    { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+    static inline V Set(f4 a) { return _mm_set1_ps(a); }
+    static inline void Store(f4* at, V a) { _mm_storeu_ps(at, a); }
+    static inline void StoreIndex(u4* at, V a)
+    { _mm_storeu_si128((__m128i*)at, _mm_castps_si128(a)); }
+    static inline V Sub(V a, V b) { return _mm_sub_ps(a, b); }
+  };
+
+#if defined(__AVX__)
+  //! AVX lane operations: 8 floats at once
+  struct Lanes8
+  {
+    typedef __m256 V;
+    static const u4 WIDTH = 8u;
+    static inline V Add(V a, V b) { return _mm256_add_ps(a, b); }
+    static inline V And(V a, V b) { return _mm256_and_ps(a, b); }
+    static inline V Div(V a, V b) { return _mm256_div_ps(a, b); }
+    static inline V Index(u4 i)
+    { return _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<s4>(i))); }
+    static inline V Le(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static inline V Load(const f4* at) { return _mm256_loadu_ps(at); }
+    static inline V LoadIndex(const u4* at)
+    { return _mm256_castsi256_ps(_mm256_loadu_si256((const __m256i*)at)); }
+    static inline V Lt(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static inline u4 Mask(V a)
+    { return static_cast<u4>(_mm256_movemask_ps(a)); }
+    static inline V Mul(V a, V b) { return _mm256_mul_ps(a, b); }
+    static inline V Select(V m, V a, V b) { return _mm256_blendv_ps(b, a, m); }
+    static inline V Set(f4 a) { return _mm256_set1_ps(a); }
+    static inline void Store(f4* at, V a) { _mm256_storeu_ps(at, a); }
+    static inline void StoreIndex(u4* at, V a)
+    { _mm256_storeu_si256((__m256i*)at, _mm256_castps_si256(a)); }
+    static inline V Sub(V a, V b) { return _mm256_sub_ps(a, b); }
+  };
+
+  //! Lane operations for single rays against a block: all 8 lanes at once
+  typedef Lanes8 BlockLanes;
+#else
+  //! Lane operations for single rays against a block: 2 halves of 4 lanes
+  typedef Lanes4 BlockLanes;
+#endif
+
+  //! Lane operations for packets of LANES rays (4: SSE, 8: AVX if built)
+  template <u4 LANES>
+  struct PacketLanes { typedef Lanes4 type; };
+#if defined(__AVX__)
+  template <>
+  struct PacketLanes<8u> { typedef Lanes8 type; };
+#endif
+
+} // end anonymous namespace
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+//! Moller-Trumbore test of ray / triangle lanes; get lanes hit in [0, tFar)
+template <typename L>
+static inline typename L::V Moller(const typename L::V* o,
+  const typename L::V* d, const typename L::V* a, const typename L::V* e1,
+  const typename L::V* e2, typename L::V tFar, typename L::V& t,
+  typename L::V& u, typename L::V& v)
+{
+  typedef typename L::V V;
+
+  // p = d x e2; det = e1 . p: 0 if the ray is parallel to the triangle
+  V p0 = L::Sub(L::Mul(d[1], e2[2]), L::Mul(d[2], e2[1]));
+  V p1 = L::Sub(L::Mul(d[2], e2[0]), L::Mul(d[0], e2[2]));
+  V p2 = L::Sub(L::Mul(d[0], e2[1]), L::Mul(d[1], e2[0]));
+  V inv = L::Div(L::Set(1.0f), L::Add(L::Add(L::Mul(e1[0], p0),
+    L::Mul(e1[1], p1)), L::Mul(e1[2], p2)));
+
+  // s = o - a; u = (s . p) / det
+  V s0 = L::Sub(o[0], a[0]), s1 = L::Sub(o[1], a[1]), s2 = L::Sub(o[2], a[2]);
+  u = L::Mul(L::Add(L::Add(L::Mul(s0, p0), L::Mul(s1, p1)), L::Mul(s2, p2)),
+    inv);
+
+  // q = s x e1; v = (d . q) / det; t = (e2 . q) / det
+  V q0 = L::Sub(L::Mul(s1, e1[2]), L::Mul(s2, e1[1]));
+  V q1 = L::Sub(L::Mul(s2, e1[0]), L::Mul(s0, e1[2]));
+  V q2 = L::Sub(L::Mul(s0, e1[1]), L::Mul(s1, e1[0]));
+  v = L::Mul(L::Add(L::Add(L::Mul(d[0], q0), L::Mul(d[1], q1)),
+    L::Mul(d[2], q2)), inv);
+  t = L::Mul(L::Add(L::Add(L::Mul(e2[0], q0), L::Mul(e2[1], q1)),
+    L::Mul(e2[2], q2)), inv);
+
+  V zero = L::Set(0.0f);
+  return L::And(L::And(L::Le(zero, u), L::Le(zero, v)), L::And(
+    L::Le(L::Add(u, v), L::Set(1.0f)), L::And(L::Le(zero, t), L::Lt(t, tFar))));
+
+} // end V Moller(const V*, const V*, const V*, ..., V&, V&, V&)              */
+
+
+//! Test a ray against a block's valid lanes, keeping the nearest hit (or
+//! stopping at any hit); get whether any lane was hit
+template <typename L>
+static inline bool Block(const f4* block, u4 valid, const typename L::V* o,
+  const typename L::V* d, const u4* index, dp::TriangleBatch::Hit& best,
+  bool any)
+{
+  typedef typename L::V V;
+  const u4 all = (1u << L::WIDTH) - 1u;
+
+  bool found = false;
+  for (u4 off = 0u; off < dp::TriangleBatch::BLOCK; off += L::WIDTH)
+  {
+    if (!((valid >> off) & all)) { continue; }
+
+    V a[3], e1[3], e2[3], t, u, v;
+    for (u4 c = 0u; c < 3u; ++c)
+    {
+      a[c] = L::Load(block + c * dp::TriangleBatch::BLOCK + off);
+      e1[c] = L::Load(block + (c + 3u) * dp::TriangleBatch::BLOCK + off);
+      e2[c] = L::Load(block + (c + 6u) * dp::TriangleBatch::BLOCK + off);
+    }
+    u4 hit = L::Mask(Moller<L>(o, d, a, e1, e2, L::Set(best.t), t, u, v))
+      & (valid >> off) & all;
+    if (!hit) { continue; }
+    found = true;
+    if (any) { return true; }
+
+    f4 ts[8], us[8], vs[8];
+    L::Store(ts, t);
+    L::Store(us, u);
+    L::Store(vs, v);
+    for (u4 k = 0u; k < L::WIDTH; ++k)
+    {
+      if ((hit >> k & 1u) && ts[k] < best.t)
+      {
+        best.t = ts[k];
+        best.u = us[k];
+        best.v = vs[k];
+        best.index = index[off + k];
+      }
+    }
+  }
+  return found;
+
+} // end bool Block(const f4*, u4, const V*, const V*, const u4*, Hit&, bool) */
+
+
+//! Fill SoA blocks (padded with 0 edge lanes) and slot indices from
+//! triangles of any type giving A(), B() and C()
+template <typename T>
+static void Gather(const T* triangles, u4 count, const u4* order,
+  std::vector<f4>& block, std::vector<u4>& index)
+{
+  const u4 BLOCK = dp::TriangleBatch::BLOCK;
+  u4 blocks = (count + BLOCK - 1u) / BLOCK;
+  block.assign(blocks * BLOCK_FLOATS, 0.0f); // Padding: 0 edges, never hit
+  index.assign(blocks * BLOCK, u4_INVALID);
+
+  for (u4 slot = 0u; slot < count; ++slot)
+  {
+    u4 i = order ? order[slot] : slot;
+    const T& tri = triangles[i];
+    dp::v3f a = tri.A(), e1 = tri.B() - a, e2 = tri.C() - a;
+
+    f4* at = &block[(slot / BLOCK) * BLOCK_FLOATS + slot % BLOCK];
+    for (s1 c = 0; c < 3; ++c)
+    {
+      at[c * BLOCK] = a[c];
+      at[(c + 3) * BLOCK] = e1[c];
+      at[(c + 6) * BLOCK] = e2[c];
+    }
+    index[slot] = i;
+  }
+
+} // end void Gather(const T*, u4, const u4*, vector<f4>&, vector<u4>&)       */
+
+
+//! Get the mask of a block's lanes within slots [first, last)
+static inline u4 Valid(u4 block, u4 first, u4 last)
+{
+  u4 base = block * dp::TriangleBatch::BLOCK;
+  u4 low = (base < first) ? first - base : 0u;
+  u4 high = (last - base < dp::TriangleBatch::BLOCK) ? last - base
+    : dp::TriangleBatch::BLOCK;
+  return ((1u << high) - 1u) & ~((1u << low) - 1u);
+
+} // end u4 Valid(u4, u4, u4)                                                 */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::TriangleBatch::TriangleBatch(void) : count(0u)
+{ } // end TriangleBatch::TriangleBatch(void)                                 */
+
+
+dp::TriangleBatch::TriangleBatch(const Triangle* triangles, u4 given)
+  : count(0u)
+{
+  Build(triangles, given);
+
+} // end TriangleBatch::TriangleBatch(const Triangle*, u4)                    */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::TriangleBatch& dp::TriangleBatch::Build(const Triangle* triangles,
+  u4 given, const u4* order)
+{
+  count = given;
+  Gather(triangles, count, order, block, index);
+  return *this;
+
+} // end TriangleBatch& TriangleBatch::Build(const Triangle*, u4, const u4*)  */
+
+
+dp::TriangleBatch& dp::TriangleBatch::Build(
+  const TriangleCompact* triangles, u4 given, const u4* order)
+{
+  count = given;
+  Gather(triangles, count, order, block, index);
+  return *this;
+
+} // end TriangleBatch& TriangleBatch::Build(const TriangleCompact*, u4, ...) */
+
+
+dp::TriangleBatch::Hit dp::TriangleBatch::Intersect(const Ray& ray,
+  f4 tMax) const
+{
+  return Intersect(ray, 0u, count, tMax);
+
+} // end Hit TriangleBatch::Intersect(const Ray&, f4) const                   */
+
+
+dp::TriangleBatch::Hit dp::TriangleBatch::Intersect(const Ray& ray, u4 first,
+  u4 last, f4 tMax) const
+{
+  typedef BlockLanes::V V;
+  Hit best = { tMax, 0.0f, 0.0f, u4_INVALID };
+  last = (count < last) ? count : last;
+
+  V o[3], d[3];
+  for (s1 a = 0; a < 3; ++a)
+  {
+    o[a] = BlockLanes::Set(ray.Origin()[a]);
+    d[a] = BlockLanes::Set(ray.Direction()[a]);
+  }
+  for (u4 b = first / BLOCK; b * BLOCK < last; ++b)
+  {
+    Block<BlockLanes>(&block[b * BLOCK_FLOATS], Valid(b, first, last), o, d,
+      &index[b * BLOCK], best, false);
+  }
+  if (best.index == u4_INVALID) { best.t = INf; }
+  return best;
+
+} // end Hit TriangleBatch::Intersect(const Ray&, u4, u4, f4) const           */
+
+
+dp::TriangleBatch::Hit dp::TriangleBatch::Intersect(const Ray& ray,
+  const u4* slots, u4 listed, f4 tMax) const
+{
+  typedef BlockLanes::V V;
+  Hit best = { tMax, 0.0f, 0.0f, u4_INVALID };
+
+  V o[3], d[3];
+  for (s1 a = 0; a < 3; ++a)
+  {
+    o[a] = BlockLanes::Set(ray.Origin()[a]);
+    d[a] = BlockLanes::Set(ray.Direction()[a]);
+  }
+
+  // Gather each 8 listed slots into a block of their own
+  f4 gathered[BLOCK_FLOATS];
+  u4 indices[BLOCK];
+  for (u4 first = 0u; first < listed; first += BLOCK)
+  {
+    u4 lanes = (listed - first < BLOCK) ? listed - first : BLOCK;
+    for (u4 k = 0u; k < lanes; ++k)
+    {
+      u4 slot = slots[first + k];
+      const f4* from = &block[(slot / BLOCK) * BLOCK_FLOATS + slot % BLOCK];
+      for (u4 c = 0u; c < 9u; ++c)
+      {
+        gathered[c * BLOCK + k] = from[c * BLOCK];
+      }
+      indices[k] = index[slot];
+    }
+    Block<BlockLanes>(gathered, (1u << lanes) - 1u, o, d, indices, best,
+      false);
+  }
+  if (best.index == u4_INVALID) { best.t = INf; }
+  return best;
+
+} // end Hit TriangleBatch::Intersect(const Ray&, const u4*, u4, f4) const    */
+
+
+template <u4 LANES>
+u4 dp::TriangleBatch::Intersect(const RayPacket<LANES>& packet, u4 first,
+  u4 last, Hit* hits) const
+{
+  typedef typename PacketLanes<LANES>::type L;
+  typedef typename L::V V;
+  const u4 all = (1u << L::WIDTH) - 1u;
+  last = (count < last) ? count : last;
+
+  u4 replaced = 0u;
+  for (u4 quad = 0u; quad < LANES; quad += L::WIDTH)
+  {
+    u4 lanes = (packet.Active() >> quad) & all;
+    if (!lanes) { continue; }
+
+    // Nearest so far per lane, capped by each lane's span
+    f4 t[8], u[8], v[8];
+    u4 id[8];
+    for (u4 k = 0u; k < L::WIDTH; ++k)
+    {
+      const Hit& hit = hits[quad + k];
+      t[k] = MinF(hit.t, packet.Far(quad + k));
+      u[k] = hit.u;
+      v[k] = hit.v;
+      id[k] = u4_INVALID;
+    }
+    V o[3], d[3];
+    for (u4 a = 0u; a < 3u; ++a)
+    {
+      o[a] = L::Load(packet.Origins(a) + quad);
+      d[a] = L::Load(packet.Directions(a) + quad);
+    }
+    V tBest = L::Load(t), uBest = L::Load(u), vBest = L::Load(v);
+    V iBest = L::LoadIndex(id);
+
+    // Each triangle against all lanes' rays at once
+    for (u4 slot = first; slot < last; ++slot)
+    {
+      const f4* from = &block[(slot / BLOCK) * BLOCK_FLOATS + slot % BLOCK];
+      V a[3], e1[3], e2[3], tHit, uHit, vHit;
+      for (u4 c = 0u; c < 3u; ++c)
+      {
+        a[c] = L::Set(from[c * BLOCK]);
+        e1[c] = L::Set(from[(c + 3u) * BLOCK]);
+        e2[c] = L::Set(from[(c + 6u) * BLOCK]);
+      }
+      V hit = Moller<L>(o, d, a, e1, e2, tBest, tHit, uHit, vHit);
+      if (!L::Mask(hit)) { continue; }
+      tBest = L::Select(hit, tHit, tBest);
+      uBest = L::Select(hit, uHit, uBest);
+      vBest = L::Select(hit, vHit, vBest);
+      iBest = L::Select(hit, L::Index(index[slot]), iBest);
+    }
+
+    L::Store(t, tBest);
+    L::Store(u, uBest);
+    L::Store(v, vBest);
+    L::StoreIndex(id, iBest);
+    for (u4 k = 0u; k < L::WIDTH; ++k)
+    {
+      if (!(lanes >> k & 1u) || id[k] == u4_INVALID) { continue; }
+      Hit& hit = hits[quad + k];
+      hit.t = t[k];
+      hit.u = u[k];
+      hit.v = v[k];
+      hit.index = id[k];
+      replaced |= 1u << (quad + k);
+    }
+  }
+  return replaced;
+
+} // end u4 TriangleBatch::Intersect(const RayPacket&, u4, u4, Hit*) const    */
+
+
+bool dp::TriangleBatch::Occluded(const Ray& ray, u4 first, u4 last,
+  f4 tMax) const
+{
+  typedef BlockLanes::V V;
+  Hit best = { tMax, 0.0f, 0.0f, u4_INVALID };
+  last = (count < last) ? count : last;
+
+  V o[3], d[3];
+  for (s1 a = 0; a < 3; ++a)
+  {
+    o[a] = BlockLanes::Set(ray.Origin()[a]);
+    d[a] = BlockLanes::Set(ray.Direction()[a]);
+  }
+  for (u4 b = first / BLOCK; b * BLOCK < last; ++b)
+  {
+    if (Block<BlockLanes>(&block[b * BLOCK_FLOATS], Valid(b, first, last), o,
+      d, &index[b * BLOCK], best, true))
+    {
+      return true;
+    }
+  }
+  return false;
+
+} // end bool TriangleBatch::Occluded(const Ray&, u4, u4, f4) const           */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                          Explicit Instantiations                           */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+template u4 dp::TriangleBatch::Intersect<4u>(const RayPacket<4u>&, u4, u4,
+  Hit*) const;
+template u4 dp::TriangleBatch::Intersect<8u>(const RayPacket<8u>&, u4, u4,
+  Hit*) const;
@@ -0,0 +1,247 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  TriangleBatch.h
+Purpose:  Batch ray / triangle intersection over SoA triangle blocks
+Details:  triangles are stored as first vertex and 2 edges (the 9 floats the
+  Moller-Trumbore test reads), in blocks of 8 with each component's 8 values
+  side by side.  A ray is tested against a whole block at once: 8 lanes in
+  AVX where the build targets it (/arch:AVX or AVX2), else 2 SSE halves.
+  Blocks are padded with degenerate (0 edge) triangles, which no ray hits.
+
+  Slots follow the order the triangles were given in (or a given order, e.g.
+  a hierarchy's leaf order), so a hierarchy leaf holding a run of slots, or
+  a list of candidate slots from any broadphase, is tested in one call: the
+  batch serves as the leaf kernel of any acceleration structure.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <vector>       // Triangle component blocks / slot indices
+
+// "./src/..."
+#include "v3f.h"  // Triangle points / edges
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class Ray;      // Tested line of sight
+  class Triangle;         // Source of each slot's points
+  class TriangleCompact;  // Source of each slot's points, packed
+
+  template <u4 LANES>
+  class RayPacket;  // Tested lines of sight, one per lane
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! Triangles in SoA blocks of 8, for batch Moller-Trumbore ray tests
+  class TriangleBatch
+  {
+  public:
+
+    //! Triangles per block: the widest (AVX) lane count
+    static const u4 BLOCK = 8u;
+
+    //! Nearest ray hit found: distance, barycentrics and triangle
+    struct Hit
+    {
+      f4 t;     //! Distance along the ray (INf if no hit)
+      f4 u;     //! Weight of the 2nd point (B) at the hit
+      f4 v;     //! Weight of the 3rd point (C) at the hit (A's: 1 - u - v)
+      u4 index; //! Triangle index as given to Build() (u4_INVALID if none)
+    };
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create an empty batch
+    \brief
+      - create an empty batch
+    */
+    TriangleBatch(void);
+
+
+    /** Create a batch of triangles, slotted in the order given
+    \brief
+      - create a batch of triangles, slotted in the order given
+    \param triangles
+      - world space triangles to be copied in
+    \param count
+      - number of triangles given
+    */
+    TriangleBatch(const Triangle* triangles, u4 count);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Refill the batch from triangles, in the order given or a given order
+    \brief
+      - refill the batch from triangles, in the order given or a given order
+    \param triangles
+      - world space triangles to be copied in
+    \param count
+      - number of slots to be filled
+    \param order
+      - triangle index of each slot (e.g. a hierarchy's leaf order), or
+      nullptr for slot i to hold triangle i
+    \return
+      - reference to the batch for easier subsequent inline action
+    */
+    TriangleBatch& Build(const Triangle* triangles, u4 count,
+      const u4* order = nullptr);
+
+
+    /** Refill the batch from compact triangles, in the order given or a given
+    order
+    \brief
+      - refill the batch from compact triangles, in the order given or a given
+      order
+    \param triangles
+      - world space triangles to be copied in
+    \param count
+      - number of slots to be filled
+    \param order
+      - triangle index of each slot (e.g. a hierarchy's leaf order), or
+      nullptr for slot i to hold triangle i
+    \return
+      - reference to the batch for easier subsequent inline action
+    */
+    TriangleBatch& Build(const TriangleCompact* triangles, u4 count,
+      const u4* order = nullptr);
+
+
+    /** Get the number of triangle slots filled
+    \brief
+      - get the number of triangle slots filled
+    \return
+      - count of triangles in the batch
+    */
+    inline u4 Count(void) const
+    { return count; } // end u4 TriangleBatch::Count(void) const              */
+
+
+    /** Get the nearest hit of a ray on any triangle
+    \brief
+      - get the nearest hit of a ray on any triangle
+    \param ray
+      - world space ray to be cast
+    \param tMax
+      - farthest distance along the ray to be tested (hits must be nearer)
+    \return
+      - nearest hit, if any (else t = INf and index = u4_INVALID)
+    */
+    Hit Intersect(const Ray& ray, f4 tMax = INf) const;
+
+
+    /** Get the nearest hit of a ray on a run of slots (e.g. a leaf's)
+    \brief
+      - get the nearest hit of a ray on a run of slots (e.g. a leaf's)
+    \param ray
+      - world space ray to be cast
+    \param first
+      - first slot to be tested
+    \param last
+      - slot after the last to be tested
+    \param tMax
+      - farthest distance along the ray to be tested (hits must be nearer)
+    \return
+      - nearest hit, if any (else t = INf and index = u4_INVALID)
+    */
+    Hit Intersect(const Ray& ray, u4 first, u4 last, f4 tMax = INf) const;
+
+
+    /** Get the nearest hit of a ray on listed slots (e.g. query results)
+    \brief
+      - get the nearest hit of a ray on listed slots (e.g. query results)
+    \details
+      - listed slots are gathered into blocks of 8 first, so a run of slots
+      is faster tested by Intersect(const Ray&, u4, u4, f4)
+    \param ray
+      - world space ray to be cast
+    \param slots
+      - slots to be tested
+    \param listed
+      - number of slots listed
+    \param tMax
+      - farthest distance along the ray to be tested (hits must be nearer)
+    \return
+      - nearest hit, if any (else t = INf and index = u4_INVALID)
+    */
+    Hit Intersect(const Ray& ray, const u4* slots, u4 listed,
+      f4 tMax = INf) const;
+
+
+    /** Get each packet lane's nearest hit on a run of slots
+    \brief
+      - get each packet lane's nearest hit on a run of slots
+    \details
+      - each triangle is tested against all lanes at once; hits only
+      replace those nearer than each lane's given hit and Far()
+    \param packet
+      - world space rays to be cast, each over [0, its Far()]
+    \param first
+      - first slot to be tested
+    \param last
+      - slot after the last to be tested
+    \param hits
+      - LANES nearest hits so far (t = INf if none yet), to be updated
+    \return
+      - mask of active lanes whose hits were replaced by nearer ones
+    */
+    template <u4 LANES>
+    u4 Intersect(const RayPacket<LANES>& packet, u4 first, u4 last,
+      Hit* hits) const;
+
+
+    /** Check if a ray hits any triangle in a run of slots (for shadow rays)
+    \brief
+      - check if a ray hits any triangle in a run of slots (for shadow rays)
+    \param ray
+      - world space ray to be cast
+    \param first
+      - first slot to be tested
+    \param last
+      - slot after the last to be tested
+    \param tMax
+      - farthest distance along the ray to be tested (e.g. to the light)
+    \return
+      - true on the first hit found nearer than tMax
+    */
+    bool Occluded(const Ray& ray, u4 first, u4 last, f4 tMax = INf) const;
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Blocks of 8 triangles: 9 components (A, AB, AC by axis) x 8 lanes
+    std::vector<f4> block;
+
+    //! Triangle index as given to Build(), by slot
+    std::vector<u4> index;
+
+    //! Number of triangle slots filled
+    u4 count;
+
+  }; // end TriangleBatch class declaration
+
+} // end dp namespace
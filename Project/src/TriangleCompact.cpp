@@ -0,0 +1,191 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  TriangleCompact.cpp
+Purpose:  Triangle of only its 3 points, deriving any other term on demand
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// "./src/..."
+#include "AABB.h"             // bounding box in < <min>, <max> >; tests
+#include "BSphere.h"          // bounding sphere in < <center>, radius >; tests
+#include "Ray.h"              // edge rays / tested rays
+#include "Triangle.h"         // Full triangle conversions
+#include "TriangleCompact.h"  // Class interface declaration header
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::TriangleCompact::TriangleCompact(const v3f& a, const v3f& b,
+  const v3f& c)
+  : p{ a.Real(), b.Real(), c.Real() }
+{ } // end TriangleCompact(const v3f&, const v3f&, const v3f&)                */
+
+
+dp::TriangleCompact::TriangleCompact(const Triangle& source)
+  : p{ source.A(), source.B(), source.C() }
+{ } // end TriangleCompact(const Triangle&)                                   */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::v3f dp::TriangleCompact::Barycentrics(const v3f& point) const
+{
+  v3f bary; // barycentric coords u=:x, v=:y, gamma=:z;
+  v3f ab = AB(), area = ab.Cross(AC()); // Squared areas suffice mostly
+
+  bary.x = area.Dot(ab.Cross(point - p[0]));     // ABP : ABC area ratio
+  bary.y = area.Dot(BC().Cross(point - p[1]));   // BCP : ABC area ratio
+  bary.z = area.Dot(CA().Cross(point - p[2]));   // CAP : ABC area ratio
+
+  // Normalize
+  return (bary /= area.LengthSquared()).Sqrts();
+
+} // end v3f TriangleCompact::Barycentrics(const v3f&) const                  */
+
+
+dp::Triangle dp::TriangleCompact::Expand(void) const
+{
+  return Triangle(p[0], p[1], p[2]);
+
+} // end Triangle TriangleCompact::Expand(void) const                         */
+
+
+bool dp::TriangleCompact::In(const AABB& box) const
+{
+  // If box at least in radius of tri, either having an extremal point inside
+  if (!BSphere(Point0(), Radius()).IsIn(box)) { return false; }
+  if (box.IsIn(p[0]) || box.IsIn(p[1]) || box.IsIn(p[2])) { return true; }
+
+  // Or (if necessary): having any [0,edge length] t-scalar hit of the box
+  f4 t;
+  for (u4 i = 0u; i < 3u; ++i)
+  {
+    const v3f& from = p[i];
+    v3f edge = p[(i + 1u) % 3u] - from;
+    if (Ray(from, edge).IsIn(box, &t) && IsInF(t, edge.Length(), 0.0f))
+    {
+      return true;
+    }
+  }
+  return false;
+
+} // end bool TriangleCompact::In(const AABB&) const                          */
+
+
+bool dp::TriangleCompact::In(const BSphere& ball) const
+{
+  // If in radius of ball, either having an extremal point inside the ball
+  if (!BSphere(Point0(), Radius()).IsIn(ball)) { return false; }
+  if (ball.IsIn(p[0]) || ball.IsIn(p[1]) || ball.IsIn(p[2])) { return true; }
+
+  // Or (if necessary): having any [0,edge] length edge-ray ball intersection
+  f4 t;
+  for (u4 i = 0u; i < 3u; ++i)
+  {
+    const v3f& from = p[i];
+    v3f edge = p[(i + 1u) % 3u] - from;
+    if (Ray(from, edge).IsIn(ball, &t) && IsInF(t, edge.Length(), 0.0f))
+    {
+      return true;
+    }
+  }
+  return false;
+
+} // end bool TriangleCompact::In(const BSphere&) const                       */
+
+
+bool dp::TriangleCompact::In(const Plane& plane) const
+{
+  f4 dist = plane.Distance(p[0]);
+  if (AbsF(dist) > 2.0f * Radius()) { return false; }
+  bool initialSide = (dist > 0);
+  if ((plane.Distance(p[1]) > 0) != initialSide) { return true; }
+  return (plane.Distance(p[2]) > 0) != initialSide;
+
+} // end bool TriangleCompact::In(const Plane&) const                         */
+
+
+bool dp::TriangleCompact::In(const Ray& ray, f4* tDist) const
+{
+  // Solve origin + t*dir == A + u*<AB> + v*<AC>; det 0 (parallel) fails
+  const v3f& d = ray.Direction();
+  v3f e1 = AB(), e2 = AC();
+  v3f q = d.Cross(e2);
+  f4 inv = 1.0f / e1.Dot(q);
+
+  v3f s = ray.Origin() - p[0];
+  f4 u = s.Dot(q) * inv;
+  if (!(0.0f <= u && u <= 1.0f)) { return false; }
+
+  v3f r = s.Cross(e1);
+  f4 v = d.Dot(r) * inv;
+  if (!(0.0f <= v && u + v <= 1.0f)) { return false; }
+
+  f4 t = e2.Dot(r) * inv;
+  if (!(0.0f <= t)) { return false; }
+  if (tDist) { *tDist = t; }
+  return true;
+
+} // end bool TriangleCompact::In(const Ray&, f4*) const                      */
+
+
+bool dp::TriangleCompact::In(const TriangleCompact& other) const
+{
+  f4 radii = Radius() + other.Radius(); // Check centroid/centroid distance
+  if (!(DistSq(Point0(), other.Point0()) < radii * radii)) { return false; }
+
+  // Per edge (as rays), check their finite lengths against other's plane
+  // Then if so, that edge-ray falls within other's subregion of that plane
+  Plane oPlane = other.ContainingPlane();
+  for (u4 i = 0u; i < 3u; ++i)
+  {
+    const v3f& from = p[i];
+    v3f edge = p[(i + 1u) % 3u] - from;
+    Ray side(from, edge);
+    if (IsInF(side.Distance(oPlane), edge.Length(), 0.0f) && other.In(side))
+    {
+      return true;
+    }
+  }
+  return false;
+
+} // end bool TriangleCompact::In(const TriangleCompact&) const               */
+
+
+f4 dp::TriangleCompact::Radius(void) const
+{
+  v3f centroid = Point0();
+  return SqrtF(MaxF(MaxF(DistSq(centroid, p[0]), DistSq(centroid, p[1])),
+    DistSq(centroid, p[2])));
+
+} // end f4 TriangleCompact::Radius(void) const                               */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+bool dp::TriangleCompact::BarycentricIn(const v3f& point) const
+{
+  v3f ab = AB(), area = ab.Cross(AC()); // Squared area suffices; cancels
+
+  // P right of <AB>, <BC> or <CA> is outside
+  if (area.Dot(ab.Cross(point - p[0])) < 0) { return false; }
+  if (area.Dot(BC().Cross(point - p[1])) < 0) { return false; }
+  return 0.0f <= area.Dot(CA().Cross(point - p[2]));
+
+} // end bool TriangleCompact::BarycentricIn(const v3f&) const                */
@@ -0,0 +1,333 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  TriangleCompact.h
+Purpose:  Triangle of only its 3 points, deriving any other term on demand
+Details:  Triangle caches its centroid, 4 unit edges / normal and 6 lengths:
+  120 bytes for what 36 bytes of points define.  Large meshes' triangles are
+  kept here instead (e.g. in hierarchy leaves or batch kernels), at 3.3x the
+  triangles per cache line, with the same In() tests; each test derives only
+  the terms it reads.  Expand() gives a full Triangle where a caller wants
+  the cached terms for many tests of the same triangle.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// "./src/..."
+#include "Plane.h"  // Containing plane, derived from the points
+#include "v3f.h"    // Defining members: 3 points of <x,y,z> values
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class AABB;     // Bounding box with <min, max>; intersection tests
+  class BSphere;  // Bounding sphere <center, radius>, for collision tests
+  class Ray;      // Point shot in a direction, for intersection tests
+  class Triangle; // Full triangle, caching derived terms
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! TriangleCompact: 3 points, every other term derived when tested
+  class TriangleCompact
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create a TriangleCompact from a set of 3 world coords
+    \brief
+      - create a TriangleCompact from a set of 3 world coords
+    \details
+      - points are kept as given: unlike Triangle, colinear points are not
+      moved apart, and a degenerate triangle is hit by no ray
+    \param a
+      - world space coord representing the 1st triangle point
+    \param b
+      - world space coord representing the 2nd triangle point
+    \param c
+      - world space coord representing the 3rd triangle point
+    */
+    TriangleCompact(const v3f& a = nullv3f, const v3f& b = X_HAT,
+      const v3f& c = Y_HAT);
+
+
+    /** Create a TriangleCompact from the points of a full Triangle
+    \brief
+      - create a TriangleCompact from the points of a full Triangle
+    \param source
+      - triangle whose points are to be copied
+    */
+    explicit TriangleCompact(const Triangle& source);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Access triangle's 1st point's cartesian 3D world coordinates
+    \brief
+      - access triangle's 1st point's cartesian 3D world coordinates
+    \return
+      - reference to contained <x,y,z> world coordinate of triangle's 1st point
+    */
+    inline const v3f& A(void) const
+    { return p[0]; } // end const v3f& TriangleCompact::A(void) const         */
+
+
+    /** Get triangle's edge distance(A, B) vector in world coords
+    \brief
+      - get triangle's edge distance(A, B) vector in world coords
+    \return
+      - world scale triangle point displacement from (A) to (B)
+    */
+    inline v3f AB(void) const
+    { return p[1] - p[0]; } // end v3f TriangleCompact::AB(void) const        */
+
+
+    /** Get triangle's edge distance(A, C) vector in world coords
+    \brief
+      - get triangle's edge distance(A, C) vector in world coords
+    \return
+      - world scale triangle point displacement from (A) to (C)
+    */
+    inline v3f AC(void) const
+    { return p[2] - p[0]; } // end v3f TriangleCompact::AC(void) const        */
+
+
+    /** Get triangular, world scale area of this triangle
+    \brief
+      - get triangular, world scale area of this triangle
+    \return
+      - world scale 2D area demarcated within this triangle's points
+    */
+    inline f4 Area(void) const
+    {
+      return AB().Cross(AC()).Length() * AHALF;
+    } // end f4 TriangleCompact::Area(void) const                             */
+
+
+    /** Access triangle's 2nd point's cartesian 3D world coordinates
+    \brief
+      - access triangle's 2nd point's cartesian 3D world coordinates
+    \return
+      - reference to contained <x,y,z> world coordinate of triangle's 2nd point
+    */
+    inline const v3f& B(void) const
+    { return p[1]; } // end const v3f& TriangleCompact::B(void) const         */
+
+
+    /** Get barycentric coordinates of a given point relative to this triangle
+    \brief
+      - get barycentric coordinates of a given point relative to this triangle
+    \param point
+      - world space coordinate, in (or projected onto) the triangle plane
+    \return
+      - barycentric coords of point in <u=:x,v=:y,gamma=:z> of tri point ratios
+    */
+    v3f Barycentrics(const v3f& point) const;
+
+
+    /** Get triangle's edge distance(B, C) vector in world coords
+    \brief
+      - get triangle's edge distance(B, C) vector in world coords
+    \return
+      - world scale triangle point displacement from (B) to (C)
+    */
+    inline v3f BC(void) const
+    { return p[2] - p[1]; } // end v3f TriangleCompact::BC(void) const        */
+
+
+    /** Access triangle's 3rd point's cartesian 3D world coordinates
+    \brief
+      - access triangle's 3rd point's cartesian 3D world coordinates
+    \return
+      - reference to contained <x,y,z> world coordinate of triangle's 3rd point
+    */
+    inline const v3f& C(void) const
+    { return p[2]; } // end const v3f& TriangleCompact::C(void) const         */
+
+
+    /** Get triangle's edge distance(C, A) vector in world coords
+    \brief
+      - get triangle's edge distance(C, A) vector in world coords
+    \return
+      - world scale triangle point displacement from (C) to (A)
+    */
+    inline v3f CA(void) const
+    { return p[0] - p[2]; } // end v3f TriangleCompact::CA(void) const        */
+
+
+    /** Get plane containing any barycentric combination of triangle points
+    \brief
+      - get plane containing any barycentric combination of triangle points
+    \return
+      - plane with triangle normal, using a point from the triangle for sum
+    */
+    inline Plane ContainingPlane(void) const
+    {
+      v3f n = Normal();
+      return Plane(n, n.Dot(p[0]));
+    } // end Plane TriangleCompact::ContainingPlane(void) const               */
+
+
+    /** Get a full Triangle of these points, caching all derived terms
+    \brief
+      - get a full Triangle of these points, caching all derived terms
+    \return
+      - Triangle of (A), (B), (C)
+    */
+    Triangle Expand(void) const;
+
+
+    /** Get whether a bounding box is inside this triangle's extents
+    \brief
+      - get whether a bounding box is inside this triangle's extents
+    \param box
+      - bounding box to be evaluated against this for boolean intersection
+    \return
+      - true if any triangle extrema (point or edge length) is inside the box
+    */
+    bool In(const AABB& box) const;
+
+
+    /** Get whether a bounding sphere is inside this triangle's extents
+    \brief
+      - get whether a bounding sphere is inside this triangle's extents
+    \param ball
+      - bounding sphere to be evaluated against this for boolean intersection
+    \return
+      - true if any triangle extrema (point or edge length) is inside the ball
+    */
+    bool In(const BSphere& ball) const;
+
+
+    /** Get whether a plane is inside this triangle's extents
+    \brief
+      - get whether a plane is inside this triangle's extents
+    \param plane
+      - boundary to be evaluated against this triangle for boolean intersection
+    \return
+      - true if any tri extrema are on opposite plane side from each other
+    */
+    bool In(const Plane& plane) const;
+
+
+    /** Get whether a ray is intersecting with this triangle
+    \brief
+      - get whether a ray is intersecting with this triangle
+    \details
+      - Moller-Trumbore: needs no normal, plane or unit edges
+    \param ray
+      - point shot in a direction to evaluate for intersection against this tri
+    \param tDist
+      - optional pass-in for the distance along the ray of the hit
+    \return
+      - true if the ray hits the triangle at a distance of 0 or more
+    */
+    bool In(const Ray& ray, f4* tDist = nullptr) const;
+
+
+    /** Get whether another triangle is intersecting with this triangle
+    \brief
+      - get whether another triangle is intersecting with this triangle
+    \details
+      - triangle edges are extremal, not just vertices
+    \param other
+      - triangle to evaluate for intersection against this triangle
+    \return
+      - true if any of other's extrema intersect this triangle within its plane
+    */
+    bool In(const TriangleCompact& other) const;
+
+
+    /** Get whether a point is within the triangle's plane and extents
+    \brief
+      - get whether a point is within the triangle's plane and extents
+    \param point
+      - world space coordinate to be evaluated for intersection with triangle
+    \param proximity
+      - tolerance of point planarity: half of triangle's intended prism height
+    \return
+      - true only if point is near the triangle plane and between edge extents
+    */
+    inline bool In(const v3f& point, f4 proximity = _INf) const
+    {
+      return ContainingPlane().IsIn(point, proximity) && BarycentricIn(point);
+    } // end bool TriangleCompact::In(const v3f&, f4) const                   */
+
+
+    /** Get unit vector of triangle plane normal (perpendicular direction)
+    \brief
+      - get unit vector of triangle plane normal (perpendicular direction)
+    \return
+      - unit vector of <AB> x <AC>, perpendicular the plane of this triangle
+    */
+    inline v3f Normal(void) const
+    { return AB().Cross(AC()).UnitVec(); } // end v3f Normal(void) const      */
+
+
+    /** Get triangle's centroid point's cartesian 3D world coordinates
+    \brief
+      - get triangle's centroid point's cartesian 3D world coordinates
+    \return
+      - world coordinate of the mean of the triangle's points
+    */
+    inline v3f Point0(void) const
+    {
+      return (p[0] + p[1] + p[2]) * ATHIRD;
+    } // end v3f TriangleCompact::Point0(void) const                          */
+
+
+    /** Get distance from the centroid to the farthest triangle point
+    \brief
+      - get distance from the centroid to the farthest triangle point
+    \return
+      - radius of the centroid sphere bounding the triangle
+    */
+    f4 Radius(void) const;
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Methods                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get if barycentric coords of point (in plane) in triangle [0,1] bounds
+    \brief
+      - get if barycentric coords of point (in plane) in triangle [0,1] bounds
+    \param point
+      - point already known to be in triangle plane, to be tested with bounds
+    \return
+      - true if the barycentric values of point are each in [0,1] and sum to 1
+    */
+    bool BarycentricIn(const v3f& point) const;
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Triangle's world coordinates of points < (A), (B), (C) >
+    v3f p[3];
+
+  }; // end TriangleCompact class declaration
+
+  // Assurance that memory footprint is only the points, as intended
+  static_assert(sizeof(TriangleCompact) == 36, "TriangleCompact not packed");
+
+} // end dp namespace
@@ -16,12 +16,207 @@ written consent of DigiPen Institute of Technology is prohibited.
 /*                                  Includes                                  */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
+#include <cstring>  // memcpy of rounded quarter turns' low bits to quadrant
 #include <sstream>  // string stream to control output precision
 #include "ang.h"    // unit semantic wrapped 4-byte datum of angles for trig
 #include "Log.h"
 #include "v2f.h"    // paired float point data container (pass-in values, etc)
 #include "Value.h"  // function declaration header file
 
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace
+{
+  //! Trig results a span pass writes out (bit flags)
+  enum TrigOut : u1 { SIN_OUT = 1u, COS_OUT = 2u, TAN_OUT = 4u };
+
+  //! Radians past which floats are over a unit apart: left to the math lib
+  constexpr f4 TRIG_REDUCE_MAX = 16777216.0f;
+
+  //! Quarter turns per radian (2 / pi), finding the nearest quadrant
+  constexpr f8 QUARTER_PER_RAD = 0.63661977236758134308;
+
+  //! Radians per quarter turn (pi / 2) to 28 bits: exact times any quadrant
+  constexpr f8 RAD_PER_QUARTER_HI = 1.570796325802803;
+
+  //! Radians per quarter turn (pi / 2) past the first 28 bits
+  constexpr f8 RAD_PER_QUARTER_LO = 9.920935796805404e-10;
+
+  //! 1.5 * 2^52: adding then subtracting rounds an f8 to the nearest integer
+  constexpr f8 ROUND_D = 6755399441055744.0;
+
+  /** Reduce radians to within [-pi/4, pi/4] of the nearest quarter turn
+  \brief
+    - reduce radians to within [-pi/4, pi/4] of the nearest quarter turn
+  \details
+    - done in 8 bytes with pi / 2 split in 2, so angles near multiples of it
+    keep their precision up to 2^24 radians: branchless, to vectorize spans
+  \param radians
+    - angle to be reduced
+  \param quarter
+    - destination of the quarter turns taken off (only low 2 bits matter)
+  \return
+    - remaining radians in [-pi/4, pi/4]
+  */
+  inline f4 Reduce(f4 radians, u4& quarter)
+  {
+    f8 turns = static_cast<f8>(radians) * QUARTER_PER_RAD + ROUND_D;
+    u8 bits;
+    std::memcpy(&bits, &turns, sizeof(bits));
+    quarter = static_cast<u4>(bits); // integer part in the low mantissa bits
+    turns -= ROUND_D;
+    return static_cast<f4>((static_cast<f8>(radians) - turns
+      * RAD_PER_QUARTER_HI) - turns * RAD_PER_QUARTER_LO);
+
+  } // end f4 Reduce(f4, u4&)                                                 */
+
+
+  /** Sine & cosine of reduced radians in [-pi/4, pi/4] by minimax polynomial
+  \brief
+    - sine & cosine of reduced radians in [-pi/4, pi/4] by minimax polynomial
+  \details
+    - Fast fits sin(x)/x to degree 4 & cos to 6; Fine to degree 6 & 8
+  \param r
+    - reduced radians
+  \param sine
+    - destination of the reduced angle's sine
+  \param cosine
+    - destination of the reduced angle's cosine
+  */
+  template <TrigULP BUDGET>
+  inline void SinCosPoly(f4 r, f4& sine, f4& cosine)
+  {
+    f4 z = r * r;
+    if (BUDGET == TrigULP::Fast)
+    {
+      sine = r + r * z * (-1.666294002e-1f + z * 8.151570955e-3f);
+      cosine = 1.0f + z * (-4.999989234e-1f + z * (4.165560070e-2f
+        + z * -1.358584389e-3f));
+    }
+    else
+    {
+      sine = r + r * z * (-1.666665467e-1f + z * (8.332100953e-3f
+        + z * -1.950396313e-4f));
+      cosine = 1.0f + z * (-0.5f + z * (4.166662270e-2f
+        + z * (-1.388668323e-3f + z * 2.437988031e-5f)));
+    }
+
+  } // end void SinCosPoly<TrigULP>(f4, f4&, f4&)                             */
+
+
+  /** Sine & cosine of any (<= 2^24) radians: rotate reduced results by quadrant
+  \brief
+    - sine & cosine of any (<= 2^24) radians: rotate reduced results by quadrant
+  \param radians
+    - angle to get the sine & cosine of
+  \param sine
+    - destination of the angle's sine
+  \param cosine
+    - destination of the angle's cosine
+  */
+  template <TrigULP BUDGET>
+  inline void SinCosQuadrant(f4 radians, f4& sine, f4& cosine)
+  {
+    u4 quarter;
+    f4 s, c;
+    SinCosPoly<BUDGET>(Reduce(radians, quarter), s, c);
+    // Each quarter turn maps (s, c) -> (c, -s): odd swap, then sign by half
+    f4 y = (quarter & 1u) ? c : s;
+    f4 x = (quarter & 1u) ? s : c;
+    sine = (quarter & 2u) ? -y : y;
+    cosine = ((quarter + 1u) & 2u) ? -x : x;
+
+  } // end void SinCosQuadrant<TrigULP>(f4, f4&, f4&)                         */
+
+
+  /** Write the requested trig results of each angle in a span
+  \brief
+    - write the requested trig results of each angle in a span
+  \details
+    - the polynomial pass is branchless so it can vectorize; angles the
+    reduction can't take (huge or inf) are redone with the math lib after
+  \param angles
+    - first of count angles
+  \param count
+    - number of angles
+  \param sines
+    - first of count sine destinations (if OUT has SIN_OUT)
+  \param cosines
+    - first of count cosine destinations (if OUT has COS_OUT)
+  \param tangents
+    - first of count tangent destinations (if OUT has TAN_OUT)
+  */
+  template <TrigULP BUDGET, u1 OUT>
+  void TrigSpan(const dp::ang* angles, u4 count, f4* sines, f4* cosines,
+    f4* tangents)
+  {
+    if (BUDGET != TrigULP::Exact)
+    {
+      u4 wide = 0u; // u4, as or-ing bools would stop vectorization
+      for (u4 i = 0u; i < count; ++i)
+      {
+        f4 radians = angles[i].radRef(), s, c;
+        wide |= static_cast<u4>(AbsF(radians) > TRIG_REDUCE_MAX);
+        SinCosQuadrant<BUDGET>(radians, s, c);
+        if (OUT & SIN_OUT) { sines[i] = s; }
+        if (OUT & COS_OUT) { cosines[i] = c; }
+        if (OUT & TAN_OUT) { tangents[i] = s / c; }
+      }
+      if (!wide) { return; }
+    }
+    for (u4 i = 0u; i < count; ++i)
+    {
+      f8 radians = static_cast<f8>(angles[i].radRef());
+      if (BUDGET != TrigULP::Exact
+        && !(AbsF(angles[i].radRef()) > TRIG_REDUCE_MAX)) { continue; }
+      if (OUT & SIN_OUT) { sines[i] = static_cast<f4>(sin(radians)); }
+      if (OUT & COS_OUT) { cosines[i] = static_cast<f4>(cos(radians)); }
+      if (OUT & TAN_OUT) { tangents[i] = static_cast<f4>(tan(radians)); }
+    }
+
+  } // end void TrigSpan<TrigULP, u1>(const ang*, u4, f4*, f4*, f4*)          */
+
+
+  /** Write the requested trig results of each angle in a span, by budget
+  \brief
+    - write the requested trig results of each angle in a span, by budget
+  \param angles
+    - first of count angles
+  \param count
+    - number of angles
+  \param sines
+    - first of count sine destinations (if OUT has SIN_OUT)
+  \param cosines
+    - first of count cosine destinations (if OUT has COS_OUT)
+  \param tangents
+    - first of count tangent destinations (if OUT has TAN_OUT)
+  \param budget
+    - accuracy allowance selecting the polynomials (or the math lib)
+  */
+  template <u1 OUT>
+  void TrigSpan(const dp::ang* angles, u4 count, f4* sines, f4* cosines,
+    f4* tangents, TrigULP budget)
+  {
+    if (!angles || !count) { return; }
+    switch (budget)
+    {
+    case TrigULP::Exact:
+      TrigSpan<TrigULP::Exact, OUT>(angles, count, sines, cosines, tangents);
+      break;
+    case TrigULP::Fast:
+      TrigSpan<TrigULP::Fast, OUT>(angles, count, sines, cosines, tangents);
+      break;
+    default:
+      TrigSpan<TrigULP::Fine, OUT>(angles, count, sines, cosines, tangents);
+      break;
+    }
+
+  } // end void TrigSpan<u1>(const ang*, u4, f4*, f4*, f4*, TrigULP)          */
+
+} // end anonymous namespace
+
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 /*                        Public Function Definitions                         */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -157,8 +352,21 @@ s4 CeilF(f4 value)
 } // end s4 CeilF(f4)                                                         */
 
 
-f4 CosF(dp::ang angle)
-{ return static_cast<f4>(cos(angle.rM())); } // end f4 CosF(ang)              */
+f4 CosF(dp::ang angle, TrigULP budget)
+{
+  f4 cosine;
+  TrigSpan<COS_OUT>(&angle, 1u, nullptr, &cosine, nullptr, budget);
+  return cosine;
+
+} // end f4 CosF(ang, TrigULP)                                                */
+
+
+void CosF(const dp::ang* angles, u4 count, f4* cosines, TrigULP budget)
+{
+  if (!cosines) { return; }
+  TrigSpan<COS_OUT>(angles, count, nullptr, cosines, nullptr, budget);
+
+} // end void CosF(const ang*, u4, f4*, TrigULP)                              */
 
 
 s8 FloorD(const f8& value)
@@ -294,8 +502,37 @@ std::string SciF(f4 val)
 } // end std::string SciF(f4)                                                 */
 
 
-f4 SinF(dp::ang angle)
-{ return static_cast<f4>(sin(angle.rM())); } // end f4 SinF(ang)              */
+void SinCosF(dp::ang angle, f4& sine, f4& cosine, TrigULP budget)
+{
+  TrigSpan<SIN_OUT | COS_OUT>(&angle, 1u, &sine, &cosine, nullptr, budget);
+
+} // end void SinCosF(ang, f4&, f4&, TrigULP)                                 */
+
+
+void SinCosF(const dp::ang* angles, u4 count, f4* sines, f4* cosines,
+  TrigULP budget)
+{
+  if (!sines || !cosines) { return; }
+  TrigSpan<SIN_OUT | COS_OUT>(angles, count, sines, cosines, nullptr, budget);
+
+} // end void SinCosF(const ang*, u4, f4*, f4*, TrigULP)                      */
+
+
+f4 SinF(dp::ang angle, TrigULP budget)
+{
+  f4 sine;
+  TrigSpan<SIN_OUT>(&angle, 1u, &sine, nullptr, nullptr, budget);
+  return sine;
+
+} // end f4 SinF(ang, TrigULP)                                                */
+
+
+void SinF(const dp::ang* angles, u4 count, f4* sines, TrigULP budget)
+{
+  if (!sines) { return; }
+  TrigSpan<SIN_OUT>(angles, count, sines, nullptr, nullptr, budget);
+
+} // end void SinF(const ang*, u4, f4*, TrigULP)                              */
 
 
 std::string StrB(u1 value)
@@ -376,5 +613,90 @@ std::string StrUS(u2 value)
 } // end std::string StrUS(u2)                                                */
 
 
-f4 TanF(dp::ang angle)
-{ return static_cast<f4>(tan(angle.rM())); } // end f4 TanF(ang)              */
+f4 TanF(dp::ang angle, TrigULP budget)
+{
+  f4 tangent;
+  TrigSpan<TAN_OUT>(&angle, 1u, nullptr, nullptr, &tangent, budget);
+  return tangent;
+
+} // end f4 TanF(ang, TrigULP)                                                */
+
+
+void TanF(const dp::ang* angles, u4 count, f4* tangents, TrigULP budget)
+{
+  if (!tangents) { return; }
+  TrigSpan<TAN_OUT>(angles, count, nullptr, nullptr, tangents, budget);
+
+} // end void TanF(const ang*, u4, f4*, TrigULP)                              */
+
+
+u4 TrigCheck(TrigULP budget, u4 samples, f8* ulp, f8* error)
+{
+  // Fixed seed linear congruential generator: repeatable runs to compare
+  u4 seed = 0x2545F491u;
+  auto random = [&seed](void)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    return static_cast<f8>(seed >> 8) * (1.0 / 16777216.0);
+  };
+
+  std::vector<dp::ang> angles;
+  angles.reserve(samples + 2u * 21u);
+  for (u4 i = 0u; i < samples; ++i)
+  {
+    f8 radians = (i & 1u) ? std::pow(10.0, random() * (std::log10(16777216.0)
+      + 4.0) - 4.0) : (random() - 0.5) * 8.0 * PI;
+    radians = (random() < 0.5) ? -radians : radians;
+    angles.push_back(dp::ang(static_cast<f4>(radians), dp::arc::radians));
+  }
+  for (u4 k = 1u; k <= (1u << 20u); k <<= 1u) // Where reductions go wrong
+  {
+    for (u4 odd = 0u; odd < 2u; ++odd)
+    {
+      f8 radians = static_cast<f8>(k + odd) * (PI * 0.5);
+      angles.push_back(dp::ang(static_cast<f4>(radians), dp::arc::radians));
+    }
+  }
+
+  u4 count = static_cast<u4>(angles.size());
+  std::vector<f4> sines(count), cosines(count), tangents(count);
+  SinCosF(angles.data(), count, sines.data(), cosines.data(), budget);
+  TanF(angles.data(), count, tangents.data(), budget);
+
+  // Units in the last place: error over the float spacing at the result
+  auto ulps = [](f4 value, f8 exact)
+  {
+    f8 size = MaxD(AbsD(exact), std::numeric_limits<f4>::min());
+    return AbsD(static_cast<f8>(value) - exact)
+      / std::ldexp(1.0, std::ilogb(size) - 23);
+  };
+
+  f8 sinCosULP = (budget == TrigULP::Exact) ? 1.0 : 2.0;
+  f8 tanULP = (budget == TrigULP::Exact) ? 1.0 : 4.0;
+  u4 failures = 0u;
+  f8 worstULP = 0.0, worstError = 0.0;
+  for (u4 i = 0u; i < count; ++i)
+  {
+    f8 radians = static_cast<f8>(angles[i].radRef());
+    f8 s = sin(radians), c = cos(radians), t = tan(radians);
+    f8 sError = AbsD(sines[i] - s), cError = AbsD(cosines[i] - c);
+    f8 sULP = ulps(sines[i], s), cULP = ulps(cosines[i], c);
+    f8 tULP = ulps(tangents[i], t);
+    worstError = MaxD(worstError, MaxD(sError, cError));
+    worstULP = MaxD(worstULP, MaxD(MaxD(sULP, cULP), tULP));
+    if (budget == TrigULP::Fast)
+    {
+      failures += (2e-6 < sError || 2e-6 < cError) ? 1u : 0u;
+    }
+    else
+    {
+      failures += (sinCosULP < sULP || sinCosULP < cULP || tanULP < tULP)
+        ? 1u : 0u;
+    }
+  }
+
+  if (ulp) { *ulp = worstULP; }
+  if (error) { *error = worstError; }
+  return failures;
+
+} // end u4 TrigCheck(TrigULP, u4, f8*, f8*)                                  */
@@ -873,11 +873,22 @@ enum class uGrp
 }; // end uGrp enum                                                           */
 
 
+//! Float trig accuracy budgets: worst error vs correctly rounded results
+enum class TrigULP
+{
+  Exact,  //! Promote to 8-byte & use the math library (<= 1 ULP, slowest)
+  Fine,   //! Float minimax polynomials (<= 2 ULP, tan <= 4 ULP)
+  Fast,   //! Short float minimax polynomials (<= 2e-6 absolute error)
+
+}; // end TrigULP enum                                                        */
+
+
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 /*                          Public Static Variables                           */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
 static OFlow DEFAULT_OFLOW_POLICY = OFlow::Wrap;
+static TrigULP DEFAULT_TRIG_ULP = TrigULP::Fine;
 
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 /*                        Public Functions Declarations                       */
@@ -896,6 +907,19 @@ static OFlow DEFAULT_OFLOW_POLICY = OFlow::Wrap;
 inline OFlow OFlowPolicy(OFlow* policyPreference = nullptr);
 
 
+/** Get (and/or set) the default accuracy budget for float trig functions
+\brief
+  - get (and/or set) the default accuracy budget for float trig functions
+\details
+  - inline will be ignored for a function with static values, just the pattern
+\param budgetPreference
+  - pointer to a trig accuracy budget, which, if provided, becomes default
+\return
+  - current (or newly set), default trig accuracy budget declared
+*/
+inline TrigULP TrigPolicy(TrigULP* budgetPreference = nullptr);
+
+
 /** Get the magnitude / absolute value of a 1-byte integer value
 \brief
   - get the magnitude / absolute value of a 1-byte integer value
@@ -1368,10 +1392,28 @@ s4 CeilF(f4 value);
   - get the cosine (x-axis measure of tri adj./hyp.) for input 2D angle of arc
 \param angle
   - arc sweep from 0 point in the x-axis of the XY plane, counter-clockwise
+\param budget
+  - accuracy allowance: less precision needs shorter polynomials
 \return
   - right triangle base [0,1] x-axis scale, with angle as hypoteneuse length 1
 */
-f4 CosF(dp::ang angle);
+f4 CosF(dp::ang angle, TrigULP budget = TrigPolicy());
+
+
+/** Get the cosines of a list of 2D angles of arc
+\brief
+  - get the cosines of a list of 2D angles of arc
+\param angles
+  - first of the arc sweeps from 0 point in the x-axis of the XY plane, ccw
+\param count
+  - number of angles to get the cosines of
+\param cosines
+  - first of count destination values for each angle's cosine
+\param budget
+  - accuracy allowance: less precision needs shorter polynomials
+*/
+void CosF(const dp::ang* angles, u4 count, f4* cosines,
+  TrigULP budget = TrigPolicy());
 
 
 /** Extract the exponentiation bitfield value from the current double value
@@ -5426,10 +5468,62 @@ inline bool SetUpUS(u2& set, u2 to, OFlow policy = OFlowPolicy());
   - get the sine (y-axis measure of tri opp./hyp.) for input 2D angle of arc
 \param angle
   - arc sweep from 0 point in the x-axis of the XY plane, counter-clockwise
+\param budget
+  - accuracy allowance: less precision needs shorter polynomials
 \return
   - right triangle height [0,1] y-axis size, with angle as hypoteneuse length 1
 */
-f4 SinF(dp::ang angle);
+f4 SinF(dp::ang angle, TrigULP budget = TrigPolicy());
+
+
+/** Get the sines of a list of 2D angles of arc
+\brief
+  - get the sines of a list of 2D angles of arc
+\param angles
+  - first of the arc sweeps from 0 point in the x-axis of the XY plane, ccw
+\param count
+  - number of angles to get the sines of
+\param sines
+  - first of count destination values for each angle's sine
+\param budget
+  - accuracy allowance: less precision needs shorter polynomials
+*/
+void SinF(const dp::ang* angles, u4 count, f4* sines,
+  TrigULP budget = TrigPolicy());
+
+
+/** Get both the sine & cosine of a 2D angle of arc, sharing the reduction
+\brief
+  - get both the sine & cosine of a 2D angle of arc, sharing the reduction
+\param angle
+  - arc sweep from 0 point in the x-axis of the XY plane, counter-clockwise
+\param sine
+  - destination of the angle's sine: y-axis size of the unit hypoteneuse
+\param cosine
+  - destination of the angle's cosine: x-axis size of the unit hypoteneuse
+\param budget
+  - accuracy allowance: less precision needs shorter polynomials
+*/
+void SinCosF(dp::ang angle, f4& sine, f4& cosine,
+  TrigULP budget = TrigPolicy());
+
+
+/** Get both the sines & cosines of a list of 2D angles of arc
+\brief
+  - get both the sines & cosines of a list of 2D angles of arc
+\param angles
+  - first of the arc sweeps from 0 point in the x-axis of the XY plane, ccw
+\param count
+  - number of angles to get the sines & cosines of
+\param sines
+  - first of count destination values for each angle's sine
+\param cosines
+  - first of count destination values for each angle's cosine
+\param budget
+  - accuracy allowance: less precision needs shorter polynomials
+*/
+void SinCosF(const dp::ang* angles, u4 count, f4* sines, f4* cosines,
+  TrigULP budget = TrigPolicy());
 
 
 /** Calculate the square root of a given input float point value
@@ -6057,10 +6151,52 @@ inline void SwapIfUS(u2& a, u2& b, bool given);
   - get the tangent (slope measure of tri opp./adj.) for input 2D angle of arc.
 \param angle
   - arc sweep from 0 point in the x-axis of the XY plane, counter-clockwise
+\param budget
+  - accuracy allowance: less precision needs shorter polynomials
 \return
   - right triangle slope ratio: y/x; rise/run; sin(t)/cos(t); opposite/adjacent
 */
-f4 TanF(dp::ang angle);
+f4 TanF(dp::ang angle, TrigULP budget = TrigPolicy());
+
+
+/** Get the tangents of a list of 2D angles of arc
+\brief
+  - get the tangents of a list of 2D angles of arc
+\param angles
+  - first of the arc sweeps from 0 point in the x-axis of the XY plane, ccw
+\param count
+  - number of angles to get the tangents of
+\param tangents
+  - first of count destination values for each angle's tangent
+\param budget
+  - accuracy allowance: less precision needs shorter polynomials
+*/
+void TanF(const dp::ang* angles, u4 count, f4* tangents,
+  TrigULP budget = TrigPolicy());
+
+
+/** Count float trig results outside their budget versus the 8-byte math lib
+\brief
+  - count float trig results outside their budget versus the 8-byte math lib
+\details
+  - fixed seed angles: half within 2 turns of 0, half of magnitudes spread
+  evenly in log from 1e-4 to 2^24 radians (where the polynomials hand off
+  to the math lib), plus multiples of pi/2 up to 2^20 of them.  Sine and
+  cosine are held to 1 ULP (Exact), 2 ULP (Fine) or 2e-6 (Fast); tangent to
+  1 or 4 ULP (Fast tangent, poor near the poles, is only reported)
+\param budget
+  - accuracy allowance of the polynomials to be checked
+\param samples
+  - count of random angles to check
+\param ulp
+  - most units in the last place off found (sine, cosine & tangent)
+\param error
+  - most absolute error found (sine & cosine)
+\return
+  - number of results outside the budget
+*/
+u4 TrigCheck(TrigULP budget = TrigULP::Fine, u4 samples = 1000000u,
+  f8* ulp = nullptr, f8* error = nullptr);
 
 
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -6075,6 +6211,14 @@ inline OFlow OFlowPolicy(OFlow* policyPreference)
 } // end OFlow OFlowPolicy(OFlow*)                                            */
 
 
+inline TrigULP TrigPolicy(TrigULP* budgetPreference)
+{
+  static TrigULP budget = DEFAULT_TRIG_ULP;
+  if (budgetPreference) { budget = *budgetPreference; }
+  return budget;
+} // end TrigULP TrigPolicy(TrigULP*)                                         */
+
+
 inline s1 AbsC(s1 value)
 { return MaxC(value, -value); } // end s1 AbsI(s1)                            */
 inline f8 AbsD(const f8& value)
@@ -7411,7 +7555,7 @@ inline bool SetAddUS(u2& current, u2 plus, OFlow policy)
 template <class T> inline T& SetIn(T& value, const T& max, const T& min)
 {
   return (value =  In<T>(value, max, min));
-} // end <T>& SetIn<T>(<T>&, const <T>&, const <T>&)                       */
+} // end <T>& SetIn<T>(<T>&, const <T>&, const <T>&)                          */
 inline u1& SetInB(u1& value, u1 max, u1 min)
 {
   return (value =  InB(value, max, min));
@@ -7777,11 +7921,11 @@ inline u8& SetIfUL(u8& set, const u8& to, bool given)
 inline um& SetIfUM(um& set, um to, bool given)
 {
   return set = IfOrUM(to, set, given); // given? 1*to + 0*set : 0*to + 1*set
-} // end um& SetIfUM(um&, um, bool)                                            */
+} // end um& SetIfUM(um&, um, bool)                                           */
 inline u2& SetIfUS(u2& set, u2 to, bool given)
 {
   return set = IfOrUS(to, set, given); // given? 1*to + 0*set : 0*to + 1*set
-} // end u2& SetIfUS(u2&, u2, bool)                                            */
+} // end u2& SetIfUS(u2&, u2, bool)                                           */
 
 
 template<class T> inline bool SetIfP(T* set, const T& to, bool given)
@@ -0,0 +1,353 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  cellNf.cpp
+Purpose:  Aligned, column major cell storage & blocked kernels for N-D matrices
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_MAT300_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <std>
+#include <cstring>      // memcpy / memset of whole columns
+#include <string>       // Allocation failure message
+#include <xmmintrin.h>  // SSE 4-wide float lanes, aligned allocation
+#if defined(__AVX__)
+#include <immintrin.h>  // AVX 8-wide float lanes
+#endif
+
+// "./src/..."
+#include "cellNf.h" // Class declaration header
+#include "Log.h"    // Allocation failure output
+#include "Value.h"  // Min / max of sizes
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace
+{
+  //! Byte alignment of every allocation (and so every column): an AVX lane
+  constexpr size_t ALIGN = 32u;
+
+  //! Columns of the left matrix per panel: the panel's rows stay in L2
+  constexpr u4 PANEL = 256u;
+
+  //! Rows per block of the product: 2 KB of product stays in L1
+  constexpr u4 ROWS = 512u;
+
+  //! Product columns summed at once (each a register of accumulators)
+  constexpr u4 TILE = 4u;
+
+  //! Rows & columns per tile of a cache-blocked transpose
+  constexpr u4 SWAP = 16u;
+
+#if defined(__AVX__)
+  typedef __m256 lane; //! 8 floats
+  constexpr u4 WIDTH = 8u;
+  inline lane Load(const f4* at) { return _mm256_load_ps(at); }
+  inline void Store(f4* at, lane value) { _mm256_store_ps(at, value); }
+  inline lane Splat(f4 value) { return _mm256_set1_ps(value); }
+  inline lane Zero(void) { return _mm256_setzero_ps(); }
+  inline lane MulAdd(lane a, lane b, lane sum)
+  { return _mm256_add_ps(sum, _mm256_mul_ps(a, b)); }
+#else
+  typedef __m128 lane; //! 4 floats
+  constexpr u4 WIDTH = 4u;
+  inline lane Load(const f4* at) { return _mm_load_ps(at); }
+  inline void Store(f4* at, lane value) { _mm_store_ps(at, value); }
+  inline lane Splat(f4 value) { return _mm_set1_ps(value); }
+  inline lane Zero(void) { return _mm_setzero_ps(); }
+  inline lane MulAdd(lane a, lane b, lane sum)
+  { return _mm_add_ps(sum, _mm_mul_ps(a, b)); }
+#endif
+
+  //! Get rows rounded up to whole lanes of the widest SIMD width
+  inline u4 Padded(u4 rows)
+  {
+    return (rows + dp::cellNf::LANES - 1u) / dp::cellNf::LANES
+      * dp::cellNf::LANES;
+  }
+
+  //! Get an aligned allocation of the given number of floats (null if none)
+  f4* Allocate(size_t count)
+  {
+    if (!count) { return nullptr; }
+    f4* cells = static_cast<f4*>(_mm_malloc(count * sizeof(f4), ALIGN));
+    if (!cells)
+    {
+      dp::Log::Error("cellNf - allocation failed for "
+        + std::to_string(count) + " cells");
+    }
+    return cells;
+  }
+
+  //! Sum a panel's columns [first, last) into N product columns, a run of
+  //! rows at a time held in registers: P[:, j] += L[:, k] * R[k, j]
+  template <u4 N>
+  void Tile(const f4* left, u4 leftStride, const f4* right, u4 rightStride,
+    f4* product, u4 productStride, u4 first, u4 last, u4 top, u4 bottom)
+  {
+    for (u4 r = top; r < bottom; r += WIDTH)
+    {
+      lane sum[N];
+      for (u4 j = 0u; j < N; ++j)
+      {
+        sum[j] = Load(product + j * productStride + r);
+      }
+      for (u4 k = first; k < last; ++k)
+      {
+        lane column = Load(left + k * leftStride + r);
+        for (u4 j = 0u; j < N; ++j)
+        {
+          sum[j] = MulAdd(column, Splat(right[j * rightStride + k]), sum[j]);
+        }
+      }
+      for (u4 j = 0u; j < N; ++j)
+      {
+        Store(product + j * productStride + r, sum[j]);
+      }
+    }
+  }
+
+} // end anonymous namespace
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::cellNf::cellNf(u4 rows, u4 cols, f4 value)
+  : data(nullptr), rows(0u), cols(0u), stride(0u)
+{
+  Resize(rows, cols, value);
+
+} // end cellNf::cellNf(u4, u4, f4)                                           */
+
+
+dp::cellNf::cellNf(const cellNf& source)
+  : data(Allocate(static_cast<size_t>(source.stride) * source.cols)),
+  rows(source.rows), cols(source.cols), stride(source.stride)
+{
+  if (data)
+  {
+    std::memcpy(data, source.data, sizeof(f4) * stride * cols);
+  }
+  else { rows = cols = stride = 0u; }
+
+} // end cellNf::cellNf(const cellNf&)                                        */
+
+
+dp::cellNf::cellNf(cellNf&& result) noexcept
+  : data(result.data), rows(result.rows), cols(result.cols),
+  stride(result.stride)
+{
+  result.data = nullptr;
+  result.rows = result.cols = result.stride = 0u;
+
+} // end cellNf::cellNf(cellNf&&) noexcept                                    */
+
+
+dp::cellNf::~cellNf(void)
+{
+  if (data) { _mm_free(data); }
+
+} // end cellNf::~cellNf(void)                                                */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::cellNf& dp::cellNf::Fill(f4 value)
+{
+  for (u4 c = 0u; c < cols; ++c)
+  {
+    f4* col = Col(c);
+    for (u4 r = 0u; r < rows; ++r) { col[r] = value; }
+  }
+  return *this;
+
+} // end cellNf& cellNf::Fill(f4)                                             */
+
+
+dp::cellNf& dp::cellNf::Resize(u4 rowCount, u4 colCount, f4 value)
+{
+  if (rowCount == rows && colCount == cols) { return *this; }
+  u4 padded = Padded(rowCount);
+  f4* cells = Allocate(static_cast<size_t>(padded) * colCount);
+  if (!cells && padded && colCount) { return *this; } // Keep the old cells
+  if (cells) { std::memset(cells, 0, sizeof(f4) * padded * colCount); }
+
+  // Copy what both sizes hold; fill the rest (padding stays 0)
+  u4 keepRows = MinU(rows, rowCount), keepCols = MinU(cols, colCount);
+  for (u4 c = 0u; c < colCount; ++c)
+  {
+    f4* col = cells + static_cast<size_t>(c) * padded;
+    u4 r = 0u;
+    if (c < keepCols)
+    {
+      std::memcpy(col, Col(c), sizeof(f4) * keepRows);
+      r = keepRows;
+    }
+    for (; r < rowCount; ++r) { col[r] = value; }
+  }
+  if (data) { _mm_free(data); }
+  data = cells;
+  rows = cells ? rowCount : 0u;
+  cols = cells ? colCount : 0u;
+  stride = cells ? padded : 0u;
+  return *this;
+
+} // end cellNf& cellNf::Resize(u4, u4, f4)                                   */
+
+
+dp::cellNf& dp::cellNf::Transpose(void)
+{
+  if (rows == cols) // Square: swap mirrored tiles in place
+  {
+    for (u4 c0 = 0u; c0 < cols; c0 += SWAP)
+    {
+      for (u4 r0 = 0u; r0 <= c0; r0 += SWAP)
+      {
+        u4 cEnd = MinU(c0 + SWAP, cols), rEnd = MinU(r0 + SWAP, rows);
+        for (u4 c = c0; c < cEnd; ++c)
+        {
+          for (u4 r = r0; r < rEnd && r < c; ++r)
+          {
+            SwapF(data[c * stride + r], data[r * stride + c]);
+          }
+        }
+      }
+    }
+    return *this;
+  }
+
+  // Otherwise, tiles are copied into a new allocation of the swapped size
+  cellNf swapped(cols, rows);
+  for (u4 c0 = 0u; c0 < cols; c0 += SWAP)
+  {
+    for (u4 r0 = 0u; r0 < rows; r0 += SWAP)
+    {
+      u4 cEnd = MinU(c0 + SWAP, cols), rEnd = MinU(r0 + SWAP, rows);
+      for (u4 r = r0; r < rEnd; ++r)
+      {
+        f4* into = swapped.Col(r);
+        for (u4 c = c0; c < cEnd; ++c) { into[c] = data[c * stride + r]; }
+      }
+    }
+  }
+  return *this = std::move(swapped);
+
+} // end cellNf& cellNf::Transpose(void)                                      */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                            Operator Overloads                              */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::cellNf& dp::cellNf::operator=(const cellNf& source)
+{
+  if (this == &source) { return *this; }
+  if (stride != source.stride || cols != source.cols)
+  {
+    f4* cells = Allocate(static_cast<size_t>(source.stride) * source.cols);
+    if (!cells && source.stride && source.cols) { return *this; }
+    if (data) { _mm_free(data); }
+    data = cells;
+  }
+  rows = source.rows;
+  cols = source.cols;
+  stride = source.stride;
+  if (data) { std::memcpy(data, source.data, sizeof(f4) * stride * cols); }
+  return *this;
+
+} // end cellNf& cellNf::operator=(const cellNf&)                             */
+
+
+dp::cellNf& dp::cellNf::operator=(cellNf&& result) noexcept
+{
+  if (this == &result) { return *this; }
+  if (data) { _mm_free(data); }
+  data = result.data;
+  rows = result.rows;
+  cols = result.cols;
+  stride = result.stride;
+  result.data = nullptr;
+  result.rows = result.cols = result.stride = 0u;
+  return *this;
+
+} // end cellNf& cellNf::operator=(cellNf&&) noexcept                         */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Helper Functions                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+void dp::Product(const cellNf& left, const cellNf& right, cellNf& product)
+{
+  product = cellNf(left.Rows(), right.Cols());
+  u4 inner = MinU(left.Cols(), right.Rows());
+  u4 height = left.Stride(), width = right.Cols();
+  const f4* l = left.Col(0u);
+  const f4* r = right.Col(0u);
+  f4* p = product.Col(0u);
+  if (!l || !r || !p) { return; }
+
+  // Panel of left columns, block of product rows, then TILE product columns
+  // at a time: the panel block is reused from cache by every tile
+  for (u4 first = 0u; first < inner; first += PANEL)
+  {
+    u4 last = MinU(first + PANEL, inner);
+    for (u4 top = 0u; top < height; top += ROWS)
+    {
+      u4 bottom = MinU(top + ROWS, height);
+      u4 j = 0u;
+      for (; j + TILE <= width; j += TILE)
+      {
+        Tile<TILE>(l, left.Stride(), r + j * right.Stride(), right.Stride(),
+          p + j * product.Stride(), product.Stride(), first, last, top, bottom);
+      }
+      for (; j < width; ++j)
+      {
+        Tile<1u>(l, left.Stride(), r + j * right.Stride(), right.Stride(),
+          p + j * product.Stride(), product.Stride(), first, last, top, bottom);
+      }
+    }
+  }
+
+} // end void Product(const cellNf&, const cellNf&, cellNf&)                  */
+
+
+void dp::Product(const cellNf& left, const f4* vector, u4 count, f4* product)
+{
+  u4 height = left.Stride(), width = MinU(left.Cols(), count);
+  if (!height) { return; }
+  cellNf sum(left.Rows(), 1u); // Aligned, padded product column
+  f4* s = sum.Col(0u);
+
+  // Block of product rows (held in L1), summing each column scaled into it
+  for (u4 top = 0u; top < height; top += ROWS)
+  {
+    u4 bottom = MinU(top + ROWS, height);
+    for (u4 c = 0u; c < width; ++c)
+    {
+      const f4* col = left.Col(c);
+      lane scale = Splat(vector[c]);
+      for (u4 r = top; r < bottom; r += WIDTH)
+      {
+        Store(s + r, MulAdd(Load(col + r), scale, Load(s + r)));
+      }
+    }
+  }
+  std::memcpy(product, s, sizeof(f4) * left.Rows());
+
+} // end void Product(const cellNf&, const f4*, u4, f4*)                      */
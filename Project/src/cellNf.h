@@ -0,0 +1,267 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  cellNf.h
+Purpose:  Aligned, column major cell storage & blocked kernels for N-D matrices
+Details:  A matrix of R rows by C columns is held in 1 allocation, each column
+  padded to a stride of whole SIMD lanes (multiple of 8 floats), and the whole
+  buffer 32-byte aligned: every column starts aligned, and padding rows are
+  kept at 0, so kernels may run over the full stride with no remainder loops.
+
+  Products are cache-blocked over column major data:
+
+  - Matrix * matrix: the left matrix is taken a panel of columns at a time;
+    each lane-sized run of rows of 4 product columns is held in registers
+    while the panel's columns are scaled in (then 4 more product columns)
+  - Matrix * vector: rows are taken in blocks that fit in L1, each block of
+    the product summing the matrix's columns (scaled by the vector) in turn
+
+  Like mNf, all-lowercase marks a primitive container: this only holds cells
+  for mNf & mNMf, and leaves meaning (square, identity, etc) to those.
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_MAT300_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// "./src/..."
+#include "TypeErrata.h" // Platform primitive type aliases for easier porting
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  class cellNf //! Aligned column major [cell]s of a[N]y 4-byte [f]loats
+  {
+  public:
+
+    static const u4 LANES = 8u; //! Stride multiple: widest (AVX) lane count
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create rows x cols cells, each set to the given value
+    \brief
+      - create rows x cols cells, each set to the given value
+    \param rows
+      - cells per column
+    \param cols
+      - columns
+    \param value
+      - value of every cell (padding is 0 regardless)
+    */
+    cellNf(u4 rows = 0u, u4 cols = 0u, f4 value = 0.0f);
+
+
+    /** Create a copy of another source's cells
+    \brief
+      - create a copy of another source's cells
+    \param source
+      - cells to be copied (in 1 allocation)
+    */
+    cellNf(const cellNf& source);
+
+
+    /** Create cells from a function result's, taking its allocation
+    \brief
+      - create cells from a function result's, taking its allocation
+    \param result
+      - cells to be taken, left empty
+    */
+    cellNf(cellNf&& result) noexcept;
+
+
+    /** Free the cells' allocation
+    \brief
+      - free the cells' allocation
+    */
+    ~cellNf(void);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get a column's cells: Rows() values, then 0 padding up to Stride()
+    \brief
+      - get a column's cells: Rows() values, then 0 padding up to Stride()
+    \param col
+      - column subscript [0, Cols())
+    \return
+      - 32-byte aligned first cell of the column
+    */
+    inline f4* Col(u4 col)
+    { return data + col * stride; } // end f4* cellNf::Col(u4)                */
+
+
+    /** Get a column's cells: Rows() values, then 0 padding up to Stride()
+    \brief
+      - get a column's cells: Rows() values, then 0 padding up to Stride()
+    \param col
+      - column subscript [0, Cols())
+    \return
+      - 32-byte aligned first cell of the column
+    */
+    inline const f4* Col(u4 col) const
+    { return data + col * stride; } // end const f4* cellNf::Col(u4) const    */
+
+
+    /** Get the number of columns
+    \brief
+      - get the number of columns
+    \return
+      - columns held
+    */
+    inline u4 Cols(void) const
+    { return cols; } // end u4 cellNf::Cols(void) const                       */
+
+
+    /** Set every cell (not padding) to a value
+    \brief
+      - set every cell (not padding) to a value
+    \param value
+      - value for every cell
+    \return
+      - reference to the modified cells for easier subsequent inline action
+    */
+    cellNf& Fill(f4 value);
+
+
+    /** Set the number of rows & columns, keeping cells in both old & new
+    \brief
+      - set the number of rows & columns, keeping cells in both old & new
+    \param rows
+      - new cells per column
+    \param cols
+      - new columns
+    \param value
+      - value of cells not in the old size
+    \return
+      - reference to the modified cells for easier subsequent inline action
+    */
+    cellNf& Resize(u4 rows, u4 cols, f4 value = 0.0f);
+
+
+    /** Get the number of cells per column
+    \brief
+      - get the number of cells per column
+    \return
+      - rows held
+    */
+    inline u4 Rows(void) const
+    { return rows; } // end u4 cellNf::Rows(void) const                       */
+
+
+    /** Get the distance between the starts of 2 adjacent columns
+    \brief
+      - get the distance between the starts of 2 adjacent columns
+    \return
+      - Rows() rounded up to a multiple of LANES
+    */
+    inline u4 Stride(void) const
+    { return stride; } // end u4 cellNf::Stride(void) const                   */
+
+
+    /** Set cells to have swapped rows and columns (cache-blocked)
+    \brief
+      - set cells to have swapped rows and columns (cache-blocked)
+    \return
+      - reference to the modified cells for easier subsequent inline action
+    */
+    cellNf& Transpose(void);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Operator Overloads                            */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Set cells to a copy of another source's cells
+    \brief
+      - set cells to a copy of another source's cells
+    \param source
+      - cells to be copied (reusing this allocation if the size matches)
+    \return
+      - reference to the modified cells for easier subsequent inline action
+    */
+    cellNf& operator=(const cellNf& source);
+
+
+    /** Set cells from a function result's, taking its allocation
+    \brief
+      - set cells from a function result's, taking its allocation
+    \param result
+      - cells to be taken, left empty
+    \return
+      - reference to the modified cells for easier subsequent inline action
+    */
+    cellNf& operator=(cellNf&& result) noexcept;
+
+  private:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                          Private Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    //! Column major cells, 32-byte aligned (null if no cells)
+    f4* data;
+
+    //! Cells per column
+    u4 rows;
+
+    //! Number of columns
+    u4 cols;
+
+    //! Cells from 1 column's start to the next: rows padded to whole LANES
+    u4 stride;
+
+  }; // end cellNf class declaration
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                      Helper Function Declarations                        */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  /** Set product cells of a left * right matrix (blocked SIMD)
+  \brief
+    - set product cells of a left * right matrix (blocked SIMD)
+  \details
+    - only the first min(left.Cols(), right.Rows()) columns of left / rows of
+    right are summed: as if the shorter were padded with 0s
+  \param left
+    - left hand matrix cells
+  \param right
+    - right hand matrix cells
+  \param product
+    - to be set to left.Rows() x right.Cols() product cells (must be neither
+    left nor right)
+  */
+  void Product(const cellNf& left, const cellNf& right, cellNf& product);
+
+
+  /** Set product of matrix cells * a vector (blocked SIMD)
+  \brief
+    - set product of matrix cells * a vector (blocked SIMD)
+  \param left
+    - matrix cells
+  \param vector
+    - vector elements, 1 per column of left
+  \param count
+    - elements of the vector: columns past count are skipped (as if 0)
+  \param product
+    - to be set to left.Rows() product elements
+  */
+  void Product(const cellNf& left, const f4* vector, u4 count, f4* product);
+
+} // end dp namespace
@@ -16,14 +16,133 @@ written consent of DigiPen Institute of Technology is prohibited.
 /*                                  Includes                                  */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
+// <stl>
+#include <cmath>    // Arc cosine & cosine of the characteristic cubic's roots
+// "./src/..."
 #include "Log.h"    // Error / warning output message / logging
 #include "m2f.h"    // Minor determinant calculation taking m2f method
 #include "m3f.h"    // Associated class declaration header
 #include "m4f.h"    // Data promotion from 3x3 -> 4x4 affine data
+#include "Parallel.h" // Batched eigen-decompositions split over threads
 #include "Stats.h"  // Sampling struct to iterate over vertex / data lists
 #include "Value.h"  // Basic numerical operations: clamp, swap, min, max, etc
 #include "v2u.h"    // Index [min, max] ranges of read in vertex list data
 
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace
+{
+  //! Least symmetric matrices per thread of a batched PCA3 (~200 flops each)
+  constexpr u4 EIGEN_GRAIN = 256u;
+
+  //! 1/3 of a revolution, to step between the characteristic cubic's roots
+  constexpr f8 TAU_3 = 2.0943951023931957;
+
+  //! Get the unit eigen-vector of a symmetric matrix's non-repeated eigen-value
+  inline dp::v3f Eigen3Vector(f4 a00, f4 a01, f4 a02, f4 a11, f4 a12, f4 a22,
+    f4 value)
+  {
+    // Rows of (A - value * I) span a plane (rank 2): its normal is the vector
+    dp::v3f r0(a00 - value, a01, a02);
+    dp::v3f r1(a01, a11 - value, a12);
+    dp::v3f r2(a02, a12, a22 - value);
+    dp::v3f c01 = r0.Cross(r1), c02 = r0.Cross(r2), c12 = r1.Cross(r2);
+    f4 d01 = c01.LengthSquared(), d02 = c02.LengthSquared();
+    f4 d12 = c12.LengthSquared();
+    // Most accurate: the cross product of the least parallel pair of rows
+    bool pick02 = d02 > d01;
+    dp::v3f best = pick02 ? c02 : c01;
+    f4 d = pick02 ? d02 : d01;
+    bool pick12 = d12 > d;
+    best = pick12 ? c12 : best;
+    d = pick12 ? d12 : d;
+    // A null (A - value * I) means all 3 are equal: any axis will do
+    return d > 0.0f ? best * (1.0f / std::sqrt(d)) : dp::X_HAT;
+
+  } // end v3f Eigen3Vector(f4, f4, f4, f4, f4, f4, f4)                       */
+
+
+  /** Eigen-decompose a symmetric 3x3 matrix in closed form (no iteration)
+  \brief
+    - eigen-decompose a symmetric 3x3 matrix in closed form (no iteration)
+  \details
+    - eigen-values are the roots of the characteristic cubic, taken by the
+    trigonometric solution (all 3 real for symmetric input).  The eigen-vector
+    of whichever of the largest / smallest is further from the middle value is
+    found first, from (A - value * I)'s rows; the middle value's vector is then
+    solved within the plane perpendicular to it, as a 2x2 problem, so repeated
+    eigen-values (a flat or round spread) still give an orthonormal basis.
+    Decisions are selects, not branches, so the work is the same per matrix
+  \param a
+    - symmetric matrix (only the upper triangle is read)
+  \param values
+    - eigen-values, largest first
+  \return
+    - right handed, orthonormal eigen-vector columns, in values' order
+  */
+  dp::m3f Eigen3(const dp::m3f& a, dp::v3f& values)
+  {
+    // Scale to a largest magnitude of 1 to keep the cubic's terms in range
+    f4 scale = MaxF(MaxF(AbsF(a[0][0]), AbsF(a[1][1])),
+      MaxF(MaxF(AbsF(a[2][2]), AbsF(a[1][0])),
+        MaxF(AbsF(a[2][0]), AbsF(a[2][1]))));
+    f4 inv = scale > 0.0f ? 1.0f / scale : 1.0f;
+    f4 a00 = a[0][0] * inv, a11 = a[1][1] * inv, a22 = a[2][2] * inv;
+    f4 a01 = a[1][0] * inv, a02 = a[2][0] * inv, a12 = a[2][1] * inv;
+
+    // A = q * I + p * B, where B has a trace of 0 & det(B) / 2 in [-1, 1]
+    // (in f8: acos is steep near +/-1, where 2 eigen-values nearly meet)
+    f8 q = (static_cast<f8>(a00) + a11 + a22) / 3.0;
+    f8 b00 = a00 - q, b11 = a11 - q, b22 = a22 - q;
+    f8 c01 = a01, c02 = a02, c12 = a12;
+    f8 p = std::sqrt((b00 * b00 + b11 * b11 + b22 * b22
+      + 2.0 * (c01 * c01 + c02 * c02 + c12 * c12)) / 6.0);
+    f8 invP = p > 0.0 ? 1.0 / p : 0.0; // p = 0: A = q * I, any basis
+    f8 half = 0.5 * invP * invP * invP * (b00 * (b11 * b22 - c12 * c12)
+      - c01 * (c01 * b22 - c12 * c02) + c02 * (c01 * c12 - b11 * c02));
+    half = half < -1.0 ? -1.0 : (half > 1.0 ? 1.0 : half);
+    f8 phi = std::acos(half) / 3.0;
+    f4 big = static_cast<f4>(q + 2.0 * p * std::cos(phi));
+    f4 small = static_cast<f4>(q + 2.0 * p * std::cos(phi + TAU_3));
+    f4 mid = static_cast<f4>(3.0 * q) - big - small;
+
+    // 1st vector: of the extreme value further from the middle (rank 2)
+    bool bigFirst = (big - mid) >= (mid - small);
+    dp::v3f first = Eigen3Vector(a00, a01, a02, a11, a12, a22,
+      bigFirst ? big : small);
+
+    // Orthonormal <u, v> spanning the plane perpendicular to the 1st vector
+    bool xMost = AbsF(first.x) > AbsF(first.y);
+    dp::v3f u = xMost ? dp::v3f(-first.z, 0.0f, first.x)
+      : dp::v3f(0.0f, first.z, -first.y);
+    u *= 1.0f / std::sqrt(u.LengthSquared());
+    dp::v3f v = first.Cross(u);
+
+    // Middle vector: null space of the 2x2 (A - mid * I) restricted to <u, v>
+    dp::v3f au(a00 * u.x + a01 * u.y + a02 * u.z,
+      a01 * u.x + a11 * u.y + a12 * u.z, a02 * u.x + a12 * u.y + a22 * u.z);
+    dp::v3f av(a00 * v.x + a01 * v.y + a02 * v.z,
+      a01 * v.x + a11 * v.y + a12 * v.z, a02 * v.x + a12 * v.y + a22 * v.z);
+    f4 m00 = u.Dot(au) - mid, m01 = u.Dot(av), m11 = v.Dot(av) - mid;
+    bool row0 = (m00 * m00 + m01 * m01) >= (m01 * m01 + m11 * m11);
+    f4 s = row0 ? m00 : m01, t = row0 ? m01 : m11; // Longer row: <s, t>
+    f4 len = s * s + t * t; // 0: mid is repeated, so any vector in the plane
+    f4 invLen = len > 0.0f ? 1.0f / std::sqrt(len) : 0.0f;
+    f4 cu = len > 0.0f ? -t * invLen : 1.0f, cv = s * invLen;
+    dp::v3f middle = u * cu + v * cv;
+
+    // Last vector completes a right handed basis: <big, mid, small>
+    dp::v3f last = bigFirst ? first.Cross(middle) : middle.Cross(first);
+    values.Set(big * scale, mid * scale, small * scale);
+    return bigFirst ? dp::m3f(first, middle, last)
+      : dp::m3f(last, middle, first);
+
+  } // end m3f Eigen3(const m3f&, v3f&)                                       */
+
+} // end anonymous namespace
+
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 /*                               Constructors                                 */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -655,36 +774,17 @@ dp::m3f dp::Covariance3D(const v3f* data, u4 setSize, u4 samples, s2 step,
   uRng subs(samples, setSize, first, step);
   // check for null / uniform spread over [0,1] samples: shortcut w/I3
   if (!data || subs.Dataset() < 2) { return m3f(); }
-  v3f mu; // Mean of data per dimension (conventionally greek small mu)
-  v3f s;  // Sample point 
-  v3f sq; // Square mean difference from the mean: <(x-mu)^2,(y-mu)^2,(z-mu)^2>
-  f4 xy = 0.0f, xz = 0.0f, yz = 0.0f; // 2D mean diff. products: x*y, x*z, y*z
-  f4 rate = InvU(subs.Samples()); // divisor's inverse ratio of sampled points
-
-  while (subs.Scanning()) // Get the dimensional dataset sum
-  {
-    mu += data[subs.Index()];
-    ++subs;
-  }
-  mu *= rate; // Average sum to get the mean
-  subs.Reset();
-  while (subs.Scanning()) // Get the dimensional dataset sum
+  Covar3 spread; // Running mean & mean difference products, in 1 pass
+  if (subs.Samples() < subs.Dataset())
   {
-    s = data[subs.Index()] - mu;
-    sq += (s * s);
-    xy += s.x * s.y;
-    xz += s.x * s.z;
-    yz += s.y * s.z;
-    ++subs;
+    while (subs.Scanning()) // Accumulate each sampled point
+    {
+      spread.Add(data[subs.Index()]);
+      ++subs;
+    }
   }
-  // Average sums to get the mean differences from the mean
-  sq *= rate;
-  xy *= rate;
-  xz *= rate;
-  yz *= rate;
-
-  // Return symmetrical matrix of those averages
-  return m3f(sq.x, xy, xz, xy, sq.y, yz, xz, yz, sq.z);
+  else { spread.Add(data, subs.Dataset()); } // All points, in order: blocked
+  return spread.Matrix();
 
 } // end :m3f dp::Covariance3D(const v3f*, u4, u4, s2, u2)                    */
 
@@ -692,80 +792,46 @@ dp::m3f dp::Covariance3D(const v3f* data, u4 setSize, u4 samples, s2 step,
 dp::m3f dp::PCA3(const m3f& covariance, v3f* scalars)
 {
   if (!covariance.IsReal()) { return nullm3f; } // ???...least harmful result?
-  m3f basis; // Orthonormal eigen-vector basis (rotated from I3 identity m3f)
-  m3f rot; // Rotation matrix of jacobi iteration (initially I3 identity m3f)
-  m3f spread(covariance); // Context for rotations (from dataset's covariance)
-  v2u a; // Rotation's (excluded) axis subscripts (rot plane of 2 others)
-  f4 cosT, sinT, tanT; // Trig values extrapolated from remaining covariance
-  u4 i = 0;
-
-  // Iteratively perform basis rotations to isolate covariance -> spread in V
-  if (!spread.IsDiagonal()) while (true)
-  {
-    // Get optimal rotation => max covariance (subscripts p!=q excl. rot. axis)
-    switch (MaxB3F(AbsF(spread['y']['z']),
-                   AbsF(spread['x']['z']),
-                   AbsF(spread['x']['y'])))
-    {
-    case 0: a.Set(1, 2); break; // => yz was maximal; exclude ['x'] =: [0]
-    case 1: a.Set(0, 2); break; // => xz was maximal; exclude ['y'] =: [1]
-    case 2: default: a.Set(0, 1); break;//=> xy maxima; excl. ['z'] =: [2]
-    }
+  v3f values; // Eigen-values correlating to basis columns, largest first
+  m3f basis = Eigen3(covariance, values);
+  // Covariance is positive semi-definite: only rounding can make these < 0
+  if (scalars) { *scalars = values.ToAbs(); }
+  return basis;
+
+} // end m3f PCA3(m3f, v3f*)                                                  */
 
-    // Extract trig values defining rotation matrix about that world axis
-    tanT = (spread[a.one][a.one] - spread[a.two][a.two]);// (cos^2-sin^2)
-    tanT /= (2 * spread[a.one][a.two]);// 1st =>  B =:    / (2*cos*sin); -> tan
-    //tan =: sign(B) / (|B| + sqrt(B^2+1))
-    tanT = (IsNegF(tanT) ? -1 : 1) / (AbsF(tanT) + SqrtF((tanT * tanT) + 1));
-    cosT = InvF(SqrtF((tanT * tanT) + 1)); // cos =: 1 / sqrt(tan^2+1)
-    sinT = cosT * tanT; // sin =: tan*cos = (sin/cos)*cos = sin*(cos/cos) = sin
-    /*
-    if (TanT == Of || !NearF((cosT * cosT + sinT * sinT), If))
-    {
-      // tan(0) => no rotation; cos^2(t) + sin^2(t) =: 1
-      Log::Diag("m3f PCA3 - probably not extracting sin / cos correctly");
-    }
-    //else { Log::D("."); }
-    */
-    // Set Jacobi matrix by I3 differences to create world axis rotation
-    rot[a.one][a.one] = cosT;     rot[a.two][a.one] = sinT;
-    rot[a.one][a.two] = -sinT;    rot[a.two][a.two] = cosT;
-
-    // Rotate matrices by Jacobi rotation matrix
-    basis *= rot; // Rotate eigen-vector orthonormal basis by Jacobi rotation
-    spread *= rot; // Rotate spread (covariance remainder) equivalently
-     // Get inverse rot.: transpose =: rotation matrix^{-1}; only 2 skew elems.
-    SwapF(rot[a.one][a.two], rot[a.two][a.one]);
-    spread = rot * spread; // Rotate back (rot^{-1}); Aggregately isolate spread
-    // Reached termination case?
-    if (++i == 500) { Log::Error("m3f PCA3 - rotation inconclusive"); break; }
-    if (spread.IsDiagonal()) {break;}
-
-    // Reset Jacobi matrix to a clean I3 matrix for the next iteration
-    rot[a.one][a.one] = 1.0f;     rot[a.two][a.one] = 0.0f;
-    rot[a.one][a.two] = 0.0f;     rot[a.two][a.two] = 1.0f;
-    // (only set 4/9 elements, better ratio still in higher dimens)
-  }
 
-  // Get Eigen-values from diagonalized m3f; find max => axis of spread
-  if (scalars)
+void dp::PCA3(const m3f* covariances, u4 count, m3f* bases, v3f* scalars)
+{
+  if (!covariances || !bases) { return; }
+  ParallelFor(count, [&](u4 first, u4 last, u4)
   {
-    // Probably shouldn't be able to be negative anymore? better to be certain
-    scalars->Set(AbsF(spread[0][0]), AbsF(spread[1][1]), AbsF(spread[2][2]));
-  }
-  return basis;
+    v3f values;
+    for (u4 i = first; i < last; ++i)
+    {
+      if (covariances[i].IsReal())
+      {
+        bases[i] = Eigen3(covariances[i], values);
+        values.ToAbs();
+      }
+      else // ???...least harmful result?
+      {
+        bases[i] = nullm3f;
+        values.Set(0.0f, 0.0f, 0.0f);
+      }
+      if (scalars) { scalars[i] = values; }
+    }
+  }, EIGEN_GRAIN);
 
-} // end m3f PCA3(m3f, v3f*)                                                  */
+} // end void PCA3(const m3f*, u4, m3f*, v3f*)                                */
 
 
 dp::m3f dp::RotateEuler(ang x_rot, ang y_rot, ang z_rot)
 {
-  f4  zs = SinF(z_rot);
-  f4  zc = CosF(z_rot);
-  f4  ys = SinF(y_rot);
-  f4  yc = CosF(y_rot);
-  f4  xs = SinF(x_rot);
-  f4  xc = CosF(x_rot);
+  f4  zs, zc, ys, yc, xs, xc;
+  SinCosF(z_rot, zs, zc);
+  SinCosF(y_rot, ys, yc);
+  SinCosF(x_rot, xs, xc);
 
   m3f zRot(zc, -zs, 0.0f,
     zs, zc, 0.0f,
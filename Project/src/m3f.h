@@ -987,8 +987,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     with respect to each other.  the 'square' covariance can be analyzed to
     find the rates of change of a dataset, including eigen value extraction per
     this framework's applications, using eigen vectors & value to find a basis
-    of statistically analyzed data spread over the set by iterative use of the
-    Jacobi method to diagonalize the symmetrical data.
+    of statistically analyzed data spread over the set (see PCA3).
   \param datapoint
     - address of head for 3D point sample list
   \param setSize
@@ -1010,17 +1009,39 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
   \brief
     - get the orthonormal basis (& scalars), for a dataset's covariance matrix
   \details
-    - Use the PCA method of iterative Jacobi rotations to find eigen-vectors
+    - eigen-vectors are solved in closed form (characteristic cubic roots, then
+    null spaces), with no iteration: repeated eigen-values (flat or round data
+    spread) still give an orthonormal basis.  Columns are right handed, in
+    order of largest to smallest spread
   \param covariance
     - mean variance changes between dimension pairs as read from 3D dataset
   \param scalars
     - pass in value to store PCA method resultant, per vector, eigen-value set
   \return
-    - bounding sphere initially from statistic analysis of point spread, grown
+    - orthonormal eigen-vector basis of the data spread (null if not real)
   */
   m3f PCA3(const m3f& covariance, v3f* scalars = nullptr);
 
 
+  /** Get the orthonormal bases (& scalars), for many covariance matrices
+  \brief
+    - get the orthonormal bases (& scalars), for many covariance matrices
+  \details
+    - batched PCA3 (i.e. per meshlet / BVH node fits): each decomposition does
+    the same fixed, branch free work, & the batch is split over threads
+  \param covariances
+    - count covariance matrices to decompose
+  \param count
+    - number of matrices
+  \param bases
+    - count matrices to hold each orthonormal eigen-vector basis
+  \param scalars
+    - count vectors to hold each basis' eigen-values (or null if not wanted)
+  */
+  void PCA3(const m3f* covariances, u4 count, m3f* bases,
+    v3f* scalars = nullptr);
+
+
   /** Get iterative 3D rotations about world axis vectors in <z,y,x> ordering
   \brief
     - get iterative 3D rotations about world axis vectors in <z,y,x> ordering
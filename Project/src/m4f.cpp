@@ -961,8 +961,8 @@ dp::m4f dp::RotateRodriguesAffine(ang rotation, const v3f& axis,
   const v3f& affineOffset)
 {
   m4f rot;
-  f4 rSin = static_cast<f4>(sin(rotation.r()));
-  f4 rCos = static_cast<f4>(cos(rotation.r()));
+  f4 rSin, rCos;
+  SinCosF(rotation, rSin, rCos);
   f4 len2 = axis.LengthSquared();
   f4 len;
 
@@ -16,41 +16,106 @@ written consent of DigiPen Institute of Technology is prohibited.
 /*                                  Includes                                  */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
+// <stl>
+#include <ostream>  // Output stream definition for operator overload
+// "./src/..."
 #include "Log.h"    // Error / warning output message / logging
+#include "mNf.h"    // Square matrix cells to copy from / multiply by
 #include "mNMf.h"   // Associated class declaration header
 #include "Value.h"  // Basic numerical operations: clamp, swap, min, max, etc
-//#include "v2u.h"    // Dimensions access for 2D matrix read?
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace
+{
+  //! Get a row of cells as a vector (for its string formatting)
+  dp::vNf Row(const dp::cellNf& cells, u4 row)
+  {
+    dp::vNf result(cells.Cols());
+    for (u4 c = 0; c < cells.Cols(); ++c) { result[c] = cells.Col(c)[row]; }
+    return result;
+  }
+
+  //! Add scaled cells into others, first promoting into to fit from (0 fill)
+  void Accumulate(dp::cellNf& into, const dp::cellNf& from, f4 scale)
+  {
+    if (into.Rows() != from.Rows() || into.Cols() != from.Cols())
+    {
+      dp::Log::Warn("mNMf - memberwise math on inequal dimensions");
+      into.Resize(MaxU(into.Rows(), from.Rows()),
+        MaxU(into.Cols(), from.Cols()));
+    }
+    for (u4 c = 0; c < from.Cols(); ++c)
+    {
+      f4* to = into.Col(c);
+      const f4* add = from.Col(c);
+      for (u4 r = 0; r < from.Rows(); ++r) { to[r] += add[r] * scale; }
+    }
+  }
+
+  //! Get cells set from a row major list broken into rows every width cells
+  template <typename List>
+  dp::cellNf RowMajor(const List& data, u4 count, u4 width)
+  {
+    if (!width) { width = count; }
+    dp::cellNf cells(width ? (count + width - 1) / width : 0, width);
+    for (u4 i = 0; i < count; ++i)
+    {
+      cells.Col(i % width)[i / width] = static_cast<f4>(data[i]);
+    }
+    return cells;
+  }
+
+} // end anonymous namespace
+
 
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 /*                               Constructors                                 */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
 dp::mNMf::mNMf(const vNf& basis, u2 rows)
-{
-  dimens.row = rows? rows : 1;
-  dimens.col = (basis.Dimens() / dimens.row);
-  cell.Resize(dimens.Area());
-}
+  : cell(RowMajor(basis, basis.Dimens(), rows))
+{ } // end mNMf(const vNf&, u2)
+
 
 dp::mNMf::mNMf(const std::vector<vNf>& basis)
 {
-} // end mNMf(const vector<vNf>&, u2)
+  // Promote ragged rows to the longest given
+  u4 cols = 0;
+  for (u4 r = 0; r < basis.size(); ++r)
+  {
+    cols = MaxU(cols, basis[r].Dimens());
+  }
+  cell.Resize(static_cast<u4>(basis.size()), cols);
+  for (u4 r = 0; r < basis.size(); ++r)
+  {
+    for (u4 c = 0; c < basis[r].Dimens(); ++c) { cell.Col(c)[r] = basis[r][c]; }
+  }
 
+} // end mNMf(const vector<vNf>&)
 
-dp::mNMf::mNMf(std::initializer_list<f8> data, u2 rows)
-{
-  u4 max = static_cast<u4>(data.size());
 
-} // end mNf(initializer_list<f8>, u2)
+dp::mNMf::mNMf(std::initializer_list<f8> data, u2 rows)
+  : cell(RowMajor(data.begin(), static_cast<u4>(data.size()), rows))
+{ } // end mNMf(initializer_list<f8>, u2)
 
 
-dp::mNMf::mNMf(const v2u& dimens, f4 scalar)
+dp::mNMf::mNMf(const v2u& dimens, f4 scalar) : cell(dimens.row, dimens.col)
 {
-} // end mNf(const v2u&, f4)
+  u4 pivots = MinU(dimens.row, dimens.col);
+  for (u4 i = 0; i < pivots; ++i) { cell.Col(i)[i] = scalar; }
+
+} // end mNMf(const v2u&, f4)
 
 
 dp::mNMf::mNMf(void)
-{ } // end mNf(void)
+{ } // end mNMf(void)
+
+
+dp::mNMf::mNMf(const mNf& source) : cell(source.data)
+{ } // end mNMf(const mNf&)                                                   */
 
 
 dp::mNMf::mNMf(const mNMf& source) : cell(source.cell)
@@ -72,14 +137,19 @@ dp::mNMf dp::mNMf::Copy(void) const
 
 dp::v2u dp::mNMf::Dimens(void) const
 {
-  return v2u();
+  return v2u(cell.Rows(), cell.Cols());
 
 } // end v2u mNMf::Dimens(void) const                                         */
 
 
 std::string dp::mNMf::JSON(void) const
 {
-  return "[matrix data]";
+  std::string result("[");
+  for (u4 r = 0; r < cell.Rows(); ++r)
+  {
+    result += (r ? "," : "") + Row(cell, r).CSVString();
+  }
+  return result + "]";
 
 } // end std::string mNMf::JSON(void) const                                   */
 
@@ -87,6 +157,7 @@ std::string dp::mNMf::JSON(void) const
 // Set the matrix column / row dimensions to a new N square element count     */
 dp::mNMf& dp::mNMf::Resize(u2 rows, u2 cols)
 {
+  cell.Resize(rows, cols ? cols : rows);
   return *this;
 
 } // end mNMf& mNMf::Resize(u2, u2)                                           */
@@ -94,41 +165,79 @@ dp::mNMf& dp::mNMf::Resize(u2 rows, u2 cols)
 
 dp::mNMf& dp::mNMf::Set(const vNf& source)
 {
+  cell = cellNf(source.Dimens(), 1);
+  for (u4 r = 0; r < source.Dimens(); ++r) { cell.Col(0)[r] = source[r]; }
+  return *this;
+
+} // end mNMf& mNMf::Set(const vNf&)                                          */
+
+
+dp::mNMf& dp::mNMf::SetTranspose(const vNf& source)
+{
+  cell = cellNf(1, source.Dimens());
+  for (u4 c = 0; c < source.Dimens(); ++c) { cell.Col(c)[0] = source[c]; }
   return *this;
 
-} // end mNf& mNf::Set(const vNf&)                                            */
+} // end mNMf& mNMf::SetTranspose(const vNf&)                                 */
 
 
 dp::mNMf& dp::mNMf::Set(const mNf& source)
 {
+  cell = source.data;
   return *this;
 
-} // end mNf& mNf::Set(const mNf&)                                            */
+} // end mNMf& mNMf::Set(const mNf&)                                          */
+
+
+dp::mNMf& dp::mNMf::SetTranspose(const mNf& source)
+{
+  cell = source.data;
+  cell.Transpose();
+  return *this;
+
+} // end mNMf& mNMf::SetTranspose(const mNf&)                                 */
+
+
+dp::mNMf& dp::mNMf::SetTranspose(const mNMf& source)
+{
+  cell = source.cell; // (No-op on self)
+  cell.Transpose();
+  return *this;
+
+} // end mNMf& mNMf::SetTranspose(const mNMf&)                                */
 
 
 dp::mNMf& dp::mNMf::Set(const mNMf& source)
 {
+  cell = source.cell;
   return *this;
 
-} // end mNf& mNf::Set(const mNMf&)                                           */
+} // end mNMf& mNMf::Set(const mNMf&)                                         */
 
 
 std::string dp::mNMf::ToString(bool lineBreaks) const
 {
-  return "[matrix string]";
+  std::string result("[");
+  for (u4 r = 0; r < cell.Rows(); ++r)
+  {
+    if (r) { result += (lineBreaks ? ", \n" : ", "); }
+    result += Row(cell, r).CSVString(0);
+  }
+  return result + "]";
 
-} // end std::string mNf::ToString(void) const                                */
+} // end std::string mNMf::ToString(bool) const                               */
 
 
 dp::mNMf& dp::mNMf::Transpose(void)
 {
+  cell.Transpose();
   return *this;
 
-} // end mNf& mNf::Transpose(void)                                            */
+} // end mNMf& mNMf::Transpose(void)                                          */
 
 
 dp::mNMf dp::mNMf::Transposed(void) const
-{ return Copy().Transpose(); } // end mNf mNf::Transposed(void) const         */
+{ return Copy().Transpose(); } // end mNMf mNMf::Transposed(void) const       */
 
 
 
@@ -140,20 +249,14 @@ dp::mNMf& dp::mNMf::operator=(const vNf& source)
 {
   return this->Set(source);
 
-} // end mNf& mNf::operator=(const mNf&)                                      */
-
-dp::mNMf& dp::mNMf::operator=(const mNf& source)
-{
-  return this->Set(source);
-
-} // end mNf& mNf::operator=(const mNf&)                                      */
+} // end mNMf& mNMf::operator=(const vNf&)                                    */
 
 
 dp::mNMf& dp::mNMf::operator=(const mNMf& source)
 {
   return this->Set(source);
 
-} // end mNf& mNf::operator=(const mNMf&)                                     */
+} // end mNMf& mNMf::operator=(const mNMf&)                                   */
 
 
 dp::mNMf& dp::mNMf::operator=(mNMf&& result) noexcept
@@ -161,31 +264,47 @@ dp::mNMf& dp::mNMf::operator=(mNMf&& result) noexcept
   cell = std::move(result.cell);
   return *this;
 
-} // end mNf& mNf::operator=(mNf&&) noexcept                                  */
+} // end mNMf& mNMf::operator=(mNMf&&) noexcept                               */
+
+
+dp::mNMf& dp::mNMf::operator=(const mNf& source)
+{
+  return this->Set(source);
+
+} // end mNMf& mNMf::operator=(const mNf&)                                    */
+
+
+dp::mNMf& dp::mNMf::operator=(mNf&& result) noexcept
+{
+  return this->Set(result); // (mNf cells are viewed by its columns: copied)
+
+} // end mNMf& mNMf::operator=(mNf&&) noexcept                                */
 
 
 dp::mNMf dp::mNMf::operator-(void) const
 {
-  mNMf copy(Dimens());
-  for (size_t i = 0; i < cell.Dimens(); ++i)
-  {
-    copy.cell[i] = -cell[i]; // Copy each element, negated
-  }
-  return copy;
+  return Copy() *= -1.0f;
 
-} // end mNf mNf::operator-(void) const                                       */
+} // end mNMf mNMf::operator-(void) const                                     */
 
 
 dp::mNMf dp::mNMf::operator!(void) const
 {
   return Transposed();
 
-} // end mNf mNf::operator!(void)                                             */
+} // end mNMf mNMf::operator!(void) const                                     */
+
+
+const f4* dp::mNMf::operator[](u4 subscript) const
+{
+  return cell.Cols() ? cell.Col(subscript % cell.Cols()) : nullptr;
+
+} // end const f4* mNMf::operator[](u4) const                                 */
 
 
 f4* dp::mNMf::operator[](u4 subscript)
 {
-  return &(cell[subscript]);
+  return cell.Cols() ? cell.Col(subscript % cell.Cols()) : nullptr;
 
 } // end f4* mNMf::operator[](u4)                                             */
 
@@ -194,40 +313,169 @@ dp::mNMf dp::mNMf::operator+(const mNMf& other) const
 {
   return Copy() += other;
 
-} // end mNMf mNMf::operator+(const mNMf&)
+} // end mNMf mNMf::operator+(const mNMf&) const                              */
 
 
 dp::mNMf& dp::mNMf::operator+=(const mNMf& other)
 {
-  for (u4 i = 0; i < cell.Dimens(); ++i) { cell[i] += other.cell[i]; }
+  Accumulate(cell, other.cell, 1.0f);
   return *this;
 
-} // end mNMf& mNMf::operator+=(const mNMf&)
+} // end mNMf& mNMf::operator+=(const mNMf&)                                  */
 
 
 dp::mNMf dp::mNMf::operator-(const mNMf& other) const
 {
-  return Copy() += -other;
+  return Copy() -= other;
 
-} // end mNMf mNMf::operator-(const mNMf&)
+} // end mNMf mNMf::operator-(const mNMf&) const                              */
 
 
 dp::mNMf& dp::mNMf::operator-=(const mNMf& other)
 {
-  return *this += -other;
+  Accumulate(cell, other.cell, -1.0f);
+  return *this;
 
-} // end mNNf& mNMf::operator-=(const mNMf&)
+} // end mNMf& mNMf::operator-=(const mNMf&)                                  */
 
 
 dp::mNMf dp::mNMf::operator*(f4 scalar) const
 {
   return Copy() *= scalar;
 
-} // end mNf mNf::operator*(f4) const
+} // end mNMf mNMf::operator*(f4) const                                       */
+
 
 dp::mNMf& dp::mNMf::operator*=(f4 scalar)
 {
-  for (u4 i = 0; i < cell.Dimens(); ++i) { cell *= scalar; }
+  // Contiguous cells (padding is 0, and stays 0 scaled)
+  f4* cells = cell.Col(0);
+  u4 count = cell.Stride() * cell.Cols();
+  for (u4 i = 0; i < count; ++i) { cells[i] *= scalar; }
   return *this;
 
-} // end mNf& mNf::operator*=(f4) const
\ No newline at end of file
+} // end mNMf& mNMf::operator*=(f4)                                           */
+
+
+dp::vNf dp::mNMf::operator*(const vNf& vector) const
+{
+  if (vector.Dimens() != cell.Cols())
+  {
+    Log::Warn("mNMf::operator*(vNf) - vector & column counts are inequal");
+  }
+  vNf result(cell.Rows());
+  if (cell.Rows())
+  {
+    Product(cell, vector.elem, vector.Dimens(), result.elem);
+  }
+  return result;
+
+} // end vNf mNMf::operator*(const vNf&) const                                */
+
+
+dp::mNMf& dp::mNMf::operator*=(const vNf& vector)
+{
+  return Set(*this * vector);
+
+} // end mNMf& mNMf::operator*=(const vNf&)                                   */
+
+
+dp::mNMf dp::mNMf::operator*(const mNf& other) const
+{
+  return Copy() *= other;
+
+} // end mNMf mNMf::operator*(const mNf&) const                               */
+
+
+dp::mNMf& dp::mNMf::operator*=(const mNf& other)
+{
+  if (cell.Cols() != other.Dimens())
+  {
+    Log::Warn("mNMf::operator*=(mNf) - inner dimensions are inequal");
+  }
+  cellNf product;
+  Product(cell, other.data, product);
+  cell = std::move(product);
+  return *this;
+
+} // end mNMf& mNMf::operator*=(const mNf&)                                   */
+
+
+dp::mNMf dp::mNMf::operator*(const mNMf& other) const
+{
+  mNMf product;
+  if (cell.Cols() != other.cell.Rows())
+  {
+    Log::Warn("mNMf::operator*(mNMf) - inner dimensions are inequal");
+  }
+  Product(cell, other.cell, product.cell);
+  return product;
+
+} // end mNMf mNMf::operator*(const mNMf&) const                              */
+
+
+dp::mNMf& dp::mNMf::operator*=(const mNMf& other)
+{
+  return *this = *this * other;
+
+} // end mNMf& mNMf::operator*=(const mNMf&)                                  */
+
+
+dp::mNMf dp::mNMf::operator/(f4 inverseScalar) const
+{
+  return Copy() /= inverseScalar;
+
+} // end mNMf mNMf::operator/(f4) const                                       */
+
+
+dp::mNMf& dp::mNMf::operator/=(f4 inverseScalar)
+{
+  return *this *= (1.0f / inverseScalar);
+
+} // end mNMf& mNMf::operator/=(f4)                                           */
+
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                         Helper Operator Functions                          */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::mNMf dp::operator*(f4 scalar, const mNMf& rhs)
+{
+  return rhs * scalar;
+
+} // end mNMf operator*(f4, const mNMf&)                                      */
+
+
+bool dp::operator==(const mNMf& lhs, const mNMf& rhs)
+{
+  // Cells outside of the smaller matrix must be 0 to compare equal
+  v2u l = lhs.Dimens(), r = rhs.Dimens();
+  u4 rows = MaxU(l.row, r.row), cols = MaxU(l.col, r.col);
+  for (u4 c = 0; c < cols; ++c)
+  {
+    for (u4 i = 0; i < rows; ++i)
+    {
+      f4 a = (c < l.col && i < l.row) ? lhs[c][i] : 0.0f;
+      f4 b = (c < r.col && i < r.row) ? rhs[c][i] : 0.0f;
+      if (!NearF(a, b, _INf)) { return false; }
+    }
+  }
+  return true;
+
+} // end bool operator==(const mNMf&, const mNMf&)                            */
+
+
+bool dp::operator!=(const mNMf& lhs, const mNMf& rhs)
+{
+  return !(lhs == rhs);
+
+} // end bool operator!=(const mNMf&, const mNMf&)                            */
+
+
+std::ostream& dp::operator<<(std::ostream& output, const mNMf& matrix)
+{
+  output << matrix.ToString(true);
+  return output;
+
+} // end std::ostream& operator<<(std::ostream&, const mNMf&)                 */
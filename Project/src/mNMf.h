@@ -1,8 +1,8 @@
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
 File Name:  mNMf.h
 Purpose:  2D NxM, column major matrix; inputs / outputs in row major
-Details:  Arbitrary sized matrices are best stored contiguously as 1D arrays
-  but for implementation expedience, the base array being used is a vNf member.
+Details:  Arbitrary sized matrices are best stored contiguously as 1D arrays,
+  so cells are held in 1 aligned cellNf allocation, shared in layout with mNf.
   While column major storage by subscript is used by convention in other
   graphically driven vector objects, non-square matrix data is not stepped over
   in the same sort of processes, and need not have the mindset towards columns
@@ -31,6 +31,7 @@ written consent of DigiPen Institute of Technology is prohibited.
 #include <vector>       // Constructor with series of existing column vectors
 #include <initializer_list> // Preferable variadic element list construction
 // "./src/..."
+#include "cellNf.h"     // Contiguous, aligned cell storage & product kernels
 #include "TypeErrata.h" // Platform primitive type aliases for easier porting
 #include "v2u.h"       // Dimensions given as a pair of <row, column> sizes 
 #include "vNf.h"       // Member requires exposed visibility to instantiate
@@ -64,6 +65,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
       - list of matrix cell data as row major input of numeric tokens
     \param rows
       - number of elements in data before a new row is added to the matrix
+      (0 puts all of the data in 1 row)
     */
     mNMf(const vNf& data, u2 rows = 0);
 
@@ -76,6 +78,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
       - list of matrix cell numeric data which should have row divisible size
     \param rows
       - number of elements in data before a new row is added to the matrix
+      (0 puts all of the data in 1 row)
     */
     mNMf(std::initializer_list<f8> data, u2 rows = 0);
 
@@ -101,26 +104,13 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     mNMf(const v2u& dimens, f4 scalar = 1.0f);
 
     
-    /** Create an N dimensional identity matrix: 1's in the pivots, 0 elsewhere
+    /** Create an empty, 0 by 0 matrix
     \brief
-      - create an N dimensional identity matrix: 1's in the pivots, 0 elsewhere
-    \param dimens
-      - number of rows or columns corresponding to square matrix term count
-    \param scalar
-      - scalar value to be used uniformly in each trace element (col == row)
+      - create an empty, 0 by 0 matrix
     */
     mNMf(void);
 
 
-    /** Create a copy of another matrix from copied row / column data values
-    \brief
-      - create a copy of another matrix from copied row / column data values
-    \param source
-      - existing matrix to have it's row / column values copied into the new one
-    */
-    mNMf(const vNf& source);
-
-
     /** Create a copy of another matrix from copied row / column data values
     \brief
       - create a copy of another matrix from copied row / column data values
@@ -151,6 +141,15 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     /*                            Public Methods                              */
     /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
+    /** Get the contiguous, column major cells of the matrix (read only)
+    \brief
+      - get the contiguous, column major cells of the matrix (read only)
+    \return
+      - aligned cells, for kernels & factors working on whole columns
+    */
+    inline const cellNf& Cells(void) const
+    { return cell; } // end const cellNf& mNMf::Cells(void) const
+
 
     /** Get a copy of this NxM matrix data in use
     \brief
@@ -161,11 +160,11 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     mNMf Copy(void) const;
 
 
-    /** Get the N value / square dimensions of the NxN matrix data in use
+    /** Get the < row, column > dimensions of the NxM matrix data in use
     \brief
-      - get the N value / square dimensions of the NxN matrix data in use
+      - get the < row, column > dimensions of the NxM matrix data in use
     \return
-      - element count in rows or columns for the existing matrix data
+      - element count in rows and in columns for the existing matrix data
     */
     v2u Dimens(void) const;
 
@@ -179,17 +178,15 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     std::string JSON(void) const;
 
 
-    /** Set the matrix column / row dimensions to a new N square element count
+    /** Set the matrix row / column dimensions to new element counts
     \brief
-      - set the matrix column / row dimensions to a new N square element count
+      - set the matrix row / column dimensions to new element counts
     \details
-      - lower N values will truncate data; higher N values will add 0 elements
-    \param squareDimensions
-      - element count square matrix should have per dimension (columns / rows)
-    \param traceVal
-      - value to place into diagonal element subscripts (column == row)
-    \param elseVal
-      - value to place into non-diagonal element subscripts (column != row)
+      - lower values will truncate data; higher values will add 0 elements
+    \param rows
+      - element count the matrix should have per column
+    \param cols
+      - element count the matrix should have per row (0 for square: rows)
     \return
       - reference to the modified matrix for easier subsequent inline action
     */
@@ -199,8 +196,10 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     /** Set matrix column / row data to another source's column / row values
     \brief
       - set matrix column / row data to another source's column / row values
+    \details
+      - the vector's elements become a single column (N x 1)
     \param source
-      - matrix to have its data members copied into this matrix
+      - vector to have its elements copied into this matrix
     \return
       - reference to the modified matrix for easier subsequent inline action
     */
@@ -210,8 +209,10 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     /** Set matrix column / row data to another source's column / row values
     \brief
       - set matrix column / row data to another source's column / row values
+    \details
+      - the vector's elements become a single row (1 x N)
     \param source
-      - matrix to have its data members copied into this matrix
+      - vector to have its elements copied into this matrix
     \return
       - reference to the modified matrix for easier subsequent inline action
     */
@@ -515,7 +516,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     \return
       - copy of this matrix, concatenated with the other
     */
-    mNMf& operator*=(const vNf& vector) const;
+    mNMf& operator*=(const vNf& vector);
 
 
     /** Get the concatenated matrix of (this * other): both transformations
@@ -598,7 +599,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     \return
       - copy of this matrix, scaled up by (1.0 / inverseScalar)
     */
-    mNf operator/(f4 inverseScalar) const;
+    mNMf operator/(f4 inverseScalar) const;
 
 
     /** Division multiplies all members by reciprocal of inverseScalar
@@ -609,7 +610,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     \return
       - reference to the modified matrix for easier subsequent inline action
     */
-    mNf& operator/=(f4 inverseScalar);
+    mNMf& operator/=(f4 inverseScalar);
 
 
 
@@ -627,11 +628,8 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     /*                           Private Members                              */
     /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
-    //! Column major lists of vectors comprising the basis
-    vNf cell;
-
-    //! < Row, Column > size of matrix cell elements
-    v2u dimens;
+    //! Column major cells, in 1 aligned allocation (holds row / col sizes)
+    cellNf cell;
 
   }; // end mNMf struct definitions
 
@@ -17,6 +17,7 @@ written consent of DigiPen Institute of Technology is prohibited.
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
 #include "Value.h"  // Basic numerical operations: clamp, swap, min, max, etc
+#include "FactorNf.h" // LU factors for determinant, inverse & adjoint
 #include "mNf.h"  // Associated class declaration header
 #include "Log.h"    // Error / warning output message / logging
 
@@ -25,32 +26,32 @@ written consent of DigiPen Institute of Technology is prohibited.
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
 // Set matrix from column vectors (if col major ordered input == result)      */
-dp::mNf::mNf(const std::vector<vNf>& basis, Cells2D order) :
-  cell{basis}
+dp::mNf::mNf(const std::vector<vNf>& basis, Cells2D order)
 {
-  u4 max = Dimens();
-  if (max == 0)
+  // Find dimensions of input (assume potential for ragged arrays)
+  u4 max = static_cast<u4>(basis.size());
+  for (u4 i = 0; i < basis.size(); ++i)
   {
-    cell.resize(1);
-    cell[0].Resize(1);
-    cell[0][0] = 1.0f;
+    if (basis[i].Dimens() > max) { max = basis[i].Dimens(); }
   }
-  else
+  if (max == 0) // No data: 1D identity
   {
-    // Find dimensions of input (assume potential for ragged arrays)
-    for (u4 i = 0; i < Dimens(); ++i)
-    {
-      if (cell[i].Dimens() > max) { max = cell[i].Dimens(); }
-    }
-    // Set column count to max size found in input data
-    if (max > Dimens()) { cell.resize(max); }
-    for (u4 i = 0; i < Dimens(); ++i) // Per column...
+    data.Resize(1, 1, 1.0f);
+    Bind();
+    return;
+  }
+  // Shorter input is extended with 0's (new cells are 0 initialized)
+  data.Resize(max, max);
+  for (u4 i = 0; i < basis.size(); ++i)
+  {
+    for (u4 j = 0; j < basis[i].Dimens(); ++j)
     {
-      // Extend input given as needed
-      if (cell[i].Dimens() < max) { cell[i].Resize(max); }
+      if (order == Cells2D::RowMajor) { data.Col(j)[i] = basis[i][j]; }
+      else { data.Col(i)[j] = basis[i][j]; }
     }
-    if (order == Cells2D::RowMajor) { Transpose(); }
   }
+  Bind();
+
 } // end mNf(const vector<vNf>&, Cells2D)
 
 
@@ -67,56 +68,39 @@ dp::mNf::mNf(std::initializer_list<std::initializer_list<f8>> data,
       max = static_cast<u4>(data.begin()[i].size());
     }
   }
-  cell.resize(max);
-    u4 i, j;
-  if (order == Cells2D::RowMajor) for (i = 0; i < max; ++i)
-  {
-    cell[i].Resize(max);
-    row = static_cast<u4>(data.begin()[i].size());
-    for (j = 0; j < row; ++j)
-    {
-      cell[j][i] = static_cast<f4>(data.begin()[i].begin()[j]);
-    }
-    for (; j < max; ++j)
-    {
-      cell[j][i] = 0.0f;
-    }
-  }
-  else for (i = 0; i < max; ++i)
+  this->data.Resize(max, max);
+  for (u4 i = 0; i < max; ++i)
   {
-    cell[i].Resize(max);
-    row = static_cast<u4>(data.begin()[i].size());
-    for (j = 0; j < row; ++j)
-    {
-      cell[i][j] = static_cast<f4>(data.begin()[i].begin()[j]);
-    }
-    for (; j < max; ++j)
+    row = MinU(static_cast<u4>(data.begin()[i].size()), max);
+    for (u4 j = 0; j < row; ++j)
     {
-      cell[i][j] = 0.0f;
+      f4 value = static_cast<f4>(data.begin()[i].begin()[j]);
+      if (order == Cells2D::RowMajor) { this->data.Col(j)[i] = value; }
+      else { this->data.Col(i)[j] = value; }
     }
   }
+  Bind();
 
 } // end mNf(initializer_list<initializer_list<f8>>&, Cells2D)
 
 
 // Create an N dimensional identity matrix: 1's in the trace, 0 elsewhere     */
-dp::mNf::mNf(u1 dimens, f4 scalar) : cell(dimens)
+dp::mNf::mNf(u4 dimens, f4 scalar) : data(dimens, dimens)
 {
   // Initialize to identity / standard basis for given dimensions
-  for (size_t c = 0; c < Dimens(); ++c) // Per column...
-  {
-    cell[c].Resize(dimens); // Set 0 in each row entry of column elements
-    cell[c][c] = scalar; // Overriding scalar identity value in trace element
-  }
-} // end mNf(u1)
+  for (u4 c = 0; c < dimens; ++c) { data.Col(c)[c] = scalar; }
+  Bind();
+
+} // end mNf(u4, f4)
 
 
 // Create a copy of another matrix from copied row / column data values       */
-dp::mNf::mNf(const mNf& source) : cell(source.cell) { }
+dp::mNf::mNf(const mNf& source) : data(source.data) { Bind(); }
 
 
 // Create this matrix from a function result's row / column data values       */
-dp::mNf::mNf(mNf&& result) noexcept : cell(std::move(result.cell)) { }
+dp::mNf::mNf(mNf&& result) noexcept
+  : data(std::move(result.data)), cell(std::move(result.cell)) { }
 
 
 
@@ -127,7 +111,17 @@ dp::mNf::mNf(mNf&& result) noexcept : cell(std::move(result.cell)) { }
 // Set to unscaled (by 1/det) inverse matrix; transposed cofactor matrix      */
 dp::mNf& dp::mNf::ToAdjoint(f4* determinant)
 {
-  CofactorMat(determinant);
+  // Invertible: adjoint = det * inverse, in O(N^3) from 1 LU factoring
+  LUNf factors(*this);
+  f4 det = factors.Det();
+  if (determinant) { *determinant = det; }
+  if (!factors.IsSingular())
+  {
+    Set(factors.Inverse());
+    return *this *= det;
+  }
+  // Singular: adjoint is still defined, but only by the transposed cofactors
+  ToCofactor();
   Transpose();
   return *this;
 
@@ -147,10 +141,10 @@ dp::mNf dp::mNf::CofactorMat(f4* determinant) const
 {
   mNf cofactors(MinorMat(determinant));
   // Convert minor matrix to cofactor matrix
-  for (u1 i = 0; i < Dimens(); ++i)
+  for (u4 i = 0; i < Dimens(); ++i)
   {
     // Start on even subscripted columns' [1] subscript; odd columns on [0]
-    for (u1 j = (i & 1) ? 0 : 1; j < Dimens(); j += 2)
+    for (u4 j = (i & 1) ? 0 : 1; j < Dimens(); j += 2)
     {
       // Advancing by 2 subscripts, negate every (other), matrix entry
       cofactors[i][j] = -cofactors[i][j];
@@ -190,8 +184,8 @@ f4 dp::mNf::Det(void) const
   * cell[1][1] * cell[2][0] - cell[1][2] * cell[2][1] * cell[0][0]
   - cell[2][2] * cell[0][1] * cell[1][0];
     break;
-  default: // In larger cases, Gaussian elim. succinct over cofactor recursion
-    Solution(emptySet, Elim::Gaussian, &det);
+  default: // In larger cases, LU factors are O(N^3) over cofactor recursion
+    det = LUNf(*this).Det();
     break;
   }
   return det;
@@ -201,7 +195,7 @@ f4 dp::mNf::Det(void) const
 // Get the N value / square dimensions of the NxN matrix data in use
 u4 dp::mNf::Dimens(void) const
 {
-  return static_cast<u4>(cell.size());
+  return data.Cols();
 
 } // end size_t mNf::Dimens(void) const
 
@@ -211,23 +205,9 @@ dp::mNf dp::mNf::Inverse(f4* determinant) const
 {
   // Check if user input invalidates attempt
   if (determinant && *determinant == 0.0f) { return nullmat; }
-  // Pass through storage of determinant calculation
-  f4 det;
-  // Don't trust user input: cofactor has to calculate it incidentally anyhow
-
-  // Get cofactor matrix (from minor determinant matrix: internal to cofactor)
-  mNf inv(CofactorMat(&det));
-
-  // Confirm the matrix is invertible
-  if (IsSingular(&det)) { return nullmat; }
-
-  // Convert cofactor matrix to adjugate
-  inv.Transpose();
-
-  // Scale adjugate matrix to inverse matrix
-  f4 scalar = 1.0f / det;
-  inv *= scalar;
-  return inv;
+  // Don't trust user input: LU factors give the determinant incidentally
+  // (& solving each basis vector against them is O(N^3), unlike cofactors)
+  return LUNf(*this).Inverse();
 
 } // end mNf mNf::Inverse(void)
 
@@ -235,8 +215,9 @@ dp::mNf dp::mNf::Inverse(f4* determinant) const
 // Set this matrix to the inverse matrix of what it was set to                */
 dp::mNf& dp::mNf::Invert(void)
 {
-  // No-op preferable if matrix is singular...?
-  return (IsSingular() ? *this : (Set(Inverse())));
+  // No-op preferable if matrix is singular...? (1 factoring checks & inverts)
+  LUNf factors(*this);
+  return (factors.IsSingular() ? *this : Set(factors.Inverse()));
 }
 // end mNf& mNf::Invert(void)
 
@@ -272,7 +253,10 @@ bool dp::mNf::IsLowerTriangular(void) const
 // True iff the matrix is non-invertible                                      */
 bool dp::mNf::IsSingular(f4* determinant) const
 {
-  return (NearF( ((determinant) ? *determinant: Det()), 0.0f, _INf));
+  if (determinant) { return NearF(*determinant, 0.0f, _INf); }
+  // Pivots relative to the largest: an absolute test on the determinant
+  // would call 0.1 I singular from 7 x 7 up
+  return LUNf(*this).IsSingular();
 } // end bool mNf::IsSingular(f4*) const
 
 
@@ -312,50 +296,33 @@ std::string dp::mNf::JSON(void) const
 
 
 // Get the matrix holding this matrix's data, exculding the given row / col   */
-dp::mNf dp::mNf::Minor(u1 row, u1 col) const
+dp::mNf dp::mNf::Minor(u4 row, u4 col) const
 {
-  mNf result(Dimens() - 1);
+  mNf result(Dimens() - 1, 0.0f);
 
   // Validate input
   row %= Dimens(); col %= Dimens();
 
-  for (um c = 0; c < col; ++c) // Copy column data up to excluded column
-  {
-    // Populating row data up to the excluded row
-    for (um r = 0; r < row; ++r)
-    {
-      result.cell[c][r] = cell[c][r];
-    }
-    // and then after that row
-    for (um r = (um)row+1; r < Dimens(); ++r)
-    {
-      result.cell[c][r-1] = cell[c][r];
-    }
-  }
-  for (um c = (um)col+1; c < Dimens(); ++c) // Then after that column
+  for (u4 c = 0, into = 0; c < Dimens(); ++c) // Copy all but excluded column
   {
-    // Populating row data up to the excluded row
-    for (um r = 0; r < row; ++r)
-    {
-      result.cell[c-1][r] = cell[c][r];
-    }
-    // and then after that row
-    for (um r = (um)row+1; r < Dimens(); ++r)
-    {
-      result.cell[c-1][r-1] = cell[c][r];
-    }
+    if (c == col) { continue; }
+    const f4* from = data.Col(c);
+    f4* to = result.data.Col(into++);
+    // Populating row data up to the excluded row, and then after that row
+    for (u4 r = 0; r < row; ++r) { to[r] = from[r]; }
+    for (u4 r = row + 1; r < Dimens(); ++r) { to[r - 1] = from[r]; }
   }
   return result;
 
-} // end mNf mNf::Minor(u1, u1) const
+} // end mNf mNf::Minor(u4, u4) const
 
 
 // Calculate and return the determinant of the m3f without row / col         */
-f4 dp::mNf::MinorDet(u1 row, u1 col) const
+f4 dp::mNf::MinorDet(u4 row, u4 col) const
 {
   return Minor(row, col).Det();
 
-} // end f4 mNf::MinorDet(u1, u1) const
+} // end f4 mNf::MinorDet(u4, u4) const
 
 
 // Calculate and return the matrix comprised of the minor determinants        */
@@ -397,27 +364,22 @@ dp::mNf& dp::mNf::Resize(u4 squareDimensions, f4 traceVal, f4 elseVal)
 {
   if (squareDimensions != Dimens())
   {
-    cell.resize(squareDimensions);
-    for (u4 c = 0; c < Dimens(); ++c)
-    {
-      cell[c].Resize(Dimens(), elseVal);
-      cell[c][c] = traceVal;
-    }
+    u4 old = Dimens();
+    data.Resize(squareDimensions, squareDimensions, elseVal);
+    for (u4 c = old; c < Dimens(); ++c) { data.Col(c)[c] = traceVal; }
+    Bind();
   }
   return *this;
-}
+
+} // end mNf& mNf::Resize(u4, f4, f4)
 
 // Set a mNf column / row data to another source's column / row values        */
 dp::mNf& dp::mNf::Set(const mNf& source)
 {
-  // Resize to source matrix's column count
-  cell.resize(source.Dimens());
-  // Copy each column vector (no other members should be defined in matrices)
-  for (u1 c = 0; c < Dimens(); ++c) { cell[c] = source.cell[c]; }
-  // (vNf set operator should internally maintain per column resize operation)
-  // (source mNf already had to validate internally uniform size per column)
-
-  return *this;
+  if (this == &source) { return *this; }
+  // Copy all cells at once (reusing this allocation if sizes match)
+  data = source.data;
+  return Bind();
 
 } // end mNf& mNf::Set(const mNf&)
 
@@ -487,11 +449,11 @@ std::string dp::mNf::ToString(bool lineBreaks) const
 {
   mNf mt(this->Transposed());
   std::string result("[" + mt[0].CSVString(0));
-  if (lineBreaks) for (u1 i = 1; i < Dimens(); ++i)
+  if (lineBreaks) for (u4 i = 1; i < Dimens(); ++i)
   {
     result += ", \n" + mt[i].CSVString(0);
   }
-  else for (u1 i = 1; i < Dimens(); ++i)
+  else for (u4 i = 1; i < Dimens(); ++i)
   {
     result += ", " + mt[i].CSVString(0);
   }
@@ -504,8 +466,13 @@ std::string dp::mNf::ToString(bool lineBreaks) const
 // Calculate and return sum (or product) of the diagonal elements             */
 f4 dp::mNf::Trace(Oper op) const
 {
-  return (op == Oper::Product) ? (cell[0][0]) * (cell[1][1]) * (cell[2][2])
-    * (cell[3][3]) : (cell[0][0]) + (cell[1][1]) + (cell[2][2]) + (cell[3][3]);
+  f4 result = (op == Oper::Product) ? 1.0f : 0.0f;
+  for (u4 i = 0; i < Dimens(); ++i)
+  {
+    if (op == Oper::Product) { result *= data.Col(i)[i]; }
+    else { result += data.Col(i)[i]; }
+  }
+  return result;
 
 } // end f4 mNf::Trace(void) const
 
@@ -513,14 +480,8 @@ f4 dp::mNf::Trace(Oper op) const
 // Set the matrix to have swapped contents for rows and columns               */
 dp::mNf& dp::mNf::Transpose(void)
 {
-  // Exchange each upper triangular element with lower triangular partner
-  for (size_t c = 0; c < Dimens(); ++c) // In each column vector...
-  {
-    for (size_t r = 0; r < c; ++r) // Swap each row element up to the trace...
-    {
-      SwapF(cell[c][r], cell[r][c]); // With its mirrored positional element
-    }
-  }
+  // Exchange upper & lower triangular tiles in place (square: no realloc)
+  data.Transpose();
   return *this;
 
 } // end mNf& mNf::Transpose(void)
@@ -529,8 +490,8 @@ dp::mNf& dp::mNf::Transpose(void)
 // Get a copy of this m4f with swapped contents for rows and columns         */
 dp::mNf dp::mNf::Transposed(void) const
 {
-  // Quicker to just write and return the copy from existing values
-  return mNf(this->cell, Cells2D::RowMajor);
+  mNf transposed(*this);
+  return transposed.Transpose();
 
 } // end mNf mNf::Transposed(void) const
 
@@ -551,28 +512,14 @@ dp::mNf& dp::mNf::operator=(const mNf& source)
 // Set this m4f from a function result's row / column data values            */
 dp::mNf& dp::mNf::operator=(mNf&& result) noexcept
 {
+  if (this == &result) { return *this; }
+  data = std::move(result.data);
   cell = std::move(result.cell);
   return *this;
 
 } // end mNf& mNf::operator=(mNf&&) noexcept
 
 
-// Calculate the inverse matrix and return the result (no internal change)    */
-dp::mNf dp::mNf::operator-(void) const
-{
-  mNf copy(Dimens());
-  for (size_t c = 0; c < Dimens(); ++c) // In each column vector...
-  {
-    for (size_t r = 0; r < Dimens(); ++r) // Copy each row element, negated
-    {
-      copy.cell[c][r] = -cell[c][r];
-    }
-  }
-  return copy;
-
-} // end mNf mNf::operator-(void) const
-
-
 // Get the inverse of the current matrix data set (reverse transform)         */
 dp::mNf dp::mNf::operator!(void) const
 {
@@ -599,63 +546,42 @@ dp::vNf& dp::mNf::operator[](u4 subscript)
 } // end vNf& mNf::operator[](u4)
 
 
-// Calculate the member-wise addition of 2 m4f's, returning the sum          */
-dp::mNf dp::mNf::operator+(const mNf& other) const
-{
-  mNf sum(*this);
-  for (u1 i = 0; i < Dimens(); ++i) { sum[i] += other[i]; }
-  return sum;
-
-} // end mNf mNf::operator+(const mNf&)
-
-
 // Add an other m4f's values member-wise, setting the sum into this          */
 dp::mNf& dp::mNf::operator+=(const mNf& other)
 {
-  for (u1 i = 0; i < Dimens(); ++i) { cell[i] += other[i]; }
+  u4 n = MinU(Dimens(), other.Dimens());
+  for (u4 c = 0; c < n; ++c)
+  {
+    f4* into = data.Col(c);
+    const f4* from = other.data.Col(c);
+    for (u4 r = 0; r < n; ++r) { into[r] += from[r]; }
+  }
   return *this;
 
 } // end mNf& mNf::operator+=(const mNf&)
 
 
-// Calculate member-wise subtraction of 2 m4f's, returning the difference    */
-dp::mNf dp::mNf::operator-(const mNf& other) const
-{
-  mNf difference(*this);
-  for (u1 i = 0; i < Dimens(); ++i) { difference[i] -= other[i]; }
-  return difference;
-
-} // end mNf mNf::operator-(const mNf&)
-
-
 // Subtract another m4f's values member-wise, setting the difference         */
 dp::mNf& dp::mNf::operator-=(const mNf& other)
 {
-  for (u1 i = 0; i < Dimens(); ++i) { cell[i] -= other[i]; }
+  u4 n = MinU(Dimens(), other.Dimens());
+  for (u4 c = 0; c < n; ++c)
+  {
+    f4* into = data.Col(c);
+    const f4* from = other.data.Col(c);
+    for (u4 r = 0; r < n; ++r) { into[r] -= from[r]; }
+  }
   return *this;
 
 } // end mNf& mNf::operator-=(const mNf&)
 
 
-// Scalar multiplication multiplies each member by scalar constant            */
-dp::mNf dp::mNf::operator*(f4 scalar) const
-{
-  mNf scaled(*this);
-  scaled *= scalar;
-  return scaled;
-
-} // end mNf mNf::operator*(f4) const
-
-
 // Get the concatenated matrix of (this * other), doing both transformations  */
 dp::vNf dp::mNf::operator*(const vNf& vector) const
 {
-  mNf mt(this->Transposed());
-  vNf result(Dimens());
-  u4 min = MinU(Dimens(), vector.Dimens());
-  u4 max = MaxU(Dimens(), vector.Dimens());
-  for (u1 r = 0; r < min; ++r) { result[r] = mt[r].Dot(vector); }
-  if (min < max) { result.Resize(max); }
+  // Sum of columns scaled by vector elements (missing elements taken as 0)
+  vNf result(MaxU(Dimens(), vector.Dimens()));
+  if (Dimens()) { Product(data, vector.elem, vector.Dimens(), result.elem); }
   return result;
 
 } // end vNf mNf::operator*(const vNf&) const
@@ -664,7 +590,10 @@ dp::vNf dp::mNf::operator*(const vNf& vector) const
 // Scale each matrix element by scalar, setting the product into this         */
 dp::mNf& dp::mNf::operator*=(f4 scalar)
 {
-  for (u1 i = 0; i < Dimens(); ++i) { cell[i] *= scalar; }
+  // Contiguous cells (padding is 0, and stays 0 scaled)
+  f4* cells = data.Col(0);
+  u4 count = data.Stride() * data.Cols();
+  for (u4 i = 0; i < count; ++i) { cells[i] *= scalar; }
   return *this;
 } // end mNf& mNf::operator*=(f4)
 
@@ -682,28 +611,18 @@ dp::mNf dp::mNf::operator*(const mNf& other) const
 // Matrix multiplication concatenates 2 sequential transformations into 1     */
 dp::mNf& dp::mNf::operator*=(const mNf& other)
 {
-  // TODO: use validators to perform shortcut math and optimize
-  mNf mc(*this);  // Matrix copy (to not work with shifting values)
-  mNf ot = other.Transposed(); // Transposed other (for vector-wise Dot())
-
-  for (u1 i = 0; i < Dimens(); ++i)
-  {
-    for (u1 j = 0; j < Dimens(); ++j) { cell[i][j] = mc[i] * ot[j]; }
-  }
-  return *this;
+  // Blocked product into new cells (left & right can't be overwritten early)
+  cellNf product;
+  Product(data, other.data, product);
+  // Inequal dimensions: the smaller is taken as 0 extended to the larger
+  u4 n = MaxU(Dimens(), other.Dimens());
+  product.Resize(n, n);
+  data = std::move(product);
+  return Bind();
 
 } // end mNf& mNf::operator*=(const mNf&)
 
 
-// Perform division on all members, returning the result                      */
-dp::mNf dp::mNf::operator/(f4 inverseScalar) const
-{
-  f4 scalar = (1.0f / inverseScalar);
-  return ((*this) * scalar);
-
-} // end mNf mNf::operator/(f4) const
-
-
 // Division multiplies all members by reciprocal of inverseScalar             */
 dp::mNf& dp::mNf::operator/=(f4 inverseScalar)
 {
@@ -723,16 +642,30 @@ dp::mNf::operator std::string(void) const
 /*                              Private Methods                               */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
+// Point each column vector at its cells, after cells were reallocated       */
+dp::mNf& dp::mNf::Bind(void)
+{
+  cell.clear();
+  cell.reserve(Dimens());
+  for (u4 c = 0; c < Dimens(); ++c)
+  {
+    cell.push_back(vNf(data.Col(c), data.Rows(), true));
+  }
+  return *this;
+
+} // end mNf& mNf::Bind(void)
+
+
 // Calculate and set matrix to minor det matrix with oscillating signs        */
 dp::mNf& dp::mNf::ToCofactor(f4* determinant)
 {
   // Set to minor matrix, track what the determinant was
   *this = MinorMat(determinant);
   // Convert minor matrix to cofactor matrix
-  for (u1 i = 0; i < Dimens(); ++i)
+  for (u4 i = 0; i < Dimens(); ++i)
   {
     // Start on even subscripted columns' [1] subscript; odd columns on [0]
-    for (u1 j = (i & 1) ? 0 : 1; j < Dimens(); j += 2)
+    for (u4 j = (i & 1) ? 0 : 1; j < Dimens(); j += 2)
     {
       // Advancing by 2 subscripts, negate every (other), matrix entry
       cell[i][j] = -cell[i][j];
@@ -752,20 +685,12 @@ dp::mNf& dp::mNf::ToCofactor(f4* determinant)
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
 
-// Scale each matrix element by scalar, setting the product into this         */
-dp::mNf dp::operator*(f4 scalar, const dp::mNf& rhs)
-{
-  return (rhs * scalar);
-
-} // end mNf mNf::operator*(const mNf&)
-
-
 // Confirm if 2 m4f's are relatively equal across all matrix elements        */
 bool dp::operator==(const mNf& lhs, const mNf& rhs)
 {
   if (lhs.Dimens() != rhs.Dimens()) { return false; } // => not possibly equal
   // Check each column vector for equality
-  for (u1 i = 0; i < lhs.Dimens(); ++i)
+  for (u4 i = 0; i < lhs.Dimens(); ++i)
   {
     if (lhs[i] != rhs[i]) { return false; }
   }
@@ -779,7 +704,7 @@ bool dp::operator!=(const mNf& lhs, const mNf& rhs)
 {
   if (lhs.Dimens() != rhs.Dimens()) { return true; } // => must not be equal
   // Check each column vector for inequality
-  for (u1 i = 0; i < lhs.Dimens(); ++i)
+  for (u4 i = 0; i < lhs.Dimens(); ++i)
   {
     if (lhs[i] != rhs[i]) { return true; }
   }
@@ -1,14 +1,11 @@
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
 File Name:  mNf.h
 Purpose:  2D NxN, column major square matrix; inputs / outputs in row major
-Details:  Fixed size containers are not adequate for all purposes, but the 2D
-  storage of vector<vector> are likely not stored contiguously, so not ideal.
-  This does make returning an arbitrary length specific vector from a contained
-  offset into the data simpler to return, and overall simpler to get basic
-  operation working however.  Call it a first pass: sufficient for the time
-  being, until performance makes an issue of it.  A refactor would do well to
-  not only address the 2D elements being stored contiguously, but also to
-  enforce that each vector is in fact guaranteed to be of an equal length.
+Details:  Fixed size containers are not adequate for all purposes, so cells
+  are held in 1 aligned, contiguous cellNf allocation (column major, columns
+  padded to whole SIMD lanes), with products run by its cache-blocked kernels.
+  Columns are still handed out as vNf's, but borrowed: each views its stretch
+  of the shared cells, so every column is guaranteed to be of an equal length.
   Likely this would entail an NxM matrix class, for which NxN would merely be
   a derived type which specifically enforces not only equal rows among columns,
   but equal column count to row count as well.  This would enable elimination
@@ -52,10 +49,10 @@ written consent of DigiPen Institute of Technology is prohibited.
 #^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 #pragma once
 /* Design notes:
- 2D storage of vector<vector> likely not stored contiguously, so not ideal.
- Makes returning an arbitrary length specific vector from a contained offset
- into the data simpler to return, and overall simpler to get basic operation.
- Call it a first pass, for the time being, until performance makes it an issue.
+ First pass stored a vector<vNf>: 1 allocation per column, scattered in memory,
+ so products of a few hundred dimensions were allocation & cache miss bound.
+ Cells now live in 1 cellNf; the vector<vNf> remains only as borrowed views of
+ its columns, so subscripting still returns a vNf& (rebound on reallocation).
 */
 
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -65,8 +62,11 @@ written consent of DigiPen Institute of Technology is prohibited.
 // <stl>
 #include <vector>       // Constructor with series of existing column vectors
 #include <initializer_list> // Preferable variadic element list construction
+#include <utility>      // Moving cells evaluated from expressions into place
 // "./src/..."
 #include "ang.h"        // Rotation class to use to set default angles
+#include "cellNf.h"     // Contiguous, aligned cell storage & product kernels
+#include "ExprNf.h"     // Lazy +, -, scalar * & / expressions of mNf's
 #include "TypeErrata.h" // Platform primitive type aliases for easier porting
 #include "vNf.h"       // Member requires exposed visibility to instantiate
 
@@ -143,7 +143,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     \param scalar
       - scalar value to be used uniformly in each trace element (col == row)
     */
-    mNf(u1 dimens = 2, f4 scalar = 1.0f);
+    mNf(u4 dimens = 2, f4 scalar = 1.0f);
 
 
     /** Create a copy of another matrix from copied row / column data values
@@ -163,6 +163,18 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     */
     mNf(mNf&& result) noexcept;
 
+
+    /** Create a matrix by evaluating a matrix expression in a single pass
+    \brief
+      - create a matrix by evaluating a matrix expression in a single pass
+    \details
+      - expressions come from +, -, scalar * and / on mNf's (see ExprNf.h)
+    \param expr
+      - the expression to evaluate, the size of its leftmost operand
+    */
+    template <typename E>
+    mNf(const mExprNf<E>& expr);
+
     /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
     /*                            Public Methods                              */
     /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -195,6 +207,16 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     mNf AdjointMat(f4* determinant = nullptr) const;
 
 
+    /** Get the contiguous, column major cells of the matrix (read only)
+    \brief
+      - get the contiguous, column major cells of the matrix (read only)
+    \return
+      - aligned cells, for kernels & factors working on whole columns
+    */
+    inline const cellNf& Cells(void) const
+    { return data; } // end const cellNf& mNf::Cells(void) const
+
+
     /** Calculate and return minor determinant matrix with oscillating signs
     \brief
       - calculate and return minor determinant matrix with oscillating signs
@@ -285,7 +307,8 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     \param determinant
       - if you have a precalculated determinant, get whether that is 0 instead
     \return
-      - whether the matrix has determinant of 0
+      - whether the matrix has a pivot of (relatively) 0 / the given
+      determinant is 0
     */
     bool IsSingular(f4* determinant = nullptr) const;
 
@@ -320,7 +343,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     \return
       - determinant of the subset matrix discluding row and col
     */
-    mNf Minor(u1 row, u1 col) const;
+    mNf Minor(u4 row, u4 col) const;
 
 
     /** Calculate and return the determinant of the m3f without row / col
@@ -333,7 +356,7 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     \return
       - determinant of the subset matrix discluding row and col
     */
-    f4 MinorDet(u1 row, u1 col) const;
+    f4 MinorDet(u4 row, u4 col) const;
 
 
     /** Calculate and return the matrix comprised of the minor determinants
@@ -351,13 +374,14 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     \brief
       - set the matrix column / row dimensions to a new N square element count
     \details
-      - lower N values will truncate data; higher N values will add 0 elements
+      - lower N values will truncate data; higher N values will add elements:
+      existing cells are kept as they are, only new cells take the values
     \param squareDimensions
       - element count square matrix should have per dimension (columns / rows)
     \param traceVal
-      - value to place into diagonal element subscripts (column == row)
+      - value to place into new diagonal element subscripts (column == row)
     \param elseVal
-      - value to place into non-diagonal element subscripts (column != row)
+      - value to place into new non-diagonal element subscripts (column != row)
     \return
       - reference to the modified matrix for easier subsequent inline action
     */
@@ -378,6 +402,9 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     /** Perform row elimination on the (augmentable), matrix to get a solution
     \brief
       - perform row elimination on the (augmentable), matrix to get a solution
+    \details
+      - eliminates anew on every call: to solve more vectors against the same
+      basis later, factor it once (LUNf, CholeskyNf or QRNf), then Solve each
     \param aug
       - set of any N-D (matrix's dimension) vectors to solve with basis shift
     \return
@@ -453,13 +480,19 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     mNf& operator=(mNf&& result) noexcept;
 
 
-    /** Get a copy of the matrix with memberwise negated elements
+    /** Set this matrix to a matrix expression's cells, evaluated in 1 pass
     \brief
-      - get a copy of the matrix with memberwise negated elements
+      - set this matrix to a matrix expression's cells, evaluated in 1 pass
+    \details
+      - safe if this matrix is an operand (new cells are filled before the
+      old are freed if the size changes)
+    \param expr
+      - the expression to evaluate (from +, -, scalar * and / on mNf's)
     \return
-      - copy of existing matrix data with negated values memberwise
+      - reference to the modified matrix for easier subsequent inline action
     */
-    mNf operator-(void) const;
+    template <typename E>
+    mNf& operator=(const mExprNf<E>& expr);
 
 
     /** Get the inverse of the current matrix data set (reverse transform)
@@ -493,24 +526,6 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     vNf& operator[](u4 subscript);
 
 
-    /** Calculate the member-wise addition of 2 matrices, returning the sum
-    \brief
-      - calculate the member-wise addition of 2 matrices, returning the sum
-    \details
-      - to allow ubiquitous function, lower dimensional matrices will be
-      promoted to fit, while higher dimensional matrices will promote this
-      matrix with null values, setting the memberwise results with those 0s
-      (to return the overall, larger data set without truncating data).
-      In keeping with mathematical standards that disallow most divergent
-      dimensional matrix math, warnings will be logged accordingly.
-    \param other
-      - matrix to be added to this matrix's row / column data, member-wise
-    \return
-      - copy of this matrix with each entry added, member-wise, by other
-    */
-    mNf operator+(const mNf& other) const;
-
-
     /** Add an other matrix's values member-wise, setting the sum into this
     \brief
       - add an other matrix's values member-wise, setting the sum into this
@@ -529,22 +544,16 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     mNf& operator+=(const mNf& other);
 
 
-    /** Get member-wise subtraction of 2 matrices, returning the difference
+    /** Add a matrix expression's cells member-wise, in 1 pass, into this
     \brief
-      - get member-wise subtraction of 2 matrices, returning the difference
-    \details
-      - to allow ubiquitous function, lower dimensional matrices will be
-      promoted to fit, while higher dimensional matrices will promote this
-      matrix with null values, setting the memberwise results with those 0s
-      (to return the overall, larger data set without truncating data).
-      In keeping with mathematical standards that disallow most divergent
-      dimensional matrix math, warnings will be logged accordingly.
-    \param other
-      - matrix to be subtracted from this matrix's data, member-wise
+      - add a matrix expression's cells member-wise, in 1 pass, into this
+    \param expr
+      - the expression to evaluate and add, within this matrix's dimensions
     \return
-      - copy of this matrix with each entry subtracted, member-wise, by other
+      - reference to the modified matrix for easier subsequent inline action
     */
-    mNf operator-(const mNf& other) const;
+    template <typename E>
+    mNf& operator+=(const mExprNf<E>& expr);
 
 
     /** Subtract an other matrix's values member-wise, setting the difference
@@ -565,15 +574,16 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     mNf& operator-=(const mNf& other);
 
 
-    /** Scalar multiplication multiplies each member by scalar constant
+    /** Subtract a matrix expression's cells member-wise, in 1 pass, from this
     \brief
-      - scalar multiplication multiplies each member by scalar constant
-    \param scalar
-      - scalar amount by which to multiply each matrix element
+      - subtract a matrix expression's cells member-wise, in 1 pass, from this
+    \param expr
+      - the expression to evaluate and subtract, within this matrix's size
     \return
-      - copy of this matrix's data, scaled memberwise by scalar
+      - reference to the modified matrix for easier subsequent inline action
     */
-    mNf operator*(f4 scalar) const;
+    template <typename E>
+    mNf& operator-=(const mExprNf<E>& expr);
 
 
     /** Get the concatenated matrix of (this * other): both transformations
@@ -648,17 +658,6 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     mNf& operator*=(const mNf& other);
 
 
-    /** Perform division on all members, returning the result
-    \brief
-      - perform division on all members, returning the result
-    \param inverseScalar
-      - scalar amount by which to multiply the reciprocal of per matrix element
-    \return
-      - copy of this matrix, scaled up by (1.0 / inverseScalar)
-    */
-    mNf operator/(f4 inverseScalar) const;
-
-
     /** Division multiplies all members by reciprocal of inverseScalar
     \brief
       - division multiplies all members by reciprocal of inverseScalar
@@ -686,10 +685,36 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
 
   private:
 
+    //! NxM matrices copy cells straight from (& into) square ones
+    friend class mNMf;
+
     /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
     /*                           Private Methods                              */
     /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
+    /** Point each column vector at its cells, after cells were reallocated
+    \brief
+      - point each column vector at its cells, after cells were reallocated
+    \return
+      - reference to the modified matrix for easier subsequent inline action
+    */
+    mNf& Bind(void);
+
+
+    /** Write expression cells into cells: out(r, c) (op)= expr(r, c)
+    \brief
+      - write expression cells into cells: out(r, c) (op)= expr(r, c)
+    \details
+      - reads each operand cell before writing it, so out may alias one
+    \param out
+      - cells to write, all of them (Rows() x Cols())
+    \param expr
+      - the expression to evaluate (0 outside its operands)
+    */
+    template <typename Op, typename E>
+    static void Evaluate(cellNf& out, const E& expr);
+
+
     /** Calculate and set matrix to minor det matrix with oscillating signs
     \brief
       - calculate and set matrix to minor det matrix with oscillating signs
@@ -717,11 +742,34 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     /*                           Private Members                              */
     /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
-    //! Column major lists of vectors comprising the basis
+    //! Column major cells comprising the basis, in 1 aligned allocation
+    cellNf data;
+
+    //! Borrowed column vectors viewing data, for subscripting (never owning)
     std::vector<vNf> cell;
 
   }; // end mNf struct definitions
 
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                          Expression Mappings                             */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! mNf's are matrix operands (for +, -, scalar * and / in ExprNf.h)
+  template <>
+  struct IsMatNf<mNf> : std::true_type { };
+
+  //! mNf's are held in expressions as leaves pointing at their cells
+  template <>
+  struct mNodeNf<mNf>
+  {
+    using type = mLeafNf;
+    static inline mLeafNf Make(const mNf& operand)
+    {
+      const cellNf& cells = operand.Cells();
+      return mLeafNf(cells.Col(0), cells.Cols(), cells.Stride());
+    }
+  };
+
 
 
   /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
@@ -853,19 +901,6 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
   /*                     Helper Operator Declarations                         */
   /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
-  /** Scale each matrix element by scalar, setting the product into this
-  \brief
-    - scale each matrix element by scalar, setting the product into this
-  \param scalar
-    - scalar amount by which to multiply each matrix element
-  \param rhs
-    - matrix to be scaled member-wise by the scalar amount
-  \return
-    - copy of the rhs matrix scaled member-wise by scalar
-  */
-  mNf operator*(f4 scalar, const mNf& rhs);
-
-
   /** Confirm if 2 matrix's are relatively equal across all matrix elements
   \brief
     - confirm if 2 matrix's are relatively equal across all matrix elements
@@ -904,4 +939,78 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
   */
   std::ostream& operator<<(std::ostream& output, const mNf& matrix);
 
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                        Template Method Definitions                       */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  // Create a matrix by evaluating a matrix expression in a single pass       */
+  template <typename E>
+  mNf::mNf(const mExprNf<E>& expr)
+    : data(expr.Self().Dimens(), expr.Self().Dimens())
+  {
+    Evaluate<SetNf>(data, expr.Self());
+    Bind();
+
+  } // end mNf(const mExprNf<E>&)
+
+
+  // Set this matrix to a matrix expression's cells, evaluated in 1 pass      */
+  template <typename E>
+  mNf& mNf::operator=(const mExprNf<E>& expr)
+  {
+    u4 n = expr.Self().Dimens();
+    if (n != Dimens()) // Fill new cells, then free the old
+    {
+      cellNf cells(n, n);
+      Evaluate<SetNf>(cells, expr.Self());
+      data = std::move(cells);
+      return Bind();
+    }
+    Evaluate<SetNf>(data, expr.Self());
+    return *this;
+
+  } // end mNf& operator=(const mExprNf<E>&)
+
+
+  // Add a matrix expression's cells member-wise, in 1 pass, into this        */
+  template <typename E>
+  mNf& mNf::operator+=(const mExprNf<E>& expr)
+  {
+    Evaluate<AddNf>(data, expr.Self());
+    return *this;
+
+  } // end mNf& operator+=(const mExprNf<E>&)
+
+
+  // Subtract a matrix expression's cells member-wise, in 1 pass, from this   */
+  template <typename E>
+  mNf& mNf::operator-=(const mExprNf<E>& expr)
+  {
+    Evaluate<SubNf>(data, expr.Self());
+    return *this;
+
+  } // end mNf& operator-=(const mExprNf<E>&)
+
+
+  // Write expression cells into cells: out(r, c) (op)= expr(r, c)            */
+  template <typename Op, typename E>
+  void mNf::Evaluate(cellNf& out, const E& expr)
+  {
+    u4 n = out.Cols();
+    if (n == 0) { return; }
+    if (expr.Uniform(n)) // Same layout: 1 flat loop, padding included (0's)
+    {
+      f4* cells = out.Col(0);
+      u4 count = out.Stride() * n;
+      for (u4 i = 0; i < count; ++i) { Op::Store(cells[i], expr.Get(i)); }
+      return;
+    }
+    for (u4 c = 0; c < n; ++c)
+    {
+      f4* into = out.Col(c);
+      for (u4 r = 0; r < n; ++r) { Op::Store(into[r], expr.At(r, c)); }
+    }
+  } // end void Evaluate(cellNf&, const E&)
+
 } // end dp namespace
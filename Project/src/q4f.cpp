@@ -0,0 +1,278 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  q4f.cpp
+Purpose:  Unit quaternion of 4, 4-byte floats for 3D orientation / rotation
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// <stl>
+#include <cmath>    // Arc tangents of matrix elements for on demand eulers
+// "./src/..."
+#include "m3f.h"    // Rotation matrix input / output
+#include "m4f.h"    // Homogeneous rotation matrix output
+#include "q4f.h"    // Associated class declaration header
+#include "Value.h"  // SinCosF(), SqrtF(), ACosF() float trig & roots
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                              Private Helpers                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace
+{
+  //! cos(half angle) past which Slerp's sin(angle) is too small to divide by
+  constexpr f4 SLERP_NEAR = 0.9995f;
+
+  //! cos(pitch) under which eulers are at a pole (gimbal lock), as Transform
+  constexpr f4 GIMBAL_NEAR = 1e-6f;
+
+} // end anonymous namespace
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Constructors                                 */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::q4f::q4f(f4 x_value, f4 y_value, f4 z_value, f4 w_value)
+  : x(x_value), y(y_value), z(z_value), w(w_value)
+{ } // end q4f::q4f(f4, f4, f4, f4)                                           */
+
+
+dp::q4f::q4f(ang rotation, const v3f& axis) : q4f()
+{
+  f4 len2 = axis.LengthSquared();
+  if (len2 <= 0.0f) { return; } // No axis => no rotation
+  f4 s, c;
+  SinCosF(rotation * 0.5f, s, c);
+  if (!NearF(len2, 1.0f)) { s /= SqrtF(len2); }
+  x = axis.x * s;
+  y = axis.y * s;
+  z = axis.z * s;
+  w = c;
+
+} // end q4f::q4f(ang, const v3f&)                                            */
+
+
+dp::q4f::q4f(ang z_rot, ang y_rot, ang x_rot)
+{
+  f4 sz, cz, sy, cy, sx, cx;
+  SinCosF(z_rot * 0.5f, sz, cz);
+  SinCosF(y_rot * 0.5f, sy, cy);
+  SinCosF(x_rot * 0.5f, sx, cx);
+  // qz * qy * qx, expanded
+  x = sx * cy * cz - cx * sy * sz;
+  y = cx * sy * cz + sx * cy * sz;
+  z = cx * cy * sz - sx * sy * cz;
+  w = cx * cy * cz + sx * sy * sz;
+
+} // end q4f::q4f(ang, ang, ang)                                              */
+
+
+dp::q4f::q4f(const m3f& basis)
+{
+  // Rrc: row r, column c of the rotation
+  f4 r00 = basis[0].x, r10 = basis[0].y, r20 = basis[0].z;
+  f4 r01 = basis[1].x, r11 = basis[1].y, r21 = basis[1].z;
+  f4 r02 = basis[2].x, r12 = basis[2].y, r22 = basis[2].z;
+  f4 trace = r00 + r11 + r22;
+  // Shepperd: root the largest of 4w^2 / 4x^2 / 4y^2 / 4z^2 for stability
+  if (trace > 0.0f)
+  {
+    f4 s = 0.5f / SqrtF(trace + 1.0f);
+    w = 0.25f / s;
+    x = (r21 - r12) * s;
+    y = (r02 - r20) * s;
+    z = (r10 - r01) * s;
+  }
+  else if (r00 > r11 && r00 > r22)
+  {
+    f4 s = 2.0f * SqrtF(1.0f + r00 - r11 - r22), inv = 1.0f / s;
+    w = (r21 - r12) * inv;
+    x = 0.25f * s;
+    y = (r01 + r10) * inv;
+    z = (r02 + r20) * inv;
+  }
+  else if (r11 > r22)
+  {
+    f4 s = 2.0f * SqrtF(1.0f + r11 - r00 - r22), inv = 1.0f / s;
+    w = (r02 - r20) * inv;
+    x = (r01 + r10) * inv;
+    y = 0.25f * s;
+    z = (r12 + r21) * inv;
+  }
+  else
+  {
+    f4 s = 2.0f * SqrtF(1.0f + r22 - r00 - r11), inv = 1.0f / s;
+    w = (r10 - r01) * inv;
+    x = (r02 + r20) * inv;
+    y = (r12 + r21) * inv;
+    z = 0.25f * s;
+  }
+  Normalize();
+
+} // end q4f::q4f(const m3f&)                                                 */
+
+
+dp::q4f::q4f(const q4f& source) : q4f(source.x, source.y, source.z, source.w)
+{ } // end q4f::q4f(const q4f&)                                               */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                               Public Methods                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+void dp::q4f::Basis(v3f& u, v3f& v, v3f& n) const
+{
+  f4 x2 = x + x, y2 = y + y, z2 = z + z;
+  f4 xx = x * x2, yy = y * y2, zz = z * z2;
+  f4 xy = x * y2, xz = x * z2, yz = y * z2;
+  f4 wx = w * x2, wy = w * y2, wz = w * z2;
+  u.Set(1.0f - yy - zz, xy + wz, xz - wy);
+  v.Set(xy - wz, 1.0f - xx - zz, yz + wx);
+  n.Set(xz + wy, yz - wx, 1.0f - xx - yy);
+
+} // end void q4f::Basis(v3f&, v3f&, v3f&) const                              */
+
+
+dp::v3f dp::q4f::Eulers(void) const
+{
+  v3f u, v, n;
+  Basis(u, v, n);
+  // Rz * Ry * Rx: u.z = -sin(y), & <u.x, u.y> = cos(y) * <cos(z), sin(z)>
+  f4 cy = SqrtF(u.x * u.x + u.y * u.y);
+  if (cy < GIMBAL_NEAR)
+  {
+    return v3f(std::atan2(-n.y, v.y), std::atan2(-u.z, cy), 0.0f);
+  }
+  return v3f(std::atan2(v.z, n.z), std::atan2(-u.z, cy),
+    std::atan2(u.y, u.x));
+
+} // end v3f q4f::Eulers(void) const                                          */
+
+
+dp::m3f dp::q4f::Linear(void) const
+{
+  v3f u, v, n;
+  Basis(u, v, n);
+  return m3f(u, v, n);
+
+} // end m3f q4f::Linear(void) const                                          */
+
+
+dp::m4f dp::q4f::Matrix(void) const
+{
+  v3f u, v, n;
+  Basis(u, v, n);
+  return m4f(u, v, n);
+
+} // end m4f q4f::Matrix(void) const                                          */
+
+
+dp::q4f& dp::q4f::Normalize(void)
+{
+  f4 len2 = Dot(*this);
+  if (!(len2 > 0.0f) || !IsRealF(len2)) { return *this = identq4f; }
+  if (NearF(len2, 1.0f)) { return *this; }
+  f4 inv = 1.0f / SqrtF(len2);
+  x *= inv;
+  y *= inv;
+  z *= inv;
+  w *= inv;
+  return *this;
+
+} // end q4f& q4f::Normalize(void)                                            */
+
+
+dp::v3f dp::q4f::Rotate(const v3f& point) const
+{
+  v3f axis(x, y, z);
+  v3f t = axis.Cross(point) * 2.0f;
+  return point + t * w + axis.Cross(t);
+
+} // end v3f q4f::Rotate(const v3f&) const                                    */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Operator Overloads                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::q4f dp::q4f::operator*(const q4f& other) const
+{
+  return q4f(w * other.x + x * other.w + y * other.z - z * other.y,
+             w * other.y - x * other.z + y * other.w + z * other.x,
+             w * other.z + x * other.y - y * other.x + z * other.w,
+             w * other.w - x * other.x - y * other.y - z * other.z);
+
+} // end q4f q4f::operator*(const q4f&) const                                 */
+
+
+dp::q4f& dp::q4f::operator*=(const q4f& other)
+{
+  return *this = *this * other;
+
+} // end q4f& q4f::operator*=(const q4f&)                                     */
+
+
+dp::q4f& dp::q4f::operator=(const q4f& source)
+{
+  x = source.x;
+  y = source.y;
+  z = source.z;
+  w = source.w;
+  return *this;
+
+} // end q4f& q4f::operator=(const q4f&)                                      */
+
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Helper Functions                               */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+dp::q4f dp::Nlerp(const q4f& from, const q4f& to, f4 t)
+{
+  // q & -q are the same rotation: blend toward whichever is nearer
+  f4 s = 1.0f - t, e = (from.Dot(to) < 0.0f) ? -t : t;
+  return q4f(from.x * s + to.x * e, from.y * s + to.y * e,
+    from.z * s + to.z * e, from.w * s + to.w * e).Normalize();
+
+} // end q4f Nlerp(const q4f&, const q4f&, f4)                                */
+
+
+void dp::Nlerp(const q4f* from, const q4f* to, u4 count, f4 t, q4f* result)
+{
+  if (!from || !to || !result) { return; }
+  for (u4 i = 0u; i < count; ++i) { result[i] = Nlerp(from[i], to[i], t); }
+
+} // end void Nlerp(const q4f*, const q4f*, u4, f4, q4f*)                     */
+
+
+dp::q4f dp::Slerp(const q4f& from, const q4f& to, f4 t)
+{
+  f4 cosine = from.Dot(to), sign = 1.0f;
+  if (cosine < 0.0f) { cosine = -cosine; sign = -1.0f; } // Shortest path
+  if (cosine > SLERP_NEAR) { return Nlerp(from, to, t); }
+  ang between = ACosF(cosine);
+  f4 inv = 1.0f / SqrtF(1.0f - cosine * cosine); // 1 / sin(between)
+  f4 s = SinF(between * (1.0f - t)) * inv;
+  f4 e = SinF(between * t) * inv * sign;
+  return q4f(from.x * s + to.x * e, from.y * s + to.y * e,
+    from.z * s + to.z * e, from.w * s + to.w * e);
+
+} // end q4f Slerp(const q4f&, const q4f&, f4)                                */
+
+
+void dp::Slerp(const q4f* from, const q4f* to, u4 count, f4 t, q4f* result)
+{
+  if (!from || !to || !result) { return; }
+  for (u4 i = 0u; i < count; ++i) { result[i] = Slerp(from[i], to[i], t); }
+
+} // end void Slerp(const q4f*, const q4f*, u4, f4, q4f*)                     */
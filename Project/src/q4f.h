@@ -0,0 +1,368 @@
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#
+File Name:  q4f.h
+Purpose:  Unit quaternion of 4, 4-byte floats for 3D orientation / rotation
+Language: C++ / Eng, MSVC (used, but should work with most compilers)
+Platform: MSVC / Windows 10 (used, but should have no requirements)
+Project:  a.Surprise_CS350_1
+Author:   Ari Surprise, a.surprise, 40000218
+Creation date:  Summer 2022
+Copyright (C) 2022 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute of Technology is prohibited.
+#^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+#pragma once
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                                  Includes                                  */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+// "./src/..."
+#include "ang.h"        // Rotation amounts, for axis-angle & euler input
+#include "TypeErrata.h" // Platform primitive type aliases for easier porting
+#include "v3f.h"        // Rotation axis, local basis & rotated point results
+
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+/*                             Forward References                             */
+/*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
+{
+  class m3f; // Rotation basis converted to / from the unit quaternion
+  class m4f; // Affine transform built from the rotation with zero translation
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                             Public Classes                               */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  union q4f //! Quaternion of 4, 4-byte floats: <x, y, z> * sin(a/2), cos(a/2)
+  {
+  public:
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                           Public Members                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    f4 v[4];  //! Sequential value array: vector part, then scalar part
+    struct {
+      f4 x;   //! Vector part on the x-axis: rotation axis x * sin(half angle)
+      f4 y;   //! Vector part on the y-axis: rotation axis y * sin(half angle)
+      f4 z;   //! Vector part on the z-axis: rotation axis z * sin(half angle)
+      f4 w;   //! Scalar part: cos(half angle) of the rotation
+    };
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                             Constructors                               */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Create a quaternion from raw elements (default: identity, no rotation)
+    \brief
+      - create a quaternion from raw elements (default: identity, no rotation)
+    \param x_value
+      - vector part x-axis element
+    \param y_value
+      - vector part y-axis element
+    \param z_value
+      - vector part z-axis element
+    \param w_value
+      - scalar part element
+    */
+    q4f(f4 x_value = 0.0f, f4 y_value = 0.0f, f4 z_value = 0.0f,
+      f4 w_value = 1.0f);
+
+
+    /** Create a unit quaternion rotating by an angle about an axis
+    \brief
+      - create a unit quaternion rotating by an angle about an axis
+    \param rotation
+      - counter-clockwise rotation about the axis (looking down the axis)
+    \param axis
+      - direction to rotate about (normalized if not unit length already)
+    */
+    q4f(ang rotation, const v3f& axis);
+
+
+    /** Create a unit quaternion from euler angles rotating in <z, y, x> order
+    \brief
+      - create a unit quaternion from euler angles rotating in <z, y, x> order
+    \details
+      - intrinsic rotations: roll about z, yaw about the rolled y, then pitch
+      about the resulting x (as Transform orientations), ie Rz * Ry * Rx
+    \param z_rot
+      - rotation about the z-axis (roll), applied 1st
+    \param y_rot
+      - rotation about the local y-axis (yaw), applied 2nd
+    \param x_rot
+      - rotation about the local x-axis (pitch), applied last
+    */
+    q4f(ang z_rot, ang y_rot, ang x_rot);
+
+
+    /** Create a unit quaternion from a rotation matrix (orthonormal columns)
+    \brief
+      - create a unit quaternion from a rotation matrix (orthonormal columns)
+    \param basis
+      - right-handed, orthonormal local axes as columns <u, v, n>
+    */
+    explicit q4f(const m3f& basis);
+
+
+    /** Create a copy of another quaternion
+    \brief
+      - create a copy of another quaternion
+    \param source
+      - quaternion to copy elements of
+    */
+    q4f(const q4f& source);
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Public Methods                              */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the local axes the rotation turns the world x, y & z axes into
+    \brief
+      - get the local axes the rotation turns the world x, y & z axes into
+    \details
+      - no trig: each axis is a column of the rotation matrix
+    \param u
+      - destination of the rotated x-axis
+    \param v
+      - destination of the rotated y-axis
+    \param n
+      - destination of the rotated z-axis
+    */
+    void Basis(v3f& u, v3f& v, v3f& n) const;
+
+
+    /** Get the conjugate: the inverse rotation of a unit quaternion
+    \brief
+      - get the conjugate: the inverse rotation of a unit quaternion
+    \return
+      - quaternion with the vector part negated
+    */
+    inline q4f Conjugate(void) const
+    { return q4f(-x, -y, -z, w); } // end q4f q4f::Conjugate(void) const      */
+
+
+    /** Get the 4D dot product with another quaternion
+    \brief
+      - get the 4D dot product with another quaternion
+    \param other
+      - quaternion to dot with this one
+    \return
+      - cos(half the angle between) the 2 rotations, if both are unit length
+    */
+    inline f4 Dot(const q4f& other) const
+    {
+      return x * other.x + y * other.y + z * other.z + w * other.w;
+    } // end f4 q4f::Dot(const q4f&) const                                    */
+
+
+    /** Get the euler angles of the rotation in <z, y, x> order (on demand)
+    \brief
+      - get the euler angles of the rotation in <z, y, x> order (on demand)
+    \details
+      - inverse of q4f(z_rot, y_rot, x_rot): y in [-pi/2, pi/2], & at the
+      poles (gimbal lock) all of the spin is put in x, with z set to 0
+    \return
+      - <x (pitch), y (yaw), z (roll)> radians
+    */
+    v3f Eulers(void) const;
+
+
+    /** Get the 3x3 rotation matrix of the quaternion (no trig)
+    \brief
+      - get the 3x3 rotation matrix of the quaternion (no trig)
+    \return
+      - rotation matrix with the local axes as columns
+    */
+    m3f Linear(void) const;
+
+
+    /** Get the homogeneous 4x4 rotation matrix of the quaternion (no trig)
+    \brief
+      - get the homogeneous 4x4 rotation matrix of the quaternion (no trig)
+    \return
+      - affine rotation matrix with the local axes as columns, no translation
+    */
+    m4f Matrix(void) const;
+
+
+    /** Scale the quaternion to unit length (identity if it has no length)
+    \brief
+      - scale the quaternion to unit length (identity if it has no length)
+    \return
+      - reference to the modified q4f for easier subsequent inline action
+    */
+    q4f& Normalize(void);
+
+
+    /** Rotate a vector / point (about the origin) by the unit quaternion
+    \brief
+      - rotate a vector / point (about the origin) by the unit quaternion
+    \details
+      - v + 2w(q x v) + 2q x (q x v): cheaper than q * v * q' or a matrix
+    \param point
+      - vector to be rotated
+    \return
+      - rotated vector
+    */
+    v3f Rotate(const v3f& point) const;
+
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+    /*                            Operator Overloads                          */
+    /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+    /** Get the negated quaternion (the same rotation for unit quaternions)
+    \brief
+      - get the negated quaternion (the same rotation for unit quaternions)
+    \return
+      - quaternion with every element negated
+    */
+    inline q4f operator-(void) const
+    { return q4f(-x, -y, -z, -w); } // end q4f q4f::operator-(void) const     */
+
+
+    /** Compose rotations: this applied after the other (Hamilton product)
+    \brief
+      - compose rotations: this applied after the other (Hamilton product)
+    \details
+      - right hand side rotations are about this rotation's local axes
+    \param other
+      - rotation applied first
+    \return
+      - combined rotation (unit length if both inputs are)
+    */
+    q4f operator*(const q4f& other) const;
+
+
+    /** Compose rotations in place: the other applied 1st, about local axes
+    \brief
+      - compose rotations in place: the other applied 1st, about local axes
+    \param other
+      - rotation applied first
+    \return
+      - reference to the modified q4f for easier subsequent inline action
+    */
+    q4f& operator*=(const q4f& other);
+
+
+    /** Set this quaternion to a copy of another quaternion's elements
+    \brief
+      - set this quaternion to a copy of another quaternion's elements
+    \param source
+      - quaternion to copy elements of
+    \return
+      - reference to the modified q4f for easier subsequent inline action
+    */
+    q4f& operator=(const q4f& source);
+
+
+    /** Check if 2 quaternions hold the same elements
+    \brief
+      - check if 2 quaternions hold the same elements
+    \param other
+      - quaternion to compare with
+    \return
+      - true if every element is equal
+    */
+    inline bool operator==(const q4f& other) const
+    {
+      return x == other.x && y == other.y && z == other.z && w == other.w;
+    } // end bool q4f::operator==(const q4f&) const                           */
+
+
+    /** Check if 2 quaternions differ in any element
+    \brief
+      - check if 2 quaternions differ in any element
+    \param other
+      - quaternion to compare with
+    \return
+      - true if any element differs
+    */
+    inline bool operator!=(const q4f& other) const
+    { return !(*this == other); } // end bool q4f::operator!=(const q4f&) c   */
+
+  }; // end q4f union
+
+
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                       Helper Constant Declarations                       */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  //! Identity quaternion: no rotation
+  static const q4f identq4f(0.0f, 0.0f, 0.0f, 1.0f);
+
+
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                       Helper Function Declarations                       */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  /** Normalized linear interpolation between 2 rotations (shortest path)
+  \brief
+    - normalized linear interpolation between 2 rotations (shortest path)
+  \details
+    - no trig: constant speed isn't kept, but the path is the same as Slerp
+  \param from
+    - unit rotation at t = 0
+  \param to
+    - unit rotation at t = 1
+  \param t
+    - interpolation parameter [0,1]
+  \return
+    - unit rotation between from & to
+  */
+  q4f Nlerp(const q4f& from, const q4f& to, f4 t);
+
+
+  /** Normalized linear interpolation of lists of rotation pairs
+  \brief
+    - normalized linear interpolation of lists of rotation pairs
+  \param from
+    - first of count unit rotations at t = 0
+  \param to
+    - first of count unit rotations at t = 1
+  \param count
+    - number of rotation pairs to interpolate
+  \param t
+    - interpolation parameter [0,1], shared by every pair
+  \param result
+    - first of count destination rotations (may alias from or to)
+  */
+  void Nlerp(const q4f* from, const q4f* to, u4 count, f4 t, q4f* result);
+
+
+  /** Spherical linear interpolation between 2 rotations (shortest path)
+  \brief
+    - spherical linear interpolation between 2 rotations (shortest path)
+  \details
+    - constant angular speed; falls back to Nlerp for nearly equal inputs
+  \param from
+    - unit rotation at t = 0
+  \param to
+    - unit rotation at t = 1
+  \param t
+    - interpolation parameter [0,1]
+  \return
+    - unit rotation between from & to
+  */
+  q4f Slerp(const q4f& from, const q4f& to, f4 t);
+
+
+  /** Spherical linear interpolation of lists of rotation pairs
+  \brief
+    - spherical linear interpolation of lists of rotation pairs
+  \param from
+    - first of count unit rotations at t = 0
+  \param to
+    - first of count unit rotations at t = 1
+  \param count
+    - number of rotation pairs to interpolate
+  \param t
+    - interpolation parameter [0,1], shared by every pair
+  \param result
+    - first of count destination rotations (may alias from or to)
+  */
+  void Slerp(const q4f* from, const q4f* to, u4 count, f4 t, q4f* result);
+
+} // end dp namespace
@@ -44,8 +44,11 @@ dp::v2f::v2f(f4 xu_value, f4 yv_value) : x(xu_value), y(yv_value)
 { } // end v2f::v2f(f4, f4)                                                   */
 
 dp::v2f::v2f(ang angle, f4 magnitude)
-  : x(magnitude * CosF(angle)), y(magnitude * SinF(angle))
-{ } // end v2f(ang, f4)                                                       */
+{
+  SinCosF(angle, y, x);
+  x *= magnitude;
+  y *= magnitude;
+} // end v2f(ang, f4)                                                         */
 
 dp::v2f::v2f(const dp::v2f& source) : v2f(source.x, source.y)
 { } // end v2f::v2f(const v2f&)                                               */
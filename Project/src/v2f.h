@@ -377,7 +377,9 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     */
     inline v2f& Set(ang angle, f4 magnitude = 1.0f)
     {
-      return Set(magnitude*CosF(angle), magnitude*SinF(angle));
+      f4 s, c;
+      SinCosF(angle, s, c);
+      return Set(magnitude * c, magnitude * s);
     } // end v2f& Set(ang, f4)                                                */
 
 
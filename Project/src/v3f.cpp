@@ -44,7 +44,10 @@ dp::v3f::v3f(f4 xr_value, f4 yg_value, f4 zb_value)
 
 dp::v3f::v3f(ang angle, PLANE on, f4 magnitude)
 {
-  f4 s = magnitude * SinF(angle), c = magnitude * CosF(angle);
+  f4 s, c;
+  SinCosF(angle, s, c);
+  s *= magnitude;
+  c *= magnitude;
 
   switch (on)
   {
@@ -35,7 +35,7 @@ written consent of DigiPen Institute of Technology is prohibited.
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
 dp::vNf::vNf(u4 dimensions, f4 value)
-  : dimens(dimensions)
+  : dimens(dimensions), owner(true)
 {
   if (dimens != 0)
   {
@@ -57,7 +57,7 @@ dp::vNf::vNf(u4 dimensions, f4 value)
 
 
 dp::vNf::vNf(const std::vector<f4>& init)
-  : dimens(static_cast<u4>(init.size()))
+  : dimens(static_cast<u4>(init.size())), owner(true)
 {
   elem = new f4[dimens];
   if (elem)
@@ -79,7 +79,7 @@ dp::vNf::vNf(const std::vector<f4>& init)
 
 // Creates an n-D vector of f4 to hold (up to n), f4, from 8 byte floats      */
 dp::vNf::vNf(std::initializer_list<f4> init)
-  : dimens(static_cast<u4>(init.size()))
+  : dimens(static_cast<u4>(init.size())), owner(true)
 {
   elem = new f4[dimens];
   if (elem)
@@ -100,7 +100,7 @@ dp::vNf::vNf(std::initializer_list<f4> init)
 
 // Creates an n dimensional vector from another source n dimensional vNf      */
 dp::vNf::vNf(const vNf& source)
-  : dimens(source.dimens)
+  : dimens(source.dimens), owner(true)
 {
   elem = new f4[dimens];
   if (elem)
@@ -118,18 +118,31 @@ dp::vNf::vNf(const vNf& source)
 
 // Creates a vNf from a vNf value reference resultant from a function         */
 dp::vNf::vNf(vNf&& result) noexcept
-  : dimens(std::move(result.dimens)), elem(std::move(result.elem))
-{} // end vNf(vNf&&) noexcept
+  : dimens(result.dimens), elem(result.elem), owner(result.owner)
+{
+  // Owned elements are taken; borrowed ones stay shared with their matrix
+  if (owner)
+  {
+    result.elem = nullptr;
+    result.dimens = 0;
+  }
+} // end vNf(vNf&&) noexcept
+
+
+// Create a vector viewing (not owning) elements held by another object       */
+dp::vNf::vNf(f4* cells, u4 dimensions, bool borrowed)
+  : dimens(cells ? dimensions : 0), elem(cells), owner(!borrowed)
+{} // end vNf(f4*, u4, bool)
 
 
 // Clean up vector data before going out of scope                             */
 dp::vNf::~vNf(void)
 {
-  if (elem)
+  if (elem && owner)
   {
     delete[] elem;
-    elem = nullptr;
   }
+  elem = nullptr;
   dimens = 0;
 } // end ~vNf(void)
 
@@ -182,9 +195,9 @@ std::string dp::vNf::CSVString(bool pack) const
 
 f4 dp::vNf::Dot(const vNf& other) const
 {
-  f4 prodSum = 0.0f;
-  vNf product = Multiply(other);
-  for (u4 i = 0; i < dimens; ++i) { prodSum += (product.elem[i]); }
+  f4 prodSum = 0.0f; // 0 * x = 0 = x * 0 for any length discrepancies
+  u4 shorter = MinU(dimens, other.dimens);
+  for (u4 i = 0; i < shorter; ++i) { prodSum += elem[i] * other.elem[i]; }
   return prodSum;
 
 } // end f4 Dot(const vNf&) const                                             */
@@ -272,6 +285,11 @@ std::string dp::vNf::PointString(bool pack) const
 
 dp::vNf& dp::vNf::Resize(u4 dimensions, f4 value)
 {
+  if (!owner && dimensions != dimens)
+  {
+    Log::Warn("vNf::Resize - matrix column size is fixed by its matrix");
+    return *this;
+  }
   if (dimensions != dimens)
   {
     if (dimensions == 0) // make null vector
@@ -338,18 +356,14 @@ std::string dp::vNf::VecString(bool pack) const
 /*                            Operator Overloads                              */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
-// Create a negated vector with negated copies of each element value          */
-dp::vNf dp::vNf::operator-(void) const
-{
-  vNf result(*this);
-  !result;
-  return result;
-} // end vNf operator-(void) const
-
-
 // Sets the source vNf member values into this vNf value fields               */
 dp::vNf& dp::vNf::operator=(f4 value)
 {
+  if (!owner) // Borrowed: keep size, as <value, 0, ..., 0>
+  {
+    for (u4 i = 0; i < dimens; ++i) { elem[i] = (i ? 0.0f : value); }
+    return *this;
+  }
   if (elem) { delete[] elem; }
   dimens = 1;
   elem = new f4[dimens];
@@ -362,9 +376,20 @@ dp::vNf& dp::vNf::operator=(f4 value)
 // Sets the source vNf member values into this vNf value fields               */
 dp::vNf& dp::vNf::operator=(const vNf& source)
 {
-  if (elem) { delete[] elem; }
-  dimens = source.dimens;
-  elem = new f4[dimens];
+  if (this == &source) { return *this; }
+  if (!owner) // Borrowed: keep size, copying what fits and 0 filling the rest
+  {
+    u4 shorter = MinU(dimens, source.dimens);
+    for (u4 i = 0; i < shorter; ++i) { elem[i] = source.elem[i]; }
+    for (u4 i = shorter; i < dimens; ++i) { elem[i] = 0.0f; }
+    return *this;
+  }
+  if (dimens != source.dimens)
+  {
+    if (elem) { delete[] elem; }
+    dimens = source.dimens;
+    elem = dimens ? new f4[dimens] : nullptr;
+  }
   if (elem)
   {
     for (size_t i = 0; i < dimens; ++i) { elem[i] = source.elem[i]; }
@@ -376,8 +401,17 @@ dp::vNf& dp::vNf::operator=(const vNf& source)
 // Surrogate a vNf value reference returned from a function for this vNf      */
 dp::vNf& dp::vNf::operator=(vNf&& result) noexcept
 {
-  dimens = std::move(result.dimens);
-  elem = std::move(result.elem);
+  if (this == &result) { return *this; }
+  // Borrowed elements on either side can't change hands: copy values instead
+  if (!owner || !result.owner)
+  {
+    return *this = static_cast<const vNf&>(result);
+  }
+  if (elem) { delete[] elem; }
+  dimens = result.dimens;
+  elem = result.elem;
+  result.dimens = 0;
+  result.elem = nullptr;
   return *this;
 } // end vNf& operator=(vNf&& result) noexcept
 
@@ -409,19 +443,6 @@ f4& dp::vNf::operator[](size_t index)
 } // end f4& operator[](u2 index)
 
 
-// Calculate the member-wise addition of 2 vNf's and return the result        */
-dp::vNf dp::vNf::operator+(const vNf& other) const
-{
-  vNf result(((dimens >= other.dimens) ? *this : other));
-  if (result.dimens > 0)
-  {
-    if (result.dimens == dimens) { result += other; } // *this used as basis
-    else { result += *this; } // other used as result's basis
-  }
-  return result;
-} // end vNf operator+(const vNf&) const
-
-
 // Add an other vNf's values memberwise into this vNf's values                */
 dp::vNf& dp::vNf::operator+=(const vNf& other)
 {
@@ -431,19 +452,6 @@ dp::vNf& dp::vNf::operator+=(const vNf& other)
 } // end vNf& operator+=(const vNf&)
 
 
-// Calculate the member-wise difference of 2 vNf's and return the result      */
-dp::vNf dp::vNf::operator-(const vNf& other) const
-{
-  vNf result(((dimens >= other.dimens) ? *this : other));
-  if (result.dimens > 0)
-  {
-    if (result.dimens == dimens) { result -= other; } // *this used as basis
-    else { result -= *this; } // other used as result's basis
-  }
-  return result;
-} // end vNf operator-(const vNf&) const
-
-
 // Add an other vNf's values memberwise into this vNf's values                */
 dp::vNf& dp::vNf::operator-=(const vNf& other)
 {
@@ -453,11 +461,6 @@ dp::vNf& dp::vNf::operator-=(const vNf& other)
 } // end vNf& operator-=(const vNf&)
 
 
-// Scalar product multiplies each field uniformly by a scalar constant        */
-dp::vNf dp::vNf::operator*(f4 scalar) const
-{ return (scalar * (*this)); } // end vNf& operator-=(const vNf&)
-
-
 // Scalar product sets all members to grow uniformly by a scalar constant     */
 dp::vNf& dp::vNf::operator*=(f4 scalar)
 {
@@ -471,19 +474,6 @@ f4 dp::vNf::operator*(const vNf& other) const
 { return Dot(other); } // end f4 operator*(const vNf&) const
 
 
-// Perform uniform division by divisor, returning the result                  */
-dp::vNf dp::vNf::operator/(f4 divisor) const
-{
-  if (divisor == 0.0f)
-  {
-    Log::Warn("vNf::operator/= - division by 0 request ignored");
-    return *this;
-  }
-  return *this * (1.0f / divisor);
-
-} // end vNf operator/(f4) const
-
-
 // Divides all members uniformly by divisor, setting the result               */
 dp::vNf& dp::vNf::operator/=(f4 divisor)
 {
@@ -506,15 +496,6 @@ dp::vNf::operator std::string(void) const
 /*                         Helper Operator Overloads                          */
 /*^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
-// Left hand scalar multiplication scales each element of rhs uniformly       */
-dp::vNf dp::operator*(f4 scalar, const dp::vNf& rhs)
-{
-  vNf result(rhs);
-  result *= scalar;
-  return result;
-} // end vNf operator*(f4, const dp::vNf&)
-
-
 // Confirm if 2 vectors are relatively equal in all elements per dimension    */
 bool dp::operator==(const vNf& lhs, const vNf& rhs)
 {
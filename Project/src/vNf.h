@@ -21,6 +21,7 @@ written consent of DigiPen Institute of Technology is prohibited.
 #include <string>           // String building methods for text value output
 #include <vector>           // EmptySet definition (null vector of vNf)
 // "./src/..."
+#include "ExprNf.h"       // Lazy +, -, scalar * & / expressions of vNf's
 #include "TypeErrata.h"   // Platform primitive type aliases for easier porting
 
 
@@ -93,12 +94,26 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     /** Creates a vNf from a vNf value reference resultant from a function
     \brief
       - creates a vNf from a vNf value reference resultant from a function
+    \details
+      - a matrix column (borrowed elements) stays a view of the same column
     \param result
       - the vNf value reference to surrogate into this
     */
     vNf(vNf&& result) noexcept;
 
 
+    /** Creates a vNf by evaluating a vector expression in a single pass
+    \brief
+      - creates a vNf by evaluating a vector expression in a single pass
+    \details
+      - expressions come from +, -, scalar * and / on vNf's (see ExprNf.h)
+    \param expr
+      - the expression to evaluate, as long as its longest operand
+    */
+    template <typename E>
+    vNf(const vExprNf<E>& expr);
+
+
     /** Clean up vector data before going out of scope
     \brief
       - clean up vector data before going out of scope
@@ -319,15 +334,6 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     /*                          Operator Overloads                            */
     /*^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
-    /** Create a negated vector with negated copies of each element value
-    \brief
-      - create a negated vector with negated copies of each element value
-    \return
-      - copy of the vNf with negated member values
-    */
-    vNf operator-(void) const;
-
-
     /** Sets the source vNf to a 1D vNf with the given value set in subscript 0
     \brief
       - sets the source vNf to a 1D vNf with the given value set in subscript 0
@@ -362,6 +368,20 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     vNf& operator=(vNf&& result) noexcept;
 
 
+    /** Sets this vNf to a vector expression's values, evaluated in 1 pass
+    \brief
+      - sets this vNf to a vector expression's values, evaluated in 1 pass
+    \details
+      - safe if this vNf is an operand; borrowed vectors keep their size
+    \param expr
+      - the expression to evaluate (from +, -, scalar * and / on vNf's)
+    \return
+      - reference to the modified vNf for easier subsequent inline action
+    */
+    template <typename E>
+    vNf& operator=(const vExprNf<E>& expr);
+
+
     /** Negates each element value: for each { element[i] = -element[i]; }
     \brief
       - negates each element value: for each { element[i] = -element[i]; }
@@ -393,19 +413,6 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     f4& operator[](size_t channel);
 
 
-    /** Calculate the member-wise addition of 2 vNf's and return the result
-    \brief
-      - calculate the member-wise addition of 2 vNf's and return the result
-    \details
-      - the larger dimensioned vector may be used if inequal vectors are given
-    \param other
-      - source vector to have memberwise summation performed with a copy of this
-    \return
-      - copy of the memberwise sum of this vNf and the other into a new vNf
-    */
-    vNf operator+(const vNf& other) const;
-
-
     /** Add an other vNf's values memberwise into this vNf's values
     \brief
       - add an other vNf's values memberwise into this vNf's values
@@ -417,15 +424,16 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     vNf& operator+=(const vNf& other);
 
 
-    /** Calculate the member-wise difference of 2 vNf's and return the result
+    /** Add a vector expression's values memberwise into this vNf's values
     \brief
-      - calculate the member-wise difference of 2 vNf's and return the result
-    \param other
-      - source vector to have memberwise difference calculated with this (copy)
+      - add a vector expression's values memberwise into this vNf's values
+    \param expr
+      - the expression to evaluate and add, within this vNf's dimensions
     \return
-      - copy of the memberwise difference of this and the other, in a new vNf
+      - reference to the modified vNf for easier subsequent inline action
     */
-    vNf operator-(const vNf& other) const;
+    template <typename E>
+    vNf& operator+=(const vExprNf<E>& expr);
 
 
     /** Add an other vNf's values memberwise into this vNf's values
@@ -439,15 +447,16 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     vNf& operator-=(const vNf& other);
 
 
-    /** Scalar product multiplies each field uniformly by a scalar constant
+    /** Subtract a vector expression's values memberwise from this vNf's values
     \brief
-      - scalar product multiplies each field uniformly by a scalar constant
-    \param scalar
-      - scalar amount by which to multiply x, y, z and w values
+      - subtract a vector expression's values memberwise from this vNf's values
+    \param expr
+      - the expression to evaluate and subtract, within this vNf's dimensions
     \return
-      - resultant, member-wise scaled copy of this vNf's valuce
+      - reference to the modified vNf for easier subsequent inline action
     */
-    vNf operator*(f4 scalar) const;
+    template <typename E>
+    vNf& operator-=(const vExprNf<E>& expr);
 
 
     /** Scalar product sets all members to grow uniformly by a scalar constant
@@ -472,19 +481,6 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
     f4 operator*(const vNf& other) const;
 
 
-    /** Perform uniform division by divisor, returning the result
-    \brief
-      - perform uniform division by divisor, returning the result
-    \details
-      - vectors aren't commutative, can have a scalar quotient; aren't divisors
-    \param divisor
-      - amount by which <x,y,z,w> values are uniformly divided
-    \return
-      - resultant, member-wise scaled copy of this vNf's values
-    */
-    vNf operator/(f4 divisor) const;
-
-
     /** Divides all members uniformly by divisor, setting the result
     \brief
       - divides all members uniformly by divisor, setting the result
@@ -512,30 +508,74 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
 
   private:
 
+    //! Matrices read elements directly, & hand out columns as borrowed vNf's
+    friend class mNf;
+    friend class mNMf;
+    friend class SparseNf;
+    friend class ConjugateNf;
+    friend struct vNodeNf<vNf>;
+
+    /** Write expression values into elements: out[i] (op)= expr[i], i < count
+    \brief
+      - write expression values into elements: out[i] (op)= expr[i], i < count
+    \details
+      - reads each operand subscript before writing it, so out may alias one
+    \param out
+      - first element to write
+    \param count
+      - number of elements to write
+    \param expr
+      - the expression to evaluate (0 past its operands' ends)
+    */
+    template <typename Op, typename E>
+    static void Evaluate(f4* out, u4 count, const E& expr);
+
+    /** Create a vector viewing (not owning) elements held by another object
+    \brief
+      - create a vector viewing (not owning) elements held by another object
+    \details
+      - a borrowed vector never frees or resizes its elements: assignment
+      copies what fits and sets the rest to 0, so the owner's layout is kept
+    \param cells
+      - first of the elements to view, which must outlive the vector
+    \param dimensions
+      - number of elements viewed
+    \param borrowed
+      - distinguishes from the owning constructors (always true)
+    */
+    vNf(f4* cells, u4 dimensions, bool borrowed);
+
     //! Number of elements contained in the vector
     u4 dimens;
 
     //! List of values for each dimension member
     f4* elem;
 
+    //! False if elem is borrowed from a matrix (never freed or resized)
+    bool owner;
+
   }; // end vNf class
 
   /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
-  /*                        Helper Operator Overloads                         */
+  /*                          Expression Mappings                             */
   /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
+  //! vNf's are vector operands (for +, -, scalar * and / in ExprNf.h)
+  template <>
+  struct IsVecNf<vNf> : std::true_type { };
 
-  /** Left hand scalar multiplication scales each element of rhs uniformly
-  \brief
-    - left hand scalar multiplication scales each element of rhs uniformly
-  \param scalar
-    - scalar amount by which to multiply x, y and z values of right-hand side
-  \param rhs
-    - right-hand side argument to be copied and scaled in x, y and z by scalar
-  \return
-    - copy of rhs vNf's values, scaled by scalar in <x,y,z>, with <w> intact
-  */
-   vNf operator*(f4 scalar, const vNf& rhs);
+  //! vNf's are held in expressions as leaves pointing at their elements
+  template <>
+  struct vNodeNf<vNf>
+  {
+    using type = vLeafNf;
+    static inline vLeafNf Make(const vNf& operand)
+    { return vLeafNf(operand.elem, operand.dimens); }
+  };
+
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                        Helper Operator Overloads                         */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
 
 
    /** Confirm if 2 vectors are relatively equal in all elements per dimension
@@ -570,4 +610,78 @@ namespace dp //! Contents for use within DigiPen MAT (& CS) class assignments
 
    const std::vector<vNf> emptySet;
 
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+  /*                        Template Method Definitions                       */
+  /*^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^^#^^^^^^^^*/
+
+  // Creates a vNf by evaluating a vector expression in a single pass         */
+  template <typename E>
+  vNf::vNf(const vExprNf<E>& expr)
+    : dimens(expr.Self().Dimens()), elem(nullptr), owner(true)
+  {
+    if (dimens != 0)
+    {
+      elem = new f4[dimens];
+      Evaluate<SetNf>(elem, dimens, expr.Self());
+    }
+  } // end vNf(const vExprNf<E>&)
+
+
+  // Sets this vNf to a vector expression's values, evaluated in 1 pass       */
+  template <typename E>
+  vNf& vNf::operator=(const vExprNf<E>& expr)
+  {
+    const E& source = expr.Self();
+    u4 dimensions = source.Dimens();
+    if (owner && dimensions != dimens) // Fill new elements, then free the old
+    {
+      f4* cells = dimensions ? new f4[dimensions] : nullptr;
+      Evaluate<SetNf>(cells, dimensions, source);
+      if (elem) { delete[] elem; }
+      elem = cells;
+      dimens = dimensions;
+      return *this;
+    }
+    // Borrowed: keep size, 0 filling past the expression's end
+    Evaluate<SetNf>(elem, dimens, source);
+    return *this;
+  } // end vNf& operator=(const vExprNf<E>&)
+
+
+  // Add a vector expression's values memberwise into this vNf's values       */
+  template <typename E>
+  vNf& vNf::operator+=(const vExprNf<E>& expr)
+  {
+    u4 dimensions = expr.Self().Dimens();
+    Evaluate<AddNf>(elem, dimensions < dimens ? dimensions : dimens,
+      expr.Self());
+    return *this;
+  } // end vNf& operator+=(const vExprNf<E>&)
+
+
+  // Subtract a vector expression's values memberwise from this vNf's values  */
+  template <typename E>
+  vNf& vNf::operator-=(const vExprNf<E>& expr)
+  {
+    u4 dimensions = expr.Self().Dimens();
+    Evaluate<SubNf>(elem, dimensions < dimens ? dimensions : dimens,
+      expr.Self());
+    return *this;
+  } // end vNf& operator-=(const vExprNf<E>&)
+
+
+  // Write expression values into elements: out[i] (op)= expr[i], i < count   */
+  template <typename Op, typename E>
+  void vNf::Evaluate(f4* out, u4 count, const E& expr)
+  {
+    if (expr.Spans(count)) // No bounds checks: a flat, vectorizable loop
+    {
+      for (u4 i = 0; i < count; ++i) { Op::Store(out[i], expr.Get(i)); }
+    }
+    else
+    {
+      for (u4 i = 0; i < count; ++i) { Op::Store(out[i], expr.At(i)); }
+    }
+  } // end void Evaluate(f4*, u4, const E&)
+
 } // end dp namespace